@@ -136,6 +136,7 @@ static const char* errToStr(RV3032::Err code) {
     case RV3032::Err::TRANSPORT_CONTRACT_VIOLATION:
       return "TRANSPORT_CONTRACT_VIOLATION";
     case RV3032::Err::INTERNAL_STATE_ERROR: return "INTERNAL_STATE_ERROR";
+    case RV3032::Err::JOB_CANCELLED:        return "JOB_CANCELLED";
     default: return "UNKNOWN";
   }
 }
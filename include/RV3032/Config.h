@@ -93,6 +93,31 @@ struct Config {
   ///       supplied timeout before another instruction can be dispatched.
   NowMsFn nowMs = nullptr;
 
+  /// @brief Reuse measured transfer timestamps instead of re-reading nowMs.
+  /// @note Requires nowMs. Inside one pollJob() or tick() EEPROM step the
+  ///       completion time measured after each timed transport callback is
+  ///       also used as the health stamp and as the start time of the next
+  ///       instruction, so the clock is read about once per instruction
+  ///       instead of three to four times. Every callback is still followed
+  ///       by a fresh clock read, so deadline and timeout proofs are unchanged.
+  bool reuseTransferTimestamps = false;
+
+  /// @brief Validity-cache lifetime for startReadTimeSnapshotJob() (default: 0)
+  /// @note 0 keeps every snapshot status-first. Otherwise a status-first
+  ///       snapshot that observes PORF and VLF clear is trusted for this many
+  ///       application milliseconds, and later snapshots read calendar and
+  ///       Status as one 0x01..0x0D burst. Call invalidateValidityCache() from
+  ///       INT or power-event handlers; any transport failure also drops it.
+  uint32_t snapshotValidityMaxAgeMs = 0;
+
+  /// @brief Serve persistent reads from proven bytes (default: false)
+  /// @note When true, every byte proven by a persistent read or write job's
+  ///       two-read sequence is cached, and startReadConfigurationEepromJob()
+  ///       or startReadUserEepromJob() covering only cached bytes completes
+  ///       at admission with zero I2C. WRITE_ONE dispatch, observed PORF/VLF,
+  ///       invalidatePersistentCache() and end() drop cached bytes.
+  bool cachePersistentReads = false;
+
   /// @brief Sleeping/yielding wait source (optional for cooperative use).
   /// @note Required by ensurePrimaryCellConfiguration(); must not spin or use I2C.
   WaitMsFn waitMs = nullptr;
@@ -134,6 +159,16 @@ struct Config {
   ///       from transport-callback completion.
   uint32_t eepromTimeoutMs = 100;
 
+  /// @brief Write-behind window for configuration persistence (default: 0)
+  /// @note 0 queues each persisted change at once. Otherwise the active
+  ///       register still updates immediately, but its EEPROM item is staged
+  ///       per register and released to the queue only after the value has
+  ///       stayed unchanged for this many milliseconds, or on
+  ///       flushPersistence(). Intermediate values never reach EEPROM.
+  ///       Staged values are discarded by end(). Valid range is
+  ///       0..PERSISTENCE_DEBOUNCE_MAX_MS.
+  uint32_t persistenceDebounceMs = 0;
+
   /// @brief Consecutive failure threshold before transitioning to OFFLINE
   /// @note Default: 5. DEGRADED = [1, offlineThreshold-1], OFFLINE >= offlineThreshold.
   ///       Values below 1 are rejected by begin().
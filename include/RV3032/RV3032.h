@@ -83,6 +83,74 @@ struct DateTime {
   uint8_t weekday = 0;   ///< User-assigned weekday value (0-6)
 };
 
+/**
+ * @class ValidDateTime
+ * @brief DateTime that has already passed isValidDateTime()
+ *
+ * Only RV3032 factories create one: makeValidDateTime(), unixToDateTime(),
+ * and readTime(), or a default value of 2000-01-01 00:00:00. The overloads
+ * taking it skip revalidation, which matters when the same value is reused or
+ * stepped through conversions in a loop.
+ */
+class ValidDateTime {
+ public:
+  ValidDateTime() = default;
+
+  /** @brief Validated fields; read-only so the invariant cannot be broken. */
+  const DateTime& value() const { return _value; }
+
+ private:
+  friend class RV3032;
+  explicit ValidDateTime(const DateTime& value) : _value(value) {}
+
+  DateTime _value{2000, 1, 1, 0, 0, 0, 0};
+};
+
+/**
+ * @struct PackedDateTime
+ * @brief 32-bit calendar key whose unsigned order is chronological order
+ *
+ * The fields are packed as mixed-radix digits, most significant first:
+ * `((((year - 2000) * 12 + month - 1) * 31 + day - 1) * 86400) + second of
+ * day`. Separate bit fields would need 33 bits. Differences are not elapsed
+ * seconds, because every month occupies 31 day slots; convert with
+ * packedToUnix() for arithmetic. Weekday is not stored.
+ */
+struct PackedDateTime {
+  uint32_t value = 0; ///< Packed key; compare directly or via the operators.
+};
+
+constexpr bool operator==(PackedDateTime a, PackedDateTime b) {
+  return a.value == b.value;
+}
+constexpr bool operator!=(PackedDateTime a, PackedDateTime b) {
+  return a.value != b.value;
+}
+constexpr bool operator<(PackedDateTime a, PackedDateTime b) {
+  return a.value < b.value;
+}
+
+/**
+ * @struct TimeZone
+ * @brief Precompiled UTC-offset history for the 2000..2099 UTC domain
+ *
+ * Generated into RV3032/TimeZones.h by scripts/generate_timezones.py.
+ * offsetsMinutes holds count + 1 entries: entry i applies before
+ * transitionsUtc[i], and the last entry applies after the final transition.
+ */
+struct TimeZone {
+  const char* name;               ///< IANA zone name, for diagnostics only.
+  const uint32_t* transitionsUtc; ///< Ascending Unix seconds; null when count is 0.
+  const int16_t* offsetsMinutes;  ///< East-positive UTC offsets in minutes.
+  uint16_t count;                 ///< Number of transitions.
+};
+
+/** @brief Choice for a local time that a backward transition repeats. */
+enum class LocalTimeFold : uint8_t {
+  EARLIER, ///< First occurrence, under the offset before the transition.
+  LATER    ///< Second occurrence, under the offset after the transition.
+};
+
 /**
  * @enum TimestampSource
  * @brief Hardware timestamp source blocks.
@@ -168,6 +236,17 @@ enum class TimerFrequency : uint8_t {
   Hz1_60 = 3    ///< 1/60 Hz (one tick per minute)
 };
 
+/** @brief Timer configuration plus remaining time derived from an anchor. */
+struct TimerRemaining {
+  uint16_t ticks = 0; ///< Configured preset (hardware has no live count).
+  TimerFrequency frequency = TimerFrequency::Hz4096; ///< Timer clock source.
+  bool enabled = false; ///< Control 1 TE.
+  bool flagSet = false; ///< Status TF from the same burst.
+  uint32_t periodMs = 0; ///< One countdown period, rounded up.
+  uint32_t remainingMs = 0; ///< Time to the next TF, rounded up; 0 when disabled.
+  uint32_t uncertaintyMs = 0; ///< One timer tick, rounded up.
+};
+
 /**
  * @enum EviDebounce
  * @brief External event input edge/level qualification settings (EVI ET bits)
@@ -268,6 +347,64 @@ struct TimeSnapshot {
   uint8_t statusRaw = 0; ///< Status byte observed before calendar access.
   bool statusValid = false; ///< True after the Status read succeeded.
   bool timeValid = false; ///< False when PORF/VLF prevented calendar access.
+  bool cachedValidity = false; ///< True when one fused 0x01..0x0D burst served it.
+};
+
+/** @brief Wake-source bits reported by startReadWakeReasonJob(). */
+enum class WakeReason : uint16_t {
+  ALARM = 1u << 0, ///< AF.
+  TIMER = 1u << 1, ///< TF.
+  UPDATE = 1u << 2, ///< UF.
+  EVENT = 1u << 3, ///< EVF.
+  TEMP_LOW = 1u << 4, ///< TLF.
+  TEMP_HIGH = 1u << 5, ///< THF.
+  BACKUP_SWITCH = 1u << 6, ///< BSF.
+  CLOCK_OUTPUT = 1u << 7, ///< CLKF.
+  POWER_ON_RESET = 1u << 8, ///< PORF; never acknowledged by the wake job.
+  VOLTAGE_LOW = 1u << 9 ///< VLF; never acknowledged by the wake job.
+};
+
+/** @brief Result of the one-burst wake-reason decode job. */
+struct WakeReasonReport {
+  uint16_t reasons = 0; ///< WakeReason bits whose flag was set.
+  uint16_t interruptEnabled = 0; ///< WakeReason bits whose INT enable was set.
+  uint16_t acknowledged = 0; ///< WakeReason bits cleared by a completed write.
+  StatusFlags statusFlags{}; ///< Status decoded from the same burst.
+  uint8_t statusRaw = 0; ///< Status byte (0x0D).
+  uint8_t tempLsbRaw = 0; ///< TEMP_LSB byte (0x0E), including EEbusy/EEF.
+  bool flagsValid = false; ///< True after the flag burst succeeded.
+  Timestamp eventTimestamp{}; ///< EVI timestamp; decoded only for EVENT.
+  Timestamp tempLowTimestamp{}; ///< TLow timestamp; decoded only for TEMP_LOW.
+  Timestamp tempHighTimestamp{}; ///< THigh timestamp; decoded only for TEMP_HIGH.
+
+  /** @brief True when @p reason is set in `reasons`. */
+  bool has(WakeReason reason) const {
+    return (reasons & static_cast<uint16_t>(reason)) != 0;
+  }
+};
+
+/**
+ * @brief Calendar, hundredths, alarm, timer, Status, and temperature decoded
+ *        from one 0x00..0x0F burst.
+ * @note Each field is validated independently; a malformed field clears only
+ *       its own `...Valid` flag. Status and temperature have no invalid
+ *       encodings and are valid whenever the burst was read.
+ */
+struct TelemetryFrame {
+  DateTime time{}; ///< Strictly decoded calendar when timeValid is true.
+  uint8_t hundredths = 0; ///< 0..99 when hundredthsValid is true.
+  AlarmConfig alarm{}; ///< Decoded like getAlarmConfig() when alarmValid is true.
+  uint16_t timerTicks = 0; ///< 12-bit timer preset when timerValid is true.
+  StatusFlags statusFlags{}; ///< Status decoded from the same burst.
+  uint8_t statusRaw = 0; ///< Status byte (0x0D).
+  uint8_t tempLsbRaw = 0; ///< TEMP_LSB byte (0x0E), including BSF/CLKF/EEbusy/EEF.
+  int16_t temperatureRaw = 0; ///< Signed 12-bit TEMP value in 1/16 degree C units.
+  float temperatureC = 0.0f; ///< Temperature in degrees C.
+  bool timeValid = false; ///< Calendar bytes passed strict BCD/range checks.
+  bool hundredthsValid = false; ///< Hundredths byte is valid BCD.
+  bool alarmValid = false; ///< Alarm bytes decoded without reserved/invalid fields.
+  bool timerValid = false; ///< Timer high nibble reserved bits were clear.
+  bool statusValid = false; ///< Burst succeeded; Status and temperature are current.
 };
 
 /** @brief Evidence from the verified calendar-set and invalid-flag-clear job. */
@@ -290,6 +427,24 @@ struct VerifiedTimeSetReport {
   bool statusAfterValid = false; ///< `statusAfter` was read successfully.
   bool temperatureHighWasSetBeforeClear = false; ///< THF was set immediately before its unavoidable clear.
   bool temperatureLowWasSetBeforeClear = false; ///< TLF was set immediately before its unavoidable clear.
+  bool aligned = false; ///< Job ran in second-boundary alignment mode.
+  bool alignmentErrorValid = false; ///< `alignmentErrorMs` measured a dispatched calendar write.
+  int32_t alignmentErrorMs = 0; ///< Calendar write completion minus the targeted boundary.
+  uint32_t alignmentLatencyMs = 0; ///< Measured transfer latency used as dispatch lead.
+  uint32_t alignmentTargetMs = 0; ///< Host-clock instant of the targeted second boundary.
+};
+
+/**
+ * @brief Millisecond-precise wall-clock reference for an aligned verified set.
+ *
+ * `reference` plus `referenceMillis` was the true time at host instant
+ * `referenceAtMs` (same clock as `Config::nowMs`), for example an NTP or GNSS
+ * fix latched by the application.
+ */
+struct SetTimeAlignment {
+  DateTime reference{}; ///< Whole-second part; `weekday` is user-assigned.
+  uint16_t referenceMillis = 0; ///< Sub-second part, 0..999.
+  uint32_t referenceAtMs = 0; ///< Host monotonic time when the reference held.
 };
 
 /** @brief Typed address selector for persistent configuration inspection. */
@@ -304,12 +459,91 @@ enum class ConfigurationEepromRegister : uint8_t {
 
 static constexpr uint8_t USER_EEPROM_SIZE = 32; ///< Persistent user EEPROM size.
 static constexpr uint8_t USER_EEPROM_JOB_MAX_BYTES = 16; ///< Per-job byte bound.
+static constexpr uint32_t PERSISTENCE_DEBOUNCE_MAX_MS = 60000; ///< Longest write-behind window.
 static constexpr uint32_t READ_TIME_OPERATION_TIMEOUT_MS = 100; ///< Default snapshot deadline.
 static constexpr uint32_t SET_TIME_OPERATION_TIMEOUT_MS = 250; ///< Default verified-set deadline.
+static constexpr uint32_t WAKE_REASON_OPERATION_TIMEOUT_MS = 100; ///< Default wake-decode deadline.
+static constexpr uint32_t TELEMETRY_FRAME_OPERATION_TIMEOUT_MS = 100; ///< Default telemetry-frame deadline.
 static constexpr uint32_t BACKUP_SWITCH_OPERATION_TIMEOUT_MS = 250;
 static constexpr uint32_t BACKUP_SWITCH_OPERATION_TIMEOUT_MAX_MS = 1000;
 /// Reserved post-mutation verification interval; admission also needs margin.
 static constexpr uint32_t MIN_SET_TIME_OPERATION_BUDGET_MS = 125;
+/// Extra deadline granted to an aligned set for waiting on the next boundary.
+static constexpr uint32_t SET_TIME_ALIGNMENT_WINDOW_MS = 1000;
+/// Maximum age of an alignment reference at admission.
+static constexpr uint32_t SET_TIME_ALIGNMENT_REFERENCE_MAX_AGE_MS = 60000;
+/// Dispatch slip tolerated before retargeting the following boundary.
+static constexpr uint32_t SET_TIME_ALIGNMENT_TOLERANCE_MS = 2;
+
+// ===== Published Callback Budgets =====
+// See JOB_CALLBACK_BOUNDS after the driver class for the per-kind totals.
+
+/// Callbacks of the time-snapshot, coherent-temperature and flag-clear jobs.
+static constexpr uint32_t TWO_TRANSFER_JOB_CALLBACK_CAP = 2;
+/// Wake burst plus Status and TEMP_LSB acknowledgements.
+static constexpr uint32_t WAKE_REASON_JOB_CALLBACK_CAP = 3;
+/// Verified set-time callbacks, success or failure.
+static constexpr uint32_t VERIFIED_SET_JOB_CALLBACK_CAP = 5;
+/// EEPROM busy reads before the initial ready wait gives up.
+static constexpr uint16_t EEPROM_READY_CHECK_CAP = 256;
+/// EEPROM busy reads per READ_ONE before the read gives up.
+static constexpr uint16_t EEPROM_READ_CHECK_CAP = 32;
+/// EEPROM busy reads per WRITE_ONE before the write gives up.
+static constexpr uint16_t EEPROM_WRITE_CHECK_CAP = 101;
+/// EEPROM busy reads before failure cleanup restores C0 and Control 1.
+static constexpr uint16_t EEPROM_CLEANUP_CHECK_CAP = 256;
+/// Persistent prefix: Control 1 read, EERD write/verify, one ready check,
+/// C0 read and safe C0 write/verify.
+static constexpr uint32_t PERSISTENT_PREFIX_CALLBACKS = 7;
+/// Two-read proof of one byte: address and sentinel staging, busy check,
+/// READ_ONE, one ready poll and data read, twice.
+static constexpr uint32_t PERSISTENT_READ_PASS_CALLBACKS = 14;
+/// One changed byte: EEF clear/verify, data write/verify, busy check,
+/// WRITE_ONE, one ready poll, then another read pass.
+static constexpr uint32_t PERSISTENT_WRITE_CALLBACKS =
+    7 + PERSISTENT_READ_PASS_CALLBACKS;
+/// C0 and Control 1 restore with readback.
+static constexpr uint32_t PERSISTENT_RESTORE_CALLBACKS = 4;
+/// Generic queue items at C1h..CBh also restore their active mirror byte.
+static constexpr uint32_t PERSISTENT_SELECTED_ACTIVE_CALLBACKS = 2;
+/// Staged configuration cleanup: safe-gate read, write and readback.
+static constexpr uint32_t CONFIGURATION_CLEANUP_CALLBACKS = 3;
+/// Callbacks a persistent job may spend after cancelJob(). A primary-cell
+/// job may add its pending EERD readback and an active-C0 read.
+static constexpr uint32_t PERSISTENT_CANCEL_CALLBACKS =
+    EEPROM_CLEANUP_CHECK_CAP + PERSISTENT_RESTORE_CALLBACKS + 2U;
+/// pollJob() clock reads that do not depend on the callbacks it makes.
+static constexpr uint32_t POLL_NOW_MS_CALLS_BASE = 2;
+/// pollJob() clock reads per transport callback.
+static constexpr uint32_t POLL_NOW_MS_CALLS_PER_CALLBACK = 4;
+/// Same, with Config::reuseTransferTimestamps.
+static constexpr uint32_t POLL_NOW_MS_CALLS_PER_CALLBACK_REUSED = 2;
+
+/** @brief Success-path callbacks of a persistent job over `bytes` bytes. */
+constexpr uint32_t persistentSuccessCallbacks(uint32_t bytes,
+                                              uint32_t changedBytes) {
+  return PERSISTENT_PREFIX_CALLBACKS +
+         bytes * PERSISTENT_READ_PASS_CALLBACKS +
+         changedBytes * PERSISTENT_WRITE_CALLBACKS +
+         PERSISTENT_RESTORE_CALLBACKS;
+}
+
+/**
+ * @brief Worst-case callbacks of a persistent job over `bytes` bytes
+ *
+ * Every busy wait runs to its check cap, every writable byte needs WRITE_ONE,
+ * and a failure swaps the restore for the capped cleanup wait.
+ */
+constexpr uint32_t persistentWorstCaseCallbacks(uint32_t bytes,
+                                                uint32_t writableBytes) {
+  return (PERSISTENT_PREFIX_CALLBACKS - 1U + EEPROM_READY_CHECK_CAP) +
+         (bytes + writableBytes) * (PERSISTENT_READ_PASS_CALLBACKS - 2U +
+                                    2U * EEPROM_READ_CHECK_CAP) +
+         writableBytes * (PERSISTENT_WRITE_CALLBACKS - 1U -
+                          PERSISTENT_READ_PASS_CALLBACKS +
+                          EEPROM_WRITE_CHECK_CAP) +
+         EEPROM_CLEANUP_CHECK_CAP + PERSISTENT_RESTORE_CALLBACKS;
+}
 
 /** @brief Verified terminal hardware state for a staged configuration job. */
 enum class ConfigurationFinalState : uint8_t {
@@ -343,6 +577,7 @@ struct PersistentReadResult {
   Status cleanupStatus = Status::Ok(); ///< First access-state cleanup failure.
   bool persistentVerified = false; ///< True when every requested byte was proven, even if cleanup later failed.
   bool cleanupVerified = false; ///< True when access-state cleanup was proven.
+  bool fromCache = false; ///< Served from Config::cachePersistentReads with zero I/O.
 };
 
 /** @brief Partial-progress and cleanup evidence for a user EEPROM write job. */
@@ -420,6 +655,8 @@ struct SettingsSnapshot {
   uint32_t eepromWriteCount = 0;               ///< Successful generic queue items since begin()
   uint32_t eepromWriteFailures = 0;            ///< Failed generic queue items since begin()
   uint8_t eepromQueueDepth = 0;                ///< Pending EEPROM queue depth
+  uint32_t persistenceDebounceMs = 0;          ///< Write-behind window, 0 when off
+  uint8_t persistenceStaged = 0;               ///< Registers held by write-behind
   bool jobBusy = false;                        ///< Cooperative job currently active
   bool primaryCellEnsureAttempted = false;     ///< Ensure latch for this lifecycle
   uint32_t lastOkMs = 0;                       ///< Timestamp of last successful operation
@@ -436,6 +673,21 @@ struct EepromHardwareFlags {
   bool writeFailed = false;  ///< Sticky EEF: a prior EEPROM write failed.
 };
 
+/**
+ * @struct JobResultView
+ * @brief Borrowed pointer to a completed job result, without copying it
+ *
+ * The pointed-to report lives inside the driver and is overwritten when the
+ * next job is admitted, EEPROM work takes over the job slot, or the driver is
+ * reinitialized. Each of those bumps RV3032::jobGeneration(), so a view is
+ * still current while `generation == rtc.jobGeneration()`.
+ */
+template <typename T>
+struct JobResultView {
+  const T* report = nullptr; ///< Completed result; null until a view succeeds.
+  uint32_t generation = 0;   ///< jobGeneration() when the view was taken.
+};
+
 /**
  * @class RV3032
  * @brief Comprehensive driver for RV-3032-C7 real-time clock module
@@ -533,6 +785,53 @@ class RV3032 {
    */
   const Config& getConfig() const { return _config; }
 
+  /**
+   * @brief Open a read-coalescing batch for back-to-back typed getters
+   *
+   * @return OK, or NOT_INITIALIZED before begin()
+   * @note Inside the batch, synchronous reads of registers that only software
+   *       changes (alarm, Control 1-3, clock-interrupt mask, EVI control, and
+   *       temperature thresholds) are served from the first successful
+   *       transfer. Status, temperature, calendar, timestamp, user RAM, and
+   *       EEPROM-refreshed C0-C5 registers always reach the device. Any write
+   *       callback drops every cached byte. Cache hits perform zero callbacks
+   *       and leave health unchanged. Calling it again restarts the batch.
+   * @warning Only external events (power-on reset, another bus master) can
+   *          change cached registers behind the driver; keep batches to one
+   *          application poll cycle.
+   */
+  Status beginBatch();
+
+  /**
+   * @brief Close the read-coalescing batch and discard cached bytes
+   *
+   * @note Zero callbacks; safe to call when no batch is open.
+   */
+  void endBatch();
+
+  /**
+   * @brief Forget proven PORF/VLF validity for snapshot jobs
+   *
+   * The next startReadTimeSnapshotJob() is status-first again.
+   * @note Zero callbacks; call from INT or power-event handlers when
+   *       Config::snapshotValidityMaxAgeMs is non-zero.
+   */
+  void invalidateValidityCache();
+
+  /**
+   * @brief Forget every cached persistent byte
+   *
+   * @note Zero callbacks. The driver already drops bytes on its own
+   *       WRITE_ONE, observed PORF/VLF, and end(); call this when other
+   *       firmware may have written EEPROM.
+   */
+  void invalidatePersistentCache();
+
+  /** @brief Persistent reads served from the cache since begin(). */
+  uint32_t persistentCacheHits() const { return _persistentCache.hits; }
+  /** @brief Cache-enabled persistent reads that needed device I/O. */
+  uint32_t persistentCacheMisses() const { return _persistentCache.misses; }
+
   // ===== Driver State and Health =====
 
   /**
@@ -637,8 +936,8 @@ class RV3032 {
   /**
    * @brief Get status of the current or last generic persistence batch.
    * 
-   * @return IN_PROGRESS while generic work is active; otherwise semantic
-   *         EEPROM_CLEANUP_FAILED when cleanup failed, the first forward item
+   * @return IN_PROGRESS while generic work is active or write-behind values
+   *         are staged; otherwise semantic EEPROM_CLEANUP_FAILED when cleanup failed, the first forward item
    *         error, or OK. Cleanup has terminal precedence.
    * @note An ordinary item failure is returned at that item boundary and later
    *       queued items remain available for a subsequent poll. Starting a new
@@ -669,6 +968,26 @@ class RV3032 {
    */
   uint8_t eepromQueueDepth() const { return _eeprom.queueCount; }
 
+  /**
+   * @brief Get the number of registers held by write-behind persistence.
+   * @return Staged configuration registers not yet released to the queue.
+   * @note Staged values do not make isEepromBusy() true, so other work stays
+   *       admissible; tick()/pollEeprom() report IN_PROGRESS until they are
+   *       released and written.
+   */
+  uint8_t persistenceStagedCount() const { return _eeprom.writeBehindCount; }
+
+  /**
+   * @brief Release every staged write-behind value to the EEPROM queue now.
+   *
+   * Performs zero I2C; tick()/pollEeprom() then write the released items.
+   *
+   * @return IN_PROGRESS when queue work remains, the EEPROM terminal status
+   *         when nothing was staged or queued, QUEUE_FULL when some values
+   *         stay staged for lack of queue room, or NOT_INITIALIZED.
+   */
+  Status flushPersistence();
+
   /**
    * @brief Advance generic configuration persistence with an instruction budget.
    *
@@ -708,6 +1027,111 @@ class RV3032 {
    */
   Status getJobStatus() const;
 
+  /** @brief Cooperative job families, as reported by jobResultReady(). */
+  enum class JobKind : uint8_t {
+    NONE,
+    SET_TIMER,
+    SET_PERIODIC_UPDATE,
+    SET_BACKUP_SWITCH_MODE,
+    SET_CLKOUT_CONFIG,
+    SET_TEMPERATURE_EVENT_CONFIG,
+    REGISTER_UPDATE,
+    TEMP_LSB_FLAG_CLEAR,
+    WRITE_USER_RAM,
+    READ_COHERENT_TEMPERATURE,
+    READ_TIME_SNAPSHOT,
+    READ_WAKE_REASON,
+    SET_TIME_VERIFIED,
+    PERSISTENT_READ,
+    USER_EEPROM_WRITE,
+    ENSURE_PRIMARY_CELL,
+    READ_TELEMETRY_FRAME
+  };
+
+  /**
+   * @brief Counter bumped whenever the job slot is reset for new work.
+   * @note Compare with JobResultView::generation to detect a stale view.
+   */
+  uint32_t jobGeneration() const { return _jobGeneration; }
+
+  /**
+   * @brief Check whether a result of @p kind can be read, without copying it
+   * @return true when the last finished job was @p kind and no other job has
+   *         been admitted since; NONE is never ready.
+   */
+  bool jobResultReady(JobKind kind) const;
+
+  /**
+   * @brief Borrow the completed result of the job matching the view type
+   *
+   * Same status contract as the matching get...JobResult() call, but `out`
+   * receives a pointer into driver storage instead of a copy. A
+   * ConfigurationJobReport view matches any of the five configuration jobs;
+   * use jobResultReady() to tell them apart.
+   *
+   * @return IN_PROGRESS or JOB_RESULT_UNAVAILABLE without changing `out`;
+   *         otherwise the exact terminal job Status.
+   */
+  Status viewJobResult(JobResultView<ConfigurationJobReport>& out) const;
+  Status viewJobResult(JobResultView<TimeSnapshot>& out) const;
+  Status viewJobResult(JobResultView<WakeReasonReport>& out) const;
+  Status viewJobResult(JobResultView<TelemetryFrame>& out) const;
+  Status viewJobResult(JobResultView<VerifiedTimeSetReport>& out) const;
+  Status viewJobResult(JobResultView<PersistentReadResult>& out) const;
+  Status viewJobResult(JobResultView<UserEepromWriteReport>& out) const;
+  Status viewJobResult(JobResultView<PrimaryCellConfigurationReport>& out) const;
+  Status viewJobResult(JobResultView<CoherentTemperatureResult>& out) const;
+
+  /**
+   * @brief Job parameters for planJob()
+   * @note Fields a kind does not use are ignored. The success path assumes a
+   *       responsive device with no pending wake flags and an idle EEPROM.
+   */
+  struct JobRequest {
+    JobKind kind = JobKind::NONE;
+    /// Bytes for WRITE_USER_RAM (1-16), PERSISTENT_READ and
+    /// USER_EEPROM_WRITE (1-USER_EEPROM_JOB_MAX_BYTES).
+    uint8_t length = 0;
+    /// USER_EEPROM_WRITE bytes whose persistent value differs from the
+    /// request; 0 or 1 for ENSURE_PRIMARY_CELL.
+    uint8_t changedBytes = 0;
+    /// SET_BACKUP_SWITCH_MODE target.
+    BackupSwitchMode backupMode = BackupSwitchMode::Off;
+    /// SET_BACKUP_SWITCH_MODE mode the device is in before the job.
+    BackupSwitchMode backupCurrentMode = BackupSwitchMode::Off;
+    /// READ_WAKE_REASON acknowledge argument.
+    bool acknowledgeWake = false;
+    /// READ_TIME_SNAPSHOT starts inside Config::snapshotValidityMaxAgeMs of
+    /// proven validity, so the fused read runs without the status read.
+    bool validityCached = false;
+    /// Persistent kinds: active PMU already has backup switchover and
+    /// trickle charging off, so no safe-C0 write is needed.
+    bool activePmuSafe = false;
+  };
+
+  /** @brief Expected cost of one job, as returned by planJob(). */
+  struct JobPlan {
+    uint32_t successCallbacks = 0;   ///< Transport callbacks on the success path.
+    uint32_t worstCaseCallbacks = 0; ///< Upper bound for any outcome.
+    uint32_t minimumDurationMs = 0;  ///< Settle waits the job cannot skip.
+  };
+
+  /**
+   * @brief Predict the callback count and settle time of a job
+   *
+   * Zero I/O and usable before begin(). Plans follow the start...Job() entry
+   * point of each kind; REGISTER_UPDATE plans startRegisterUpdateJob() and
+   * TEMP_LSB_FLAG_CLEAR a clear whose flag is set. READ_TIME_SNAPSHOT plans
+   * two callbacks, or one with JobRequest::validityCached.
+   *
+   * @return OK, or INVALID_PARAM without changing `out` for NONE or an
+   *         out-of-range length or changed-byte count.
+   * @note Persistent worst cases let every busy poll run to its check cap
+   *       and then add a full failure cleanup; the job deadline normally
+   *       ends the job well before that bound.
+   */
+  static Status planJob(const JobRequest& request, JobPlan& out);
+
   /**
    * @brief Copy the completed timer configuration report.
    * @return IN_PROGRESS or JOB_RESULT_UNAVAILABLE without changing `out`;
@@ -801,13 +1225,36 @@ class RV3032 {
    */
   Status pollJob(uint32_t now_ms, uint8_t maxInstructions, uint8_t& instructionsUsed);
 
+  /**
+   * @brief Cancel the active explicit job, skipping its remaining forward steps.
+   *
+   * Performs zero I2C. A job that has not mutated the device, or that has no
+   * cleanup path (reads, user RAM, wake, telemetry, verified set), ends at
+   * once with JOB_CANCELLED. A staged configuration job that already mutated
+   * moves to its cleanup states, and a persistent job that changed access
+   * state moves to its C0/Control 1 restore, so later pollJob() calls spend
+   * at most CONFIGURATION_CLEANUP_CALLBACKS or PERSISTENT_CANCEL_CALLBACKS
+   * callbacks before the report holds the proven final state.
+   *
+   * @return JOB_CANCELLED (or a failure already latched) when the job ended,
+   *         IN_PROGRESS while cleanup remains for pollJob(), the last terminal
+   *         status when no job is active, BUSY while the EEPROM queue owns the
+   *         engine, or NOT_INITIALIZED before begin().
+   * @note The job's hard deadline still applies to the cleanup. Cancelling a
+   *       job that is already cleaning up only latches JOB_CANCELLED if no
+   *       earlier failure was recorded.
+   */
+  Status cancelJob();
+
   /**
    * @brief Start a status-first calendar snapshot job.
    *
    * Admission performs zero I2C and stores a wrap-safe operation deadline.
    * Each pollJob() instruction invokes at most one transport callback. Typed
    * PORF or VLF evidence from that Status read short-circuits the job with
-   * `timeValid=false`.
+   * `timeValid=false`. While Config::snapshotValidityMaxAgeMs holds an
+   * unexpired status-first proof, the job instead reads calendar and Status in
+   * one burst and reports `cachedValidity=true`.
    *
    * @param nowMs Current application monotonic time.
    * @param operationTimeoutMs Whole-operation timeout through `1000` ms. The
@@ -828,6 +1275,58 @@ class RV3032 {
    */
   Status getReadTimeSnapshotJobResult(TimeSnapshot& out) const;
 
+  /**
+   * @brief Start a wake-reason decode job for fast resume.
+   *
+   * The first instruction reads Status through the EVI timestamp block
+   * (0x0D-0x2D) in one callback and decodes every wake flag, its interrupt
+   * enable, and the timestamps of flagged EVI/TLow/THigh sources. With
+   * `acknowledge`, one Status write clears the observed AF/TF/UF/EVF/THF/TLF
+   * and one TEMP_LSB write clears observed BSF/CLKF. PORF, VLF, EEF, and the
+   * other flags that assert after the read are preserved. Admission performs
+   * zero I2C.
+   *
+   * @param acknowledge Clear the observed wake flags after decoding.
+   * @param nowMs Current application monotonic time.
+   * @param operationTimeoutMs Whole-operation timeout through `1000` ms,
+   *        derived like startReadTimeSnapshotJob() for up to three callbacks.
+   * @return IN_PROGRESS when admitted, or a zero-I/O validation/admission error.
+   * @note BSF/CLKF acknowledgement returns BUSY, after the Status write, while
+   *       hardware EEbusy is set.
+   * @warning Any Status-register write clears THF and TLF in silicon. A
+   *          THF/TLF that asserts between the burst read and the
+   *          acknowledge write is cleared unobserved and cannot be
+   *          preserved. Without `acknowledge` no Status write is made.
+   */
+  Status startReadWakeReasonJob(
+      bool acknowledge, uint32_t nowMs,
+      uint32_t operationTimeoutMs = WAKE_REASON_OPERATION_TIMEOUT_MS);
+  /**
+   * @brief Copy the completed wake-reason report.
+   * @return Same result contract as getReadTimeSnapshotJobResult().
+   */
+  Status getReadWakeReasonJobResult(WakeReasonReport& out) const;
+
+  /**
+   * @brief Start a one-callback telemetry frame read.
+   *
+   * The single instruction reads 0x00..0x0F and decodes it exactly like
+   * readTelemetryFrame(). Admission performs zero I2C.
+   *
+   * @param nowMs Current application monotonic time.
+   * @param operationTimeoutMs Whole-operation timeout through `1000` ms,
+   *        derived like startReadTimeSnapshotJob() for one callback.
+   * @return IN_PROGRESS when admitted, or a zero-I/O validation/admission error.
+   */
+  Status startReadTelemetryFrameJob(
+      uint32_t nowMs,
+      uint32_t operationTimeoutMs = TELEMETRY_FRAME_OPERATION_TIMEOUT_MS);
+  /**
+   * @brief Copy the completed telemetry frame.
+   * @return Same result contract as getReadTimeSnapshotJobResult().
+   */
+  Status getReadTelemetryFrameJobResult(TelemetryFrame& out) const;
+
   /**
    * @brief Start a verified calendar set followed by the named PORF/VLF clear.
    *
@@ -843,7 +1342,7 @@ class RV3032 {
    * @param nowMs Current application monotonic time.
    * @param operationTimeoutMs Whole-operation timeout through `1000` ms. The
    *        minimum is 127 ms with a clock hook. Without one it is derived from
-   *        the seven callback bounds and the shared mutation cutoff so every
+   *        the five callback bounds and the shared mutation cutoff so every
    *        admitted job can dispatch both forward writes.
    * @return IN_PROGRESS when admitted, or a zero-I/O validation/admission error.
    */
@@ -851,6 +1350,36 @@ class RV3032 {
       const DateTime& value,
       uint32_t nowMs,
       uint32_t operationTimeoutMs = SET_TIME_OPERATION_TIMEOUT_MS);
+  /** @brief Same job for an already validated value; skips isValidDateTime(). */
+  Status startSetTimeAndClearInvalidFlagsVerifiedJob(
+      const ValidDateTime& value,
+      uint32_t nowMs,
+      uint32_t operationTimeoutMs = SET_TIME_OPERATION_TIMEOUT_MS);
+  /**
+   * @brief Start the verified set with the calendar write aligned to a second.
+   *
+   * Writing Seconds resets the prescaler, so the write is scheduled to complete
+   * on the next whole second of @p alignment. The pre-mutation Status read is
+   * timed and its duration used as dispatch lead; pollJob() returns
+   * IN_PROGRESS with zero callbacks until the lead point. If a poll arrives
+   * more than SET_TIME_ALIGNMENT_TOLERANCE_MS late, the following boundary is
+   * targeted while it still fits before the mutation cutoff; otherwise the
+   * write is dispatched late. The written calendar is the reference advanced to the
+   * boundary, so `report.requested` holds the actually written value and the
+   * achieved error is reported in `alignmentErrorMs`. Precision is bounded by
+   * the `Config::nowMs` resolution and by poll frequency.
+   *
+   * @param alignment Reference time; at most 60 s old at admission.
+   * @param nowMs Current application monotonic time.
+   * @param operationTimeoutMs As for the unaligned overload; the job deadline
+   *        additionally includes SET_TIME_ALIGNMENT_WINDOW_MS.
+   * @return IN_PROGRESS when admitted, INVALID_CONFIG without a clock hook,
+   *         or a zero-I/O validation/admission error.
+   */
+  Status startSetTimeAndClearInvalidFlagsVerifiedJob(
+      const SetTimeAlignment& alignment,
+      uint32_t nowMs,
+      uint32_t operationTimeoutMs = SET_TIME_OPERATION_TIMEOUT_MS);
   /**
    * @brief Copy the completed verified calendar-set result and mutation evidence.
    * @return IN_PROGRESS while this job is active, JOB_RESULT_UNAVAILABLE before
@@ -945,6 +1474,9 @@ class RV3032 {
    */
   Status readTime(DateTime& out);
 
+  /** @brief readTime() whose result is usable by the ValidDateTime overloads. */
+  Status readTime(ValidDateTime& out);
+
   /**
    * @brief Read the current hundredths-of-a-second counter.
    * @param[out] hundredths Strictly decoded BCD value in the range 0..99.
@@ -954,6 +1486,17 @@ class RV3032 {
    */
   Status readHundredths(uint8_t& hundredths);
 
+  /**
+   * @brief Read calendar, hundredths, alarm, timer, Status, and temperature
+   *        in one 0x00..0x0F burst.
+   * @param[out] out Frame with per-field validity; see TelemetryFrame.
+   * @return OK when the burst was read, even if individual fields failed
+   *         validation, or the transport error with `out` unchanged.
+   * @note Replaces readTime(), readHundredths(), readStatusFlags(), and
+   *       readTemperatureC() with one coherent transfer. Flags are not cleared.
+   */
+  Status readTelemetryFrame(TelemetryFrame& out);
+
   /**
    * @brief Set RTC time and date in one calendar burst.
    * 
@@ -968,6 +1511,9 @@ class RV3032 {
    */
   Status setTime(const DateTime& time);
 
+  /** @brief setTime() for an already validated value; skips isValidDateTime(). */
+  Status setTime(const ValidDateTime& time);
+
   /**
    * @brief Read current time as Unix timestamp
    * 
@@ -1004,6 +1550,12 @@ class RV3032 {
    */
   Status setAlarmTime(uint8_t minute, uint8_t hour, uint8_t date);
 
+  /**
+   * @brief setAlarmTime() from the minute, hour, and day of a validated value
+   * @note Same job and AIE=0 requirement; the range check is skipped.
+   */
+  Status setAlarmTime(const ValidDateTime& time);
+
   /**
    * @brief Configure which alarm components are matched
    * 
@@ -1099,6 +1651,23 @@ class RV3032 {
    */
   Status getTimer(uint16_t& ticks, TimerFrequency& freq, bool& enabled);
 
+  /**
+   * @brief Estimate time to the next timer event in one transfer
+   *
+   * @param nowMs Current monotonic time in milliseconds
+   * @param anchorMs Time the timer was enabled (for example the setTimer()
+   *                 job completion), or any earlier observed TF edge
+   * @param[out] out Preset, source, TE, TF, and derived remaining time
+   * @return Status::Ok() on success, error otherwise
+   * @note Reads Timer Low through Control 1 in one burst, so TF and TE come
+   *       from the same transfer as the preset. The device does not expose the
+   *       live countdown; remaining time is the exact auto-reload phase of
+   *       nowMs - anchorMs. The first period after enable may be up to one
+   *       tick short (uncertaintyMs) because the timer clock is free-running.
+   */
+  Status readTimerRemaining(uint32_t nowMs, uint32_t anchorMs,
+                            TimerRemaining& out);
+
   /** @brief Cooperatively set the active-only timer-interrupt enable bit. */
   Status setTimerInterruptEnabled(bool enabled);
   /** @brief Read the timer-interrupt enable bit in one transfer. */
@@ -1225,6 +1794,38 @@ class RV3032 {
   ///          lifecycle succeeds.
   Status ensurePrimaryCellConfiguration(
       PrimaryCellConfigurationReport& report);
+  /**
+   * @brief Start primary-cell provisioning as a cooperative pollJob() job.
+   *
+   * Runs the same proof sequence as ensurePrimaryCellConfiguration() through
+   * the persistent job state machine: EERD and safe active C0 are prepared,
+   * persistent C0 is proven by two READ_ONE reads, at most one WRITE_ONE is
+   * dispatched, and the result is directly re-proven before cleanup. EEPROM
+   * ready waits return IN_PROGRESS with zero callbacks instead of calling
+   * waitMs, so boot work can be interleaved.
+   *
+   * @param nowMs Current monotonic time.
+   * @param operationTimeoutMs Whole-operation timeout in the derived minimum
+   *       through `10000` ms.
+   * @return IN_PROGRESS when admitted, or a zero-I/O validation/admission error.
+   * @note Requires Config::nowMs and shares the once-per-lifecycle latch with
+   *       ensurePrimaryCellConfiguration(); admission consumes it, rejected
+   *       admission does not. Independent of enableEepromWrites. The transport
+   *       and supply warnings of ensurePrimaryCellConfiguration() apply for the
+   *       whole job.
+   */
+  Status startEnsurePrimaryCellConfigurationJob(
+      uint32_t nowMs,
+      uint32_t operationTimeoutMs = 1000);
+  /**
+   * @brief Copy the completed cooperative primary-cell report.
+   * @return IN_PROGRESS while this job is active, JOB_RESULT_UNAVAILABLE
+   *         before a matching completion or after another job, otherwise the
+   *         exact terminal job status.
+   * @note Performs zero I2C and leaves `out` unchanged when unavailable.
+   */
+  Status getEnsurePrimaryCellConfigurationJobResult(
+      PrimaryCellConfigurationReport& out) const;
 
   // ===== Clock Output Operations =====
 
@@ -1328,8 +1929,11 @@ class RV3032 {
   /**
    * @brief Set frequency offset in parts-per-million
    * 
-   * @param ppm Signed measured frequency error in ppm, quantized to the nearest
-   *            0.238418579 ppm step (range -7.6293945 to +7.3909760 ppm).
+   * @param ppm Signed measured frequency error in ppm (range -7.629 to
+   *            +7.391 ppm), rounded to the nearest 0.238418579 ppm step with
+   *            lrintf() (exact half steps go to the even step). That step's
+   *            nearest ppb is forwarded to setOffsetPpb(), which writes the
+   *            same step.
    * @return IN_PROGRESS when the active update is admitted. pollJob() returns
    *         its terminal result and may then queue generic persistence.
    * @note Follow the vendor calibration convention: pass the signed measured
@@ -1341,6 +1945,16 @@ class RV3032 {
    */
   Status setOffsetPpm(float ppm);
 
+  /**
+   * @brief Set frequency offset in integer parts-per-billion
+   *
+   * @param ppb Signed measured frequency error in ppb (-7629 to +7391),
+   *            quantized to the nearest 1953125/8192 ppb step with integer
+   *            arithmetic only.
+   * @return Same contract as setOffsetPpm().
+   */
+  Status setOffsetPpb(int32_t ppb);
+
   /**
    * @brief Read frequency offset in parts-per-million
    * 
@@ -1349,6 +1963,14 @@ class RV3032 {
    */
   Status getOffsetPpm(float& ppm);
 
+  /**
+   * @brief Read frequency offset in integer parts-per-billion
+   *
+   * @param[out] ppb Current offset rounded to the nearest ppb.
+   * @return Status::Ok() on success, error otherwise.
+   */
+  Status getOffsetPpb(int32_t& ppb);
+
   /**
    * @brief Cooperatively set the Power-On-Reset interrupt enable (PORIE).
    * @note When Config::enableEepromWrites is true, this queues a wear-limited
@@ -1370,6 +1992,13 @@ class RV3032 {
   /** @brief Read the active Voltage-Low interrupt enable (VLIE). */
   Status getVoltageLowInterruptEnabled(bool& enabled);
 
+  /** @brief Nominal offset step in ppb, as the exact ratio 1953125/8192. */
+  static constexpr int32_t OFFSET_STEP_PPB_NUM = 1953125;
+  static constexpr int32_t OFFSET_STEP_PPB_DEN = 8192;
+  /** @brief Inclusive setOffsetPpb() range: -32 and +31 steps rounded to ppb. */
+  static constexpr int32_t OFFSET_PPB_MIN = -7629;
+  static constexpr int32_t OFFSET_PPB_MAX = 7391;
+
   // ===== Temperature Sensor =====
 
   /**
@@ -1384,6 +2013,15 @@ class RV3032 {
    */
   Status readTemperatureC(float& celsius);
 
+  /**
+   * @brief Read die temperature without floating point
+   *
+   * @param[out] sixteenths Signed 12-bit TEMP value in 1/16 degree C units.
+   * @return Status::Ok() on success, error otherwise.
+   * @note readTemperatureC() is this value divided by 16 and is exact.
+   */
+  Status readTemperatureSixteenths(int16_t& sixteenths);
+
   /**
    * @brief Cooperatively set temperature thresholds/events/interrupts.
    * @note TLT and THT are independent signed-byte comparators; either ordering
@@ -1746,6 +2384,13 @@ class RV3032 {
    */
   static bool isValidDateTime(const DateTime& time);
 
+  /**
+   * @brief Validate once and keep the result as a ValidDateTime
+   * @return OK, or INVALID_DATETIME without changing out when
+   *         isValidDateTime() rejects time.
+   */
+  static Status makeValidDateTime(const DateTime& time, ValidDateTime& out);
+
   /**
    * @brief Compute day of week from date
    * 
@@ -1768,6 +2413,55 @@ class RV3032 {
    */
   static Status parseBuildTime(DateTime& out);
 
+  /// @brief formatIso8601() buffer size with hundredths, including the NUL.
+  static constexpr size_t ISO8601_BUFFER_SIZE = 24;
+  /// @brief Hundredths value that omits the fraction when formatting and
+  ///        reports its absence when parsing.
+  static constexpr uint8_t ISO8601_NO_HUNDREDTHS = 0xFF;
+
+  /**
+   * @brief Format DateTime as fixed-width RFC 3339 UTC text
+   *
+   * Writes `YYYY-MM-DDTHH:MM:SS.hhZ`, or `YYYY-MM-DDTHH:MM:SSZ` when
+   * hundredths is ISO8601_NO_HUNDREDTHS, through a digit-pair table with no
+   * locale, heap, or printf.
+   *
+   * @param time Date/time accepted by isValidDateTime(); weekday is not printed
+   * @param hundredths 0-99, or ISO8601_NO_HUNDREDTHS
+   * @param[out] out Buffer of at least ISO8601_BUFFER_SIZE bytes
+   * @param size Size of out in bytes
+   * @return OK, INVALID_DATETIME for an invalid time, or INVALID_PARAM for a
+   *         bad hundredths value or buffer; out is unchanged on failure.
+   */
+  static Status formatIso8601(const DateTime& time, uint8_t hundredths,
+                              char* out, size_t size);
+
+  /** @brief Array overload; the buffer size is checked at compile time. */
+  template <size_t N>
+  static Status formatIso8601(const DateTime& time, uint8_t hundredths,
+                              char (&out)[N]) {
+    static_assert(N >= ISO8601_BUFFER_SIZE,
+                  "ISO-8601 buffer needs ISO8601_BUFFER_SIZE bytes");
+    return formatIso8601(time, hundredths, out, N);
+  }
+
+  /**
+   * @brief Strictly parse the text formatIso8601() produces
+   *
+   * Accepts exactly `YYYY-MM-DDTHH:MM:SSZ` or `YYYY-MM-DDTHH:MM:SS.hhZ`
+   * followed by the NUL terminator. Separators, `T`, and `Z` are uppercase and
+   * mandatory; offsets other than `Z`, other fraction lengths, and leading or
+   * trailing characters are rejected.
+   *
+   * @param text NUL-terminated input
+   * @param[out] out Parsed date/time with its weekday derived from the date
+   * @param[out] hundredths Optional; receives 0-99 or ISO8601_NO_HUNDREDTHS
+   * @return OK, INVALID_PARAM for null text, or INVALID_DATETIME for malformed
+   *         or out-of-range text; outputs are unchanged on failure.
+   */
+  static Status parseIso8601(const char* text, DateTime& out,
+                             uint8_t* hundredths = nullptr);
+
   /**
    * @brief Convert Unix timestamp to DateTime
    * 
@@ -1779,6 +2473,9 @@ class RV3032 {
    */
   static Status unixToDateTime(uint32_t timestamp, DateTime& out);
 
+  /** @brief unixToDateTime() producing a ValidDateTime; same contract. */
+  static Status unixToDateTime(uint32_t timestamp, ValidDateTime& out);
+
   /**
    * @brief Convert DateTime to Unix timestamp
    * 
@@ -1790,6 +2487,81 @@ class RV3032 {
    */
   static Status dateTimeToUnix(const DateTime& time, uint32_t& timestamp);
 
+  /** @brief Unix seconds of a validated value; cannot fail. */
+  static uint32_t dateTimeToUnix(const ValidDateTime& time);
+
+  /**
+   * @brief Pack a DateTime into a sortable 32-bit key
+   * @return OK, or INVALID_DATETIME without changing out when
+   *         isValidDateTime() rejects time.
+   */
+  static Status packDateTime(const DateTime& time, PackedDateTime& out);
+
+  /** @brief Packed key of a validated value; cannot fail. */
+  static PackedDateTime packDateTime(const ValidDateTime& time);
+
+  /**
+   * @brief Pack the raw seven-byte calendar burst read from 0x01..0x07
+   *
+   * @param calendar Seconds, minutes, hours, weekday, date, month, year in
+   *        device BCD, as returned by readRegisters(cmd::REG_SECONDS, buf, 7)
+   * @param[out] out Packed key
+   * @return OK, or INVALID_DATETIME without changing out for reserved bits,
+   *         invalid BCD, or an invalid date, matching readTime() validation.
+   */
+  static Status packCalendarBcd(const uint8_t (&calendar)[7],
+                                PackedDateTime& out);
+
+  /**
+   * @brief Unpack a key produced by packDateTime() or packCalendarBcd()
+   * @param[out] out Date/time with its weekday derived from the date
+   * @return OK, or INVALID_DATETIME without changing out for a value no valid
+   *         date/time packs to.
+   */
+  static Status unpackDateTime(PackedDateTime packed, DateTime& out);
+
+  /** @brief Convert a packed key to Unix seconds; same contract as unpackDateTime(). */
+  static Status packedToUnix(PackedDateTime packed, uint32_t& timestamp);
+
+  /**
+   * @brief Look up a zone's UTC offset at a Unix timestamp
+   *
+   * @param zone Generated table from RV3032/TimeZones.h
+   * @param timestamp Unix timestamp in the 2000..2099 UTC domain
+   * @param[out] offsetMinutes East-positive offset in effect at timestamp
+   * @return OK, INVALID_DATETIME outside the domain, or INVALID_PARAM for a
+   *         malformed table; offsetMinutes is unchanged on failure.
+   * @note O(log n) binary search; no heap or string parsing.
+   */
+  static Status utcOffsetMinutes(const TimeZone& zone, uint32_t timestamp,
+                                 int16_t& offsetMinutes);
+
+  /**
+   * @brief Convert a UTC DateTime, such as unixToDateTime() output, to local time
+   *
+   * @param zone Generated table from RV3032/TimeZones.h
+   * @param utc Valid UTC date/time
+   * @param[out] local Local date/time with its weekday derived from the date
+   * @return OK, or INVALID_DATETIME when either side leaves 2000..2099;
+   *         local is unchanged on failure.
+   */
+  static Status utcToLocal(const TimeZone& zone, const DateTime& utc,
+                           DateTime& local);
+
+  /**
+   * @brief Convert a local DateTime to UTC
+   *
+   * @param zone Generated table from RV3032/TimeZones.h
+   * @param local Valid local date/time
+   * @param[out] utc UTC date/time with its weekday derived from the date
+   * @param fold Occurrence to use when a backward transition repeats local
+   * @return OK, or INVALID_DATETIME when local falls in a forward-transition
+   *         gap or either side leaves 2000..2099; utc is unchanged on failure.
+   */
+  static Status localToUtc(const TimeZone& zone, const DateTime& local,
+                           DateTime& utc,
+                           LocalTimeFold fold = LocalTimeFold::EARLIER);
+
  private:
   enum class EepromState : uint8_t {
     IDLE,
@@ -1834,27 +2606,10 @@ class RV3032 {
     SETTLE
   };
 
-  enum class JobKind : uint8_t {
-    NONE,
-    SET_TIMER,
-    SET_PERIODIC_UPDATE,
-    SET_BACKUP_SWITCH_MODE,
-    SET_CLKOUT_CONFIG,
-    SET_TEMPERATURE_EVENT_CONFIG,
-    REGISTER_UPDATE,
-    TEMP_LSB_FLAG_CLEAR,
-    WRITE_USER_RAM,
-    READ_COHERENT_TEMPERATURE,
-    READ_TIME_SNAPSHOT,
-    SET_TIME_VERIFIED,
-    PERSISTENT_READ,
-    USER_EEPROM_WRITE
-  };
 
   enum class JobState : uint8_t {
     IDLE,
-    TIMER_READ_CONTROL2_GUARD,
-    TIMER_READ_CONTROL1,
+    TIMER_READ_CONTROLS,
     TIMER_WRITE_SAFE_CONTROL1,
     TIMER_WRITE_PRESET,
     TIMER_WRITE_FINAL_CONTROL1,
@@ -1908,12 +2663,15 @@ class RV3032 {
     READ_TEMPERATURE_SECOND,
     READ_TIME_STATUS,
     READ_TIME_CALENDAR,
+    READ_TIME_FUSED,
+    WAKE_READ_FLAGS,
+    WAKE_ACK_STATUS,
+    WAKE_ACK_TEMP_LSB,
+    TELEMETRY_READ_FRAME,
     SET_TIME_READ_STATUS_BEFORE,
     SET_TIME_WRITE_CALENDAR,
     SET_TIME_VERIFY_CALENDAR,
-    SET_TIME_READ_STATUS_BEFORE_CLEAR,
     SET_TIME_WRITE_STATUS,
-    SET_TIME_READ_STATUS_AFTER,
     SET_TIME_READ_FINAL_CALENDAR,
     PERSISTENT
   };
@@ -1931,6 +2689,15 @@ class RV3032 {
   static constexpr size_t kEepromQueueSize = 8;  // Fixed-size queue (no heap allocation)
   static constexpr size_t kJobUserRamBufferSize = 16;
 
+  // Write-behind holds at most one value per active register C0..C5.
+  static constexpr size_t kWriteBehindSlots = 6;
+
+  struct WriteBehindSlot {
+    uint8_t value = 0;
+    uint32_t changedMs = 0; // Time the staged value last changed
+    bool pending = false;
+  };
+
   struct EepromOp {
     EepromState state = EepromState::IDLE;
     uint8_t reg = 0;
@@ -1941,17 +2708,50 @@ class RV3032 {
     uint8_t queueHead = 0;  // Next write position
     uint8_t queueTail = 0;  // Next read position
     uint8_t queueCount = 0; // Number of items in queue
+
+    // Debounced values not yet released to the queue
+    WriteBehindSlot writeBehind[kWriteBehindSlots];
+    uint8_t writeBehindCount = 0;
+  };
+
+  // Persistent-engine state, the only part of JobOp a generic EEPROM queue
+  // item touches. resetPersistentEngine() clears just this base between
+  // items instead of reinitializing every job's state and reports.
+  struct PersistentEngineOp {
+    Status persistentOperationStatus = Status::Ok();
+    Status persistentCleanupStatus = Status::Ok();
+    EepromState persistentState = EepromState::IDLE;
+    uint8_t persistentAddress = 0;
+    uint8_t persistentLength = 0;
+    uint8_t persistentIndex = 0;
+    uint8_t persistentSentinel = 0;
+    uint8_t persistentFirstRead = 0;
+    uint8_t persistentControl1 = 0;
+    uint8_t persistentActiveC0 = 0;
+    uint8_t persistentSafeC0 = 0;
+    uint8_t persistentDesired = 0;
+    uint16_t persistentReadyChecks = 0;
+    uint32_t persistentNotBeforeMs = 0;
+    uint32_t persistentPhaseDeadlineMs = 0;
+    bool persistentControl1Valid = false;
+    bool persistentActiveC0Valid = false;
+    bool persistentSafeC0Verified = false;
+    bool persistentWriteMode = false;
+    bool persistentWriteAttempted = false;
+    bool persistentCleanupRequired = false;
+    bool persistentCleanupProofPossible = true;
+    bool persistentCancelRequested = false;
+    PersistentReadResult persistentRead{};
+    UserEepromWriteReport userEepromWrite{};
   };
 
-  struct JobOp {
+  struct JobOp : PersistentEngineOp {
     JobState state = JobState::IDLE;
     JobKind activeKind = JobKind::NONE;
     JobKind completedKind = JobKind::NONE;
     Status lastStatus = Status::Ok();
     ConfigurationJobReport configurationReport{};
     bool configurationCleanupWriteAttempted = false;
-    Status persistentOperationStatus = Status::Ok();
-    Status persistentCleanupStatus = Status::Ok();
     uint32_t deadlineMs = 0;
     uint32_t mutationCutoffMs = 0;
     bool deadlineActive = false;
@@ -1976,6 +2776,7 @@ class RV3032 {
     bool persistRegisterUpdate = false;
     QuiescenceGuard quiescenceGuard{};
     JobState quiescenceNextState = JobState::IDLE;
+    bool quiescencePrefetched = false;
     uint8_t tempLsbClearMask = 0;
     uint8_t registerBlockReg = 0;
     uint8_t registerBlockLen = 0;
@@ -1997,42 +2798,61 @@ class RV3032 {
     uint8_t firstTemperature[2] = {0};
     CoherentTemperatureResult coherentTemperature{};
     TimeSnapshot timeSnapshot{};
+    uint32_t timeSnapshotStartMs = 0;
+    WakeReasonReport wakeReason{};
+    bool wakeAcknowledge = false;
+    TelemetryFrame telemetryFrame{};
+    uint8_t wakeStatusAck = 0;
+    uint8_t wakeTempLsbAck = 0;
     VerifiedTimeSetReport verifiedSet{};
     uint8_t calendarBuf[7] = {0};
-    EepromState persistentState = EepromState::IDLE;
-    uint8_t persistentAddress = 0;
-    uint8_t persistentLength = 0;
-    uint8_t persistentIndex = 0;
-    uint8_t persistentSentinel = 0;
-    uint8_t persistentFirstRead = 0;
-    uint8_t persistentControl1 = 0;
-    uint8_t persistentActiveC0 = 0;
-    uint8_t persistentSafeC0 = 0;
-    uint8_t persistentDesired = 0;
-    uint16_t persistentReadyChecks = 0;
-    uint32_t persistentNotBeforeMs = 0;
-    uint32_t persistentPhaseDeadlineMs = 0;
-    bool persistentControl1Valid = false;
-    bool persistentActiveC0Valid = false;
-    bool persistentSafeC0Verified = false;
-    bool persistentWriteMode = false;
-    bool persistentWriteAttempted = false;
-    bool persistentCleanupRequired = false;
-    bool persistentCleanupProofPossible = true;
-    PersistentReadResult persistentRead{};
-    UserEepromWriteReport userEepromWrite{};
+    SetTimeAlignment alignment{};
+    uint32_t alignmentSeconds = 0;
+    PrimaryCellConfigurationReport primaryCell{};
+    Status primaryCellCommandStatus = Status::Ok();
+    bool primaryCellAccessVerified = false;
+    bool primaryCellTrusted = false;
+    bool primaryCellSafeHeld = false;  ///< Safe C0 read back as active.
   };
 
   Config _config;
   bool _initialized = false;
   EepromOp _eeprom;
   JobOp _job;
+  uint32_t _jobGeneration = 0;
   Status _eepromOperationStatus = Status::Ok();
   Status _eepromCleanupStatus = Status::Ok();
   uint32_t _eepromWriteCount = 0;
   uint32_t _eepromWriteFailures = 0;
   bool _primaryCellEnsureAttempted = false;
 
+  // beginBatch() read cache. Every batch-cacheable address is below 0x20.
+  struct BatchCache {
+    bool active = false;
+    uint32_t validMask = 0;
+    uint8_t values[32] = {};
+  };
+  BatchCache _batch;
+
+  // Latest driver clock reading within one poll; reused as "now" when
+  // Config::reuseTransferTimestamps is set.
+  uint32_t _clockStampMs = 0;
+  bool _clockStampValid = false;
+
+  // Application time of the last status-first snapshot that saw PORF/VLF clear.
+  uint32_t _validityProvenMs = 0;
+  bool _validityProven = false;
+
+  // Config::cachePersistentReads: proven EEPROM bytes 0xC0..0xEA.
+  static constexpr size_t kPersistentCacheSize = 0x2B;
+  struct PersistentCache {
+    uint64_t validMask = 0;
+    uint8_t values[kPersistentCacheSize] = {};
+    uint32_t hits = 0;
+    uint32_t misses = 0;
+  };
+  PersistentCache _persistentCache;
+
   // Driver state and health tracking
   DriverState _driverState = DriverState::UNINIT;
   uint32_t _lastOkMs = 0;              ///< Timestamp of last successful operation
@@ -2104,6 +2924,8 @@ class RV3032 {
   Status validateWriteRegsRequest(
       uint8_t reg, const uint8_t* buf, size_t len) const;
   Status readRegs(uint8_t reg, uint8_t* buf, size_t len);
+  bool batchCacheServes(uint8_t reg, uint8_t* buf, size_t len) const;
+  void batchCacheFill(uint8_t reg, const uint8_t* buf, size_t len);
   Status writeRegs(uint8_t reg, const uint8_t* buf, size_t len);
   
   // Raw register access (no health tracking) - for diagnostics
@@ -2115,6 +2937,12 @@ class RV3032 {
   Status readEepromFlags(bool& busy, bool& failed);
   bool eepromQueueContains(uint8_t reg, uint8_t value) const;
   bool eepromQueuePush(uint8_t reg, uint8_t value);
+  bool queuePersistence(uint8_t reg, uint8_t value, uint32_t nowMs);
+  uint8_t persistenceCapacity() const;
+  void releaseWriteBehind(uint32_t nowMs, bool force);
+  void cachePersistentByte(uint8_t address, uint8_t value);
+  void dropPersistentByte(uint8_t address);
+  void notePowerStatus(uint8_t statusRaw);
   bool eepromQueuePop(uint8_t& reg, uint8_t& value);
   Status processPersistentJob(uint32_t& nowMs, bool& callbackUsed);
   Status startPersistentReadJob(uint8_t address, uint8_t length,
@@ -2122,13 +2950,21 @@ class RV3032 {
   Status getConfigurationJobResult(
       JobKind kind, const char* inProgressMessage,
       const char* unavailableMessage, ConfigurationJobReport& out) const;
-  uint32_t twoTransferJobMinimumTimeoutMs() const;
+  uint32_t transferJobMinimumTimeoutMs(uint32_t callbackCap) const;
   void exposePersistentEvidence();
+  void encodeVerifiedSetCalendar(const DateTime& value);
+  void finalizePrimaryCellReport();
   Status finishJob(const Status& status);
+  void resetJob();
+  void resetPersistentEngine();
+  static bool isConfigurationJobKind(JobKind kind);
+  static JobState configurationRecoveryState(JobKind kind);
   bool workIdle() const;
 
   // Health tracking (called only by tracked transport wrappers)
-  Status _updateHealth(const Status& st);
+  Status _updateHealth(const Status& st, const uint32_t* stampMs = nullptr);
+  bool _clockStampCurrent(uint32_t nowMs) const;
+  void _noteClockStamp(uint32_t nowMs);
   uint32_t _nowMs() const;
   void _resetRuntimeState();
 
@@ -2140,6 +2976,7 @@ class RV3032 {
                            const QuiescenceGuard& quiescenceGuard);
   Status readRegisterBit(uint8_t reg, uint8_t bitMask, bool& value);
   Status startTempLsbFlagClear(uint8_t targetMask);
+  Status applyAlarmTime(uint8_t minute, uint8_t hour, uint8_t date);
   Status updateRegisterBlock(uint8_t reg, uint8_t length,
                              const uint8_t* implementedMasks,
                              const uint8_t* clearMasks,
@@ -2182,7 +3019,15 @@ class RV3032 {
                          bool requireCleanupReserve = false,
                          bool* callbackReturnedLate = nullptr);
   static StatusFlags decodeStatusFlags(uint8_t raw);
+  static Status decodeAlarmConfig(const uint8_t* buf, AlarmConfig& out);
+  /// Decodes the six-byte Timer Low..Control 1 burst; outputs are unchanged
+  /// when Timer High carries reserved bits.
+  static Status decodeTimer(const uint8_t* buf, uint16_t& ticks,
+                            TimerFrequency& freq, bool& enabled);
+  static void decodeTelemetryFrame(const uint8_t* buf, TelemetryFrame& out);
   static bool decodeCalendar(const uint8_t* data, DateTime& out);
+  static Status decodeTimestamp(TimestampSource source, const uint8_t* buf,
+                                size_t len, Timestamp& out);
   static bool acceptedVerifiedTime(const DateTime& requested,
                                    const DateTime& observed);
 
@@ -2194,8 +3039,154 @@ class RV3032 {
   static uint8_t daysInMonth(uint16_t year, uint8_t month);
   static uint32_t dateToDays(uint16_t year, uint8_t month, uint8_t day);
   static bool unixToDate(uint32_t ts, DateTime& out);
+  static uint32_t validDateTimeToUnix(const DateTime& time);
+  static PackedDateTime packValidDateTime(const DateTime& time);
   static uint8_t weekdayFromValidDate(
       uint16_t year, uint8_t month, uint8_t day);
 };
 
+/** @brief Published callback and clock budget of one job kind. */
+struct JobCallbackBound {
+  RV3032::JobKind kind;
+  uint32_t successCallbacks;    ///< Largest success path of any entry point.
+  uint32_t worstCaseCallbacks;  ///< Any outcome, faults and cleanup included.
+  /// Clock reads when each callback gets its own pollJob() call; every poll
+  /// without a callback adds at most POLL_NOW_MS_CALLS_BASE more.
+  uint32_t worstCaseNowMsCalls;
+};
+
+/// @brief Build a bound with the clock reads derived from the callback cap.
+constexpr JobCallbackBound makeJobCallbackBound(RV3032::JobKind kind,
+                                                uint32_t successCallbacks,
+                                                uint32_t worstCaseCallbacks) {
+  return JobCallbackBound{
+      kind, successCallbacks, worstCaseCallbacks,
+      worstCaseCallbacks *
+          (POLL_NOW_MS_CALLS_BASE + POLL_NOW_MS_CALLS_PER_CALLBACK)};
+}
+
+/**
+ * @brief Per-kind budgets, indexed by JobKind
+ *
+ * Persistent kinds are bounded at their largest request: 16 bytes, all of
+ * them changed for USER_EEPROM_WRITE. Use RV3032::planJob() for a specific
+ * request. The job deadline normally ends a faulted persistent job well
+ * before its callback cap.
+ */
+inline constexpr JobCallbackBound JOB_CALLBACK_BOUNDS[] = {
+    makeJobCallbackBound(RV3032::JobKind::NONE, 0, 0),
+    makeJobCallbackBound(RV3032::JobKind::SET_TIMER, 5, 8),
+    makeJobCallbackBound(RV3032::JobKind::SET_PERIODIC_UPDATE, 5, 8),
+    makeJobCallbackBound(RV3032::JobKind::SET_BACKUP_SWITCH_MODE, 4, 4),
+    makeJobCallbackBound(RV3032::JobKind::SET_CLKOUT_CONFIG, 5, 8),
+    makeJobCallbackBound(RV3032::JobKind::SET_TEMPERATURE_EVENT_CONFIG, 7, 10),
+    // Quiescence guard, target read and write; EVI reset writes twice.
+    makeJobCallbackBound(RV3032::JobKind::REGISTER_UPDATE, 3, 3),
+    makeJobCallbackBound(RV3032::JobKind::TEMP_LSB_FLAG_CLEAR,
+                         TWO_TRANSFER_JOB_CALLBACK_CAP,
+                         TWO_TRANSFER_JOB_CALLBACK_CAP),
+    makeJobCallbackBound(RV3032::JobKind::WRITE_USER_RAM, 2, 2),
+    makeJobCallbackBound(RV3032::JobKind::READ_COHERENT_TEMPERATURE,
+                         TWO_TRANSFER_JOB_CALLBACK_CAP,
+                         TWO_TRANSFER_JOB_CALLBACK_CAP),
+    makeJobCallbackBound(RV3032::JobKind::READ_TIME_SNAPSHOT,
+                         TWO_TRANSFER_JOB_CALLBACK_CAP,
+                         TWO_TRANSFER_JOB_CALLBACK_CAP),
+    makeJobCallbackBound(RV3032::JobKind::READ_WAKE_REASON,
+                         WAKE_REASON_JOB_CALLBACK_CAP,
+                         WAKE_REASON_JOB_CALLBACK_CAP),
+    makeJobCallbackBound(RV3032::JobKind::SET_TIME_VERIFIED,
+                         VERIFIED_SET_JOB_CALLBACK_CAP,
+                         VERIFIED_SET_JOB_CALLBACK_CAP),
+    makeJobCallbackBound(
+        RV3032::JobKind::PERSISTENT_READ,
+        persistentSuccessCallbacks(USER_EEPROM_JOB_MAX_BYTES, 0),
+        persistentWorstCaseCallbacks(USER_EEPROM_JOB_MAX_BYTES, 0)),
+    makeJobCallbackBound(
+        RV3032::JobKind::USER_EEPROM_WRITE,
+        persistentSuccessCallbacks(USER_EEPROM_JOB_MAX_BYTES,
+                                   USER_EEPROM_JOB_MAX_BYTES),
+        persistentWorstCaseCallbacks(USER_EEPROM_JOB_MAX_BYTES,
+                                     USER_EEPROM_JOB_MAX_BYTES)),
+    makeJobCallbackBound(RV3032::JobKind::ENSURE_PRIMARY_CELL,
+                         persistentSuccessCallbacks(1, 1),
+                         persistentWorstCaseCallbacks(1, 1)),
+    makeJobCallbackBound(RV3032::JobKind::READ_TELEMETRY_FRAME, 1, 1),
+};
+
+/// @brief Budget of one job kind.
+constexpr const JobCallbackBound& jobCallbackBound(RV3032::JobKind kind) {
+  return JOB_CALLBACK_BOUNDS[static_cast<size_t>(kind)];
+}
+
+static_assert(sizeof(JOB_CALLBACK_BOUNDS) / sizeof(JOB_CALLBACK_BOUNDS[0]) ==
+                  static_cast<size_t>(RV3032::JobKind::READ_TELEMETRY_FRAME) + 1U,
+              "JOB_CALLBACK_BOUNDS must cover every JobKind");
+static_assert(jobCallbackBound(RV3032::JobKind::READ_TELEMETRY_FRAME).kind ==
+                  RV3032::JobKind::READ_TELEMETRY_FRAME,
+              "JOB_CALLBACK_BOUNDS must follow JobKind order");
+
+/**
+ * @brief Published callback and clock budget of one blocking call
+ *
+ * Job kinds are covered by JOB_CALLBACK_BOUNDS. The blocking calls below are
+ * the ones outside pollJob(); every other blocking accessor is one burst
+ * transfer. EEPROM_QUEUE_ITEM_CALL_BOUND covers one tick()/pollEeprom()
+ * queue item.
+ */
+struct CallBound {
+  uint32_t successCallbacks;    ///< Largest success path.
+  uint32_t worstCaseCallbacks;  ///< Any outcome, faults and cleanup included.
+  uint32_t worstCaseNowMsCalls; ///< Clock reads for any outcome.
+};
+
+/// @brief begin() validates the configuration and resets state only.
+inline constexpr CallBound BEGIN_CALL_BOUND = {0, 0, 0};
+/// @brief recover() makes one Status read; health tracking reads the clock.
+inline constexpr CallBound RECOVER_CALL_BOUND = {1, 1, 1};
+
+/// @brief Busy reads of the blocking primary-cell ensure over its ready
+/// phases: initial ready, two READ_ONE proofs, WRITE_ONE, and cleanup.
+static constexpr uint32_t PRIMARY_CELL_ENSURE_READY_POLLS =
+    EEPROM_READY_CHECK_CAP + 2U * EEPROM_READ_CHECK_CAP +
+    EEPROM_WRITE_CHECK_CAP + EEPROM_CLEANUP_CHECK_CAP;
+/// @brief Blocking ensure transfers besides busy reads: access prefix 6,
+/// READ_ONE proof 7 twice, staged WRITE_ONE 9, cleanup 5.
+static constexpr uint32_t PRIMARY_CELL_ENSURE_FIXED_CALLBACKS = 34;
+/// @brief Blocking ensure clock reads outside transfers and busy reads:
+/// operation start, ready-phase starts, command stamps and settle waits.
+static constexpr uint32_t PRIMARY_CELL_ENSURE_FIXED_NOW_MS_CALLS = 24;
+
+/**
+ * @brief Blocking ensurePrimaryCellConfiguration() budget
+ *
+ * The success path stages one WRITE_ONE with one ready read per phase. Each
+ * transfer reads the clock three times (deadline, health, return) and each
+ * busy read four more (phase check and the poll-interval wait). The 1000 ms
+ * operation deadline normally ends a stuck-busy run well before the cap.
+ */
+inline constexpr CallBound PRIMARY_CELL_ENSURE_CALL_BOUND = {
+    38,
+    PRIMARY_CELL_ENSURE_FIXED_CALLBACKS + PRIMARY_CELL_ENSURE_READY_POLLS,
+    3U * (PRIMARY_CELL_ENSURE_FIXED_CALLBACKS +
+          PRIMARY_CELL_ENSURE_READY_POLLS) +
+        4U * PRIMARY_CELL_ENSURE_READY_POLLS +
+        PRIMARY_CELL_ENSURE_FIXED_NOW_MS_CALLS};
+
+/**
+ * @brief One generic persistence queue item run by tick()/pollEeprom()
+ *
+ * Covers setter-queued items and released write-behind values alike: a
+ * one-byte persistent write plus the active-mirror restore of C1h..CBh.
+ * Clock reads assume one callback per pollEeprom() call, as for
+ * JobCallbackBound. The 1000 ms item deadline normally ends a faulted item
+ * well before the cap.
+ */
+inline constexpr CallBound EEPROM_QUEUE_ITEM_CALL_BOUND = {
+    persistentSuccessCallbacks(1, 1) + PERSISTENT_SELECTED_ACTIVE_CALLBACKS,
+    persistentWorstCaseCallbacks(1, 1) + PERSISTENT_SELECTED_ACTIVE_CALLBACKS,
+    (persistentWorstCaseCallbacks(1, 1) +
+     PERSISTENT_SELECTED_ACTIVE_CALLBACKS) *
+        (POLL_NOW_MS_CALLS_BASE + POLL_NOW_MS_CALLS_PER_CALLBACK)};
+
 }  // namespace RV3032
@@ -0,0 +1,469 @@
+/**
+ * @file RegisterMap.h
+ * @brief Generated RV-3032-C7 register map: field accessors and allowlists.
+ *
+ * This file is AUTO-GENERATED by scripts/generate_register_map.py from
+ * scripts/register_map.json. DO NOT EDIT MANUALLY. The static_asserts at the
+ * end pin every overlapping CommandTable.h constant to the same description.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "RV3032/CommandTable.h"
+
+namespace RV3032 {
+
+namespace regmap {
+
+/// @brief One contiguous bit field inside an 8-bit register.
+struct Field {
+  uint8_t mask;
+  uint8_t shift;
+  uint8_t width;
+
+  /// @brief Right-aligned field value extracted from a raw register byte.
+  constexpr uint8_t get(uint8_t raw) const {
+    return static_cast<uint8_t>((raw & mask) >> shift);
+  }
+
+  /// @brief Field value sign-extended from its width (two's complement).
+  constexpr int8_t getSigned(uint8_t raw) const {
+    const int16_t sign = static_cast<int16_t>(1U << (width - 1U));
+    return static_cast<int8_t>((get(raw) ^ sign) - sign);
+  }
+
+  /// @brief True when any bit of the field is set.
+  constexpr bool test(uint8_t raw) const { return (raw & mask) != 0; }
+
+  /// @brief Right-aligned value moved into field position; excess bits drop.
+  constexpr uint8_t encode(uint8_t value) const {
+    return static_cast<uint8_t>((value << shift) & mask);
+  }
+
+  /// @brief Raw byte with this field replaced and every other bit preserved.
+  constexpr uint8_t with(uint8_t raw, uint8_t value) const {
+    return static_cast<uint8_t>((raw & ~mask) | encode(value));
+  }
+};
+
+/// @brief Inclusive address run of contiguously decoded registers.
+struct AddressRun {
+  uint8_t first;
+  uint8_t last;
+};
+
+/// @brief ALARM_MINUTE (0x08, read/write-protectable)
+struct AlarmMinute {
+  static constexpr uint8_t ADDRESS = 0x08;
+  static constexpr uint8_t IMPLEMENTED_MASK = 0xFF;
+  /// 0 enables minute matching
+  static constexpr Field AE_M{0x80, 7, 1};
+  /// BCD minutes
+  static constexpr Field VALUE{0x7F, 0, 7};
+};
+
+/// @brief ALARM_HOUR (0x09, read/write-protectable)
+struct AlarmHour {
+  static constexpr uint8_t ADDRESS = 0x09;
+  static constexpr uint8_t IMPLEMENTED_MASK = 0xBF;
+  /// 0 enables hour matching
+  static constexpr Field AE_H{0x80, 7, 1};
+  /// BCD hours
+  static constexpr Field VALUE{0x3F, 0, 6};
+};
+
+/// @brief ALARM_DATE (0x0A, read/write-protectable)
+struct AlarmDate {
+  static constexpr uint8_t ADDRESS = 0x0A;
+  static constexpr uint8_t IMPLEMENTED_MASK = 0xBF;
+  /// 0 enables date matching
+  static constexpr Field AE_D{0x80, 7, 1};
+  /// BCD date
+  static constexpr Field VALUE{0x3F, 0, 6};
+};
+
+/// @brief TIMER_HIGH (0x0C, read/write-protectable)
+struct TimerHigh {
+  static constexpr uint8_t ADDRESS = 0x0C;
+  static constexpr uint8_t IMPLEMENTED_MASK = 0x0F;
+  /// Timer value bits 11:8
+  static constexpr Field VALUE{0x0F, 0, 4};
+};
+
+/// @brief STATUS (0x0D, read/write-protectable)
+struct StatusRegister {
+  static constexpr uint8_t ADDRESS = 0x0D;
+  static constexpr uint8_t IMPLEMENTED_MASK = 0xFF;
+  /// Temperature high flag
+  static constexpr Field THF{0x80, 7, 1};
+  /// Temperature low flag
+  static constexpr Field TLF{0x40, 6, 1};
+  /// Periodic update flag
+  static constexpr Field UF{0x20, 5, 1};
+  /// Periodic countdown timer flag
+  static constexpr Field TF{0x10, 4, 1};
+  /// Alarm flag
+  static constexpr Field AF{0x08, 3, 1};
+  /// External event flag
+  static constexpr Field EVF{0x04, 2, 1};
+  /// Power-on reset flag
+  static constexpr Field PORF{0x02, 1, 1};
+  /// Voltage low flag
+  static constexpr Field VLF{0x01, 0, 1};
+};
+
+/// @brief TEMP_LSB (0x0E, read/write-clear flags)
+struct TempLsb {
+  static constexpr uint8_t ADDRESS = 0x0E;
+  static constexpr uint8_t IMPLEMENTED_MASK = 0xFF;
+  /// Temperature bits 3:0 (1/16 degC)
+  static constexpr Field TEMP_FRACTION{0xF0, 4, 4};
+  /// EEPROM write failure flag
+  static constexpr Field EEF{0x08, 3, 1};
+  /// EEPROM busy
+  static constexpr Field EEBUSY{0x04, 2, 1};
+  /// Clock output interrupt flag
+  static constexpr Field CLKF{0x02, 1, 1};
+  /// Backup switchover flag
+  static constexpr Field BSF{0x01, 0, 1};
+};
+
+/// @brief CONTROL1 (0x10, read/write-protectable)
+struct Control1 {
+  static constexpr uint8_t ADDRESS = 0x10;
+  static constexpr uint8_t IMPLEMENTED_MASK = 0x3F;
+  /// General-purpose bit 0
+  static constexpr Field GP0{0x20, 5, 1};
+  /// Periodic update select (0 = second, 1 = minute)
+  static constexpr Field USEL{0x10, 4, 1};
+  /// Periodic countdown timer enable
+  static constexpr Field TE{0x08, 3, 1};
+  /// EEPROM memory refresh disable
+  static constexpr Field EERD{0x04, 2, 1};
+  /// Timer clock frequency
+  static constexpr Field TD{0x03, 0, 2};
+};
+
+/// @brief CONTROL2 (0x11, read/write-protectable)
+struct Control2 {
+  static constexpr uint8_t ADDRESS = 0x11;
+  static constexpr uint8_t IMPLEMENTED_MASK = 0x7F;
+  /// Interrupt-controlled clock output enable
+  static constexpr Field CLKIE{0x40, 6, 1};
+  /// Periodic update interrupt enable
+  static constexpr Field UIE{0x20, 5, 1};
+  /// Periodic countdown timer interrupt enable
+  static constexpr Field TIE{0x10, 4, 1};
+  /// Alarm interrupt enable
+  static constexpr Field AIE{0x08, 3, 1};
+  /// External event interrupt enable
+  static constexpr Field EIE{0x04, 2, 1};
+  /// General-purpose bit 1
+  static constexpr Field GP1{0x02, 1, 1};
+  /// Stop the time/calendar prescaler
+  static constexpr Field STOP{0x01, 0, 1};
+};
+
+/// @brief CONTROL3 (0x12, read/write-protectable)
+struct Control3 {
+  static constexpr uint8_t ADDRESS = 0x12;
+  static constexpr uint8_t IMPLEMENTED_MASK = 0x1F;
+  /// Backup switchover interrupt enable
+  static constexpr Field BSIE{0x10, 4, 1};
+  /// Temperature high event enable
+  static constexpr Field THE{0x08, 3, 1};
+  /// Temperature low event enable
+  static constexpr Field TLE{0x04, 2, 1};
+  /// Temperature high interrupt enable
+  static constexpr Field THIE{0x02, 1, 1};
+  /// Temperature low interrupt enable
+  static constexpr Field TLIE{0x01, 0, 1};
+};
+
+/// @brief TS_CONTROL (0x13, read/write-protectable)
+struct TsControl {
+  static constexpr uint8_t ADDRESS = 0x13;
+  static constexpr uint8_t IMPLEMENTED_MASK = 0x3F;
+  /// Reset EVI timestamp
+  static constexpr Field EVR{0x20, 5, 1};
+  /// Reset THigh timestamp
+  static constexpr Field THR{0x10, 4, 1};
+  /// Reset TLow timestamp
+  static constexpr Field TLR{0x08, 3, 1};
+  /// EVI timestamp overwrite enable
+  static constexpr Field EVOW{0x04, 2, 1};
+  /// THigh timestamp overwrite enable
+  static constexpr Field THOW{0x02, 1, 1};
+  /// TLow timestamp overwrite enable
+  static constexpr Field TLOW{0x01, 0, 1};
+};
+
+/// @brief CLOCK_INT_MASK (0x14, read/write-protectable)
+struct ClockIntMask {
+  static constexpr uint8_t ADDRESS = 0x14;
+  static constexpr uint8_t IMPLEMENTED_MASK = 0xFF;
+  /// Long clock-output stop delay
+  static constexpr Field CLKD{0x80, 7, 1};
+  /// Interrupt delay after CLKOUT on
+  static constexpr Field INTDE{0x40, 6, 1};
+  /// Event clock-output source
+  static constexpr Field CEIE{0x20, 5, 1};
+  /// Alarm clock-output source
+  static constexpr Field CAIE{0x10, 4, 1};
+  /// Timer clock-output source
+  static constexpr Field CTIE{0x08, 3, 1};
+  /// Update clock-output source
+  static constexpr Field CUIE{0x04, 2, 1};
+  /// Temperature-high clock-output source
+  static constexpr Field CTHIE{0x02, 1, 1};
+  /// Temperature-low clock-output source
+  static constexpr Field CTLIE{0x01, 0, 1};
+};
+
+/// @brief EVI_CONTROL (0x15, read/write-protectable)
+struct EviControl {
+  static constexpr uint8_t ADDRESS = 0x15;
+  static constexpr uint8_t IMPLEMENTED_MASK = 0xF1;
+  /// Clock-output stop delay on EVI
+  static constexpr Field CLKDE{0x80, 7, 1};
+  /// Event edge/level (1 = rising/high)
+  static constexpr Field EHL{0x40, 6, 1};
+  /// Event debounce filter
+  static constexpr Field ET{0x30, 4, 2};
+  /// Time synchronization on EVI
+  static constexpr Field ESYN{0x01, 0, 1};
+};
+
+/// @brief ACTIVE_PMU (0xC0, read/write-protectable)
+struct ActivePmu {
+  static constexpr uint8_t ADDRESS = 0xC0;
+  static constexpr uint8_t IMPLEMENTED_MASK = 0x7F;
+  /// Disable CLKOUT when set
+  static constexpr Field NCLKE{0x40, 6, 1};
+  /// Backup switchover mode
+  static constexpr Field BSM{0x30, 4, 2};
+  /// Trickle-charge series resistance
+  static constexpr Field TCR{0x0C, 2, 2};
+  /// Trickle-charge mode
+  static constexpr Field TCM{0x03, 0, 2};
+};
+
+/// @brief ACTIVE_OFFSET (0xC1, read/write-protectable)
+struct ActiveOffset {
+  static constexpr uint8_t ADDRESS = 0xC1;
+  static constexpr uint8_t IMPLEMENTED_MASK = 0xFF;
+  /// Power-on reset interrupt enable
+  static constexpr Field PORIE{0x80, 7, 1};
+  /// Voltage low interrupt enable
+  static constexpr Field VLIE{0x40, 6, 1};
+  /// Two's-complement aging offset (0.2384 ppm/step)
+  static constexpr Field OFFSET{0x3F, 0, 6};
+};
+
+/// @brief ACTIVE_CLKOUT1 (0xC2, read/write-protectable)
+struct ActiveClkout1 {
+  static constexpr uint8_t ADDRESS = 0xC2;
+  static constexpr uint8_t IMPLEMENTED_MASK = 0xFF;
+  /// High-frequency divider bits 7:0
+  static constexpr Field HFD_LOW{0xFF, 0, 8};
+};
+
+/// @brief ACTIVE_CLKOUT2 (0xC3, read/write-protectable)
+struct ActiveClkout2 {
+  static constexpr uint8_t ADDRESS = 0xC3;
+  static constexpr uint8_t IMPLEMENTED_MASK = 0xFF;
+  /// High-frequency output select
+  static constexpr Field OS{0x80, 7, 1};
+  /// XTAL-derived frequency select
+  static constexpr Field FD{0x60, 5, 2};
+  /// High-frequency divider bits 12:8
+  static constexpr Field HFD_HIGH{0x1F, 0, 5};
+};
+
+// ===== Allowlists =====
+
+/// @brief Every decoded address, reserved gaps and password bytes included.
+static constexpr uint32_t KNOWN_ADDRESS_BITMAP[8] = {
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0x0000FFFFu, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x000007FFu, 0x00000000u};
+
+/// @brief Addresses accepted by readRegister()/readRegisters().
+static constexpr uint32_t PUBLIC_READABLE_BITMAP[8] = {
+    0xFFFFFFFFu, 0x00003FFFu, 0x0000FFFFu, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x0000003Fu, 0x00000000u};
+
+/// @brief Addresses accepted by writeRegister()/writeRegisters().
+static constexpr uint32_t RAW_WRITABLE_BITMAP[8] = {
+    0x00C00000u, 0x00000000u, 0x0000FFFFu, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u};
+
+/// @brief Registers only software changes; served from the beginBatch() cache.
+static constexpr uint32_t BATCH_CACHEABLE_BITMAP[8] = {
+    0x00F70700u, 0x00000000u, 0x00000000u, 0x00000000u,
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u};
+
+/// @brief Contiguous runs of KNOWN_ADDRESS_BITMAP, for O(1) block checks.
+static constexpr AddressRun KNOWN_ADDRESS_RUNS[] = {{0x00, 0x4F}, {0xC0, 0xCA}};
+
+/// @brief True when @p reg is set in a 256-bit address bitmap.
+constexpr bool contains(const uint32_t (&bitmap)[8], uint8_t reg) {
+  return ((bitmap[reg >> 5] >> (reg & 31U)) & 1U) != 0;
+}
+
+/// @brief True when [reg, reg + len) lies inside one decoded address run.
+constexpr bool isKnownBlock(uint8_t reg, size_t len) {
+  if (len == 0 || len > 256U) {
+    return false;
+  }
+  const size_t last = static_cast<size_t>(reg) + len - 1U;
+  for (const AddressRun& run : KNOWN_ADDRESS_RUNS) {
+    if (reg >= run.first && last <= run.last) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// ===== CommandTable.h consistency =====
+
+static_assert(0x00 == cmd::REG_100TH_SECONDS, "REG_100TH_SECONDS drifted from register_map.json");
+static_assert(0x01 == cmd::REG_SECONDS, "REG_SECONDS drifted from register_map.json");
+static_assert(0x02 == cmd::REG_MINUTES, "REG_MINUTES drifted from register_map.json");
+static_assert(0x03 == cmd::REG_HOURS, "REG_HOURS drifted from register_map.json");
+static_assert(0x04 == cmd::REG_WEEKDAY, "REG_WEEKDAY drifted from register_map.json");
+static_assert(0x05 == cmd::REG_DATE, "REG_DATE drifted from register_map.json");
+static_assert(0x06 == cmd::REG_MONTH, "REG_MONTH drifted from register_map.json");
+static_assert(0x07 == cmd::REG_YEAR, "REG_YEAR drifted from register_map.json");
+static_assert(0x08 == cmd::REG_ALARM_MINUTE, "REG_ALARM_MINUTE drifted from register_map.json");
+static_assert(0x09 == cmd::REG_ALARM_HOUR, "REG_ALARM_HOUR drifted from register_map.json");
+static_assert(0x0A == cmd::REG_ALARM_DATE, "REG_ALARM_DATE drifted from register_map.json");
+static_assert(0x0B == cmd::REG_TIMER_LOW, "REG_TIMER_LOW drifted from register_map.json");
+static_assert(0x0C == cmd::REG_TIMER_HIGH, "REG_TIMER_HIGH drifted from register_map.json");
+static_assert(0x0D == cmd::REG_STATUS, "REG_STATUS drifted from register_map.json");
+static_assert(StatusRegister::THF.width == 1 && StatusRegister::THF.shift == cmd::STATUS_THF_BIT, "STATUS_THF_BIT drifted from register_map.json");
+static_assert(StatusRegister::TLF.width == 1 && StatusRegister::TLF.shift == cmd::STATUS_TLF_BIT, "STATUS_TLF_BIT drifted from register_map.json");
+static_assert(StatusRegister::UF.width == 1 && StatusRegister::UF.shift == cmd::STATUS_UF_BIT, "STATUS_UF_BIT drifted from register_map.json");
+static_assert(StatusRegister::TF.width == 1 && StatusRegister::TF.shift == cmd::STATUS_TF_BIT, "STATUS_TF_BIT drifted from register_map.json");
+static_assert(StatusRegister::AF.width == 1 && StatusRegister::AF.shift == cmd::STATUS_AF_BIT, "STATUS_AF_BIT drifted from register_map.json");
+static_assert(StatusRegister::EVF.width == 1 && StatusRegister::EVF.shift == cmd::STATUS_EVF_BIT, "STATUS_EVF_BIT drifted from register_map.json");
+static_assert(StatusRegister::PORF.width == 1 && StatusRegister::PORF.shift == cmd::STATUS_PORF_BIT, "STATUS_PORF_BIT drifted from register_map.json");
+static_assert(StatusRegister::VLF.width == 1 && StatusRegister::VLF.shift == cmd::STATUS_VLF_BIT, "STATUS_VLF_BIT drifted from register_map.json");
+static_assert(0x0E == cmd::REG_TEMP_LSB, "REG_TEMP_LSB drifted from register_map.json");
+static_assert(TempLsb::EEF.mask == cmd::EEPROM_EEF_MASK, "EEPROM_EEF_MASK drifted from register_map.json");
+static_assert(TempLsb::EEBUSY.mask == cmd::EEPROM_BUSY_MASK, "EEPROM_BUSY_MASK drifted from register_map.json");
+static_assert(TempLsb::CLKF.mask == cmd::TEMP_CLKF_MASK, "TEMP_CLKF_MASK drifted from register_map.json");
+static_assert(TempLsb::BSF.mask == cmd::TEMP_BSF_MASK, "TEMP_BSF_MASK drifted from register_map.json");
+static_assert(0x0F == cmd::REG_TEMP_MSB, "REG_TEMP_MSB drifted from register_map.json");
+static_assert(0x10 == cmd::REG_CONTROL1, "REG_CONTROL1 drifted from register_map.json");
+static_assert(Control1::IMPLEMENTED_MASK == cmd::CONTROL1_IMPLEMENTED_MASK, "CONTROL1_IMPLEMENTED_MASK drifted from register_map.json");
+static_assert(Control1::GP0.width == 1 && Control1::GP0.shift == cmd::CTRL1_GP0_BIT, "CTRL1_GP0_BIT drifted from register_map.json");
+static_assert(Control1::USEL.width == 1 && Control1::USEL.shift == cmd::CTRL1_USEL_BIT, "CTRL1_USEL_BIT drifted from register_map.json");
+static_assert(Control1::TE.width == 1 && Control1::TE.shift == cmd::CTRL1_TE_BIT, "CTRL1_TE_BIT drifted from register_map.json");
+static_assert(Control1::EERD.width == 1 && Control1::EERD.shift == cmd::CTRL1_EERD_BIT, "CTRL1_EERD_BIT drifted from register_map.json");
+static_assert(Control1::EERD.mask == cmd::CONTROL1_EERD_MASK, "CONTROL1_EERD_MASK drifted from register_map.json");
+static_assert(Control1::TD.mask == cmd::CTRL1_TD_MASK, "CTRL1_TD_MASK drifted from register_map.json");
+static_assert(0x11 == cmd::REG_CONTROL2, "REG_CONTROL2 drifted from register_map.json");
+static_assert(Control2::IMPLEMENTED_MASK == cmd::CONTROL2_IMPLEMENTED_MASK, "CONTROL2_IMPLEMENTED_MASK drifted from register_map.json");
+static_assert(Control2::CLKIE.width == 1 && Control2::CLKIE.shift == cmd::CTRL2_CLKIE_BIT, "CTRL2_CLKIE_BIT drifted from register_map.json");
+static_assert(Control2::UIE.width == 1 && Control2::UIE.shift == cmd::CTRL2_UIE_BIT, "CTRL2_UIE_BIT drifted from register_map.json");
+static_assert(Control2::TIE.width == 1 && Control2::TIE.shift == cmd::CTRL2_TIE_BIT, "CTRL2_TIE_BIT drifted from register_map.json");
+static_assert(Control2::AIE.width == 1 && Control2::AIE.shift == cmd::CTRL2_AIE_BIT, "CTRL2_AIE_BIT drifted from register_map.json");
+static_assert(Control2::EIE.width == 1 && Control2::EIE.shift == cmd::CTRL2_EIE_BIT, "CTRL2_EIE_BIT drifted from register_map.json");
+static_assert(Control2::GP1.width == 1 && Control2::GP1.shift == cmd::CTRL2_GP1_BIT, "CTRL2_GP1_BIT drifted from register_map.json");
+static_assert(Control2::STOP.width == 1 && Control2::STOP.shift == cmd::CTRL2_STOP_BIT, "CTRL2_STOP_BIT drifted from register_map.json");
+static_assert(0x12 == cmd::REG_CONTROL3, "REG_CONTROL3 drifted from register_map.json");
+static_assert(Control3::IMPLEMENTED_MASK == cmd::CONTROL3_IMPLEMENTED_MASK, "CONTROL3_IMPLEMENTED_MASK drifted from register_map.json");
+static_assert(Control3::BSIE.width == 1 && Control3::BSIE.shift == cmd::CTRL3_BSIE_BIT, "CTRL3_BSIE_BIT drifted from register_map.json");
+static_assert(Control3::THE.width == 1 && Control3::THE.shift == cmd::CTRL3_THE_BIT, "CTRL3_THE_BIT drifted from register_map.json");
+static_assert(Control3::TLE.width == 1 && Control3::TLE.shift == cmd::CTRL3_TLE_BIT, "CTRL3_TLE_BIT drifted from register_map.json");
+static_assert(Control3::THIE.width == 1 && Control3::THIE.shift == cmd::CTRL3_THIE_BIT, "CTRL3_THIE_BIT drifted from register_map.json");
+static_assert(Control3::TLIE.width == 1 && Control3::TLIE.shift == cmd::CTRL3_TLIE_BIT, "CTRL3_TLIE_BIT drifted from register_map.json");
+static_assert(0x13 == cmd::REG_TS_CONTROL, "REG_TS_CONTROL drifted from register_map.json");
+static_assert(TsControl::IMPLEMENTED_MASK == cmd::TS_CONTROL_IMPLEMENTED_MASK, "TS_CONTROL_IMPLEMENTED_MASK drifted from register_map.json");
+static_assert(TsControl::EVR.width == 1 && TsControl::EVR.shift == cmd::TS_EVI_RESET_BIT, "TS_EVI_RESET_BIT drifted from register_map.json");
+static_assert(TsControl::THR.width == 1 && TsControl::THR.shift == cmd::TS_THIGH_RESET_BIT, "TS_THIGH_RESET_BIT drifted from register_map.json");
+static_assert(TsControl::TLR.width == 1 && TsControl::TLR.shift == cmd::TS_TLOW_RESET_BIT, "TS_TLOW_RESET_BIT drifted from register_map.json");
+static_assert(TsControl::EVOW.width == 1 && TsControl::EVOW.shift == cmd::TS_EVI_OVERWRITE_BIT, "TS_EVI_OVERWRITE_BIT drifted from register_map.json");
+static_assert(TsControl::THOW.width == 1 && TsControl::THOW.shift == cmd::TS_THIGH_OVERWRITE_BIT, "TS_THIGH_OVERWRITE_BIT drifted from register_map.json");
+static_assert(TsControl::TLOW.width == 1 && TsControl::TLOW.shift == cmd::TS_TLOW_OVERWRITE_BIT, "TS_TLOW_OVERWRITE_BIT drifted from register_map.json");
+static_assert(0x14 == cmd::REG_CLOCK_INT_MASK, "REG_CLOCK_INT_MASK drifted from register_map.json");
+static_assert(ClockIntMask::IMPLEMENTED_MASK == cmd::CLOCK_INT_MASK_IMPLEMENTED_MASK, "CLOCK_INT_MASK_IMPLEMENTED_MASK drifted from register_map.json");
+static_assert(ClockIntMask::CLKD.width == 1 && ClockIntMask::CLKD.shift == cmd::CLOCK_INT_CLKD_BIT, "CLOCK_INT_CLKD_BIT drifted from register_map.json");
+static_assert(ClockIntMask::INTDE.width == 1 && ClockIntMask::INTDE.shift == cmd::CLOCK_INT_INTDE_BIT, "CLOCK_INT_INTDE_BIT drifted from register_map.json");
+static_assert(ClockIntMask::CEIE.width == 1 && ClockIntMask::CEIE.shift == cmd::CLOCK_INT_CEIE_BIT, "CLOCK_INT_CEIE_BIT drifted from register_map.json");
+static_assert(ClockIntMask::CAIE.width == 1 && ClockIntMask::CAIE.shift == cmd::CLOCK_INT_CAIE_BIT, "CLOCK_INT_CAIE_BIT drifted from register_map.json");
+static_assert(ClockIntMask::CTIE.width == 1 && ClockIntMask::CTIE.shift == cmd::CLOCK_INT_CTIE_BIT, "CLOCK_INT_CTIE_BIT drifted from register_map.json");
+static_assert(ClockIntMask::CUIE.width == 1 && ClockIntMask::CUIE.shift == cmd::CLOCK_INT_CUIE_BIT, "CLOCK_INT_CUIE_BIT drifted from register_map.json");
+static_assert(ClockIntMask::CTHIE.width == 1 && ClockIntMask::CTHIE.shift == cmd::CLOCK_INT_CTHIE_BIT, "CLOCK_INT_CTHIE_BIT drifted from register_map.json");
+static_assert(ClockIntMask::CTLIE.width == 1 && ClockIntMask::CTLIE.shift == cmd::CLOCK_INT_CTLIE_BIT, "CLOCK_INT_CTLIE_BIT drifted from register_map.json");
+static_assert(0x15 == cmd::REG_EVI_CONTROL, "REG_EVI_CONTROL drifted from register_map.json");
+static_assert(EviControl::IMPLEMENTED_MASK == cmd::EVI_IMPLEMENTED_MASK, "EVI_IMPLEMENTED_MASK drifted from register_map.json");
+static_assert(EviControl::CLKDE.width == 1 && EviControl::CLKDE.shift == cmd::EVI_CLKDE_BIT, "EVI_CLKDE_BIT drifted from register_map.json");
+static_assert(EviControl::EHL.width == 1 && EviControl::EHL.shift == cmd::EVI_EB_BIT, "EVI_EB_BIT drifted from register_map.json");
+static_assert(EviControl::ET.mask == cmd::EVI_DB_MASK, "EVI_DB_MASK drifted from register_map.json");
+static_assert(EviControl::ET.shift == cmd::EVI_DB_SHIFT, "EVI_DB_SHIFT drifted from register_map.json");
+static_assert(EviControl::ESYN.width == 1 && EviControl::ESYN.shift == cmd::EVI_ESYN_BIT, "EVI_ESYN_BIT drifted from register_map.json");
+static_assert(0x16 == cmd::REG_TLOW_THRESHOLD, "REG_TLOW_THRESHOLD drifted from register_map.json");
+static_assert(0x17 == cmd::REG_THIGH_THRESHOLD, "REG_THIGH_THRESHOLD drifted from register_map.json");
+static_assert(0x18 == cmd::REG_TS_TLOW_COUNT, "REG_TS_TLOW_COUNT drifted from register_map.json");
+static_assert(0x19 == cmd::REG_TS_TLOW_SECONDS, "REG_TS_TLOW_SECONDS drifted from register_map.json");
+static_assert(0x1A == cmd::REG_TS_TLOW_MINUTES, "REG_TS_TLOW_MINUTES drifted from register_map.json");
+static_assert(0x1B == cmd::REG_TS_TLOW_HOURS, "REG_TS_TLOW_HOURS drifted from register_map.json");
+static_assert(0x1C == cmd::REG_TS_TLOW_DATE, "REG_TS_TLOW_DATE drifted from register_map.json");
+static_assert(0x1D == cmd::REG_TS_TLOW_MONTH, "REG_TS_TLOW_MONTH drifted from register_map.json");
+static_assert(0x1E == cmd::REG_TS_TLOW_YEAR, "REG_TS_TLOW_YEAR drifted from register_map.json");
+static_assert(0x1F == cmd::REG_TS_THIGH_COUNT, "REG_TS_THIGH_COUNT drifted from register_map.json");
+static_assert(0x20 == cmd::REG_TS_THIGH_SECONDS, "REG_TS_THIGH_SECONDS drifted from register_map.json");
+static_assert(0x21 == cmd::REG_TS_THIGH_MINUTES, "REG_TS_THIGH_MINUTES drifted from register_map.json");
+static_assert(0x22 == cmd::REG_TS_THIGH_HOURS, "REG_TS_THIGH_HOURS drifted from register_map.json");
+static_assert(0x23 == cmd::REG_TS_THIGH_DATE, "REG_TS_THIGH_DATE drifted from register_map.json");
+static_assert(0x24 == cmd::REG_TS_THIGH_MONTH, "REG_TS_THIGH_MONTH drifted from register_map.json");
+static_assert(0x25 == cmd::REG_TS_THIGH_YEAR, "REG_TS_THIGH_YEAR drifted from register_map.json");
+static_assert(0x26 == cmd::REG_TS_EVI_COUNT, "REG_TS_EVI_COUNT drifted from register_map.json");
+static_assert(0x27 == cmd::REG_TS_EVI_100TH_SECONDS, "REG_TS_EVI_100TH_SECONDS drifted from register_map.json");
+static_assert(0x28 == cmd::REG_TS_EVI_SECONDS, "REG_TS_EVI_SECONDS drifted from register_map.json");
+static_assert(0x29 == cmd::REG_TS_EVI_MINUTES, "REG_TS_EVI_MINUTES drifted from register_map.json");
+static_assert(0x2A == cmd::REG_TS_EVI_HOURS, "REG_TS_EVI_HOURS drifted from register_map.json");
+static_assert(0x2B == cmd::REG_TS_EVI_DATE, "REG_TS_EVI_DATE drifted from register_map.json");
+static_assert(0x2C == cmd::REG_TS_EVI_MONTH, "REG_TS_EVI_MONTH drifted from register_map.json");
+static_assert(0x2D == cmd::REG_TS_EVI_YEAR, "REG_TS_EVI_YEAR drifted from register_map.json");
+static_assert(0x39 == cmd::REG_PASSWORD0, "REG_PASSWORD0 drifted from register_map.json");
+static_assert(0x3A == cmd::REG_PASSWORD1, "REG_PASSWORD1 drifted from register_map.json");
+static_assert(0x3B == cmd::REG_PASSWORD2, "REG_PASSWORD2 drifted from register_map.json");
+static_assert(0x3C == cmd::REG_PASSWORD3, "REG_PASSWORD3 drifted from register_map.json");
+static_assert(0x3D == cmd::REG_EE_ADDRESS, "REG_EE_ADDRESS drifted from register_map.json");
+static_assert(0x3E == cmd::REG_EE_DATA, "REG_EE_DATA drifted from register_map.json");
+static_assert(0x3F == cmd::REG_EE_COMMAND, "REG_EE_COMMAND drifted from register_map.json");
+static_assert(0x40 == cmd::REG_USER_RAM_START, "REG_USER_RAM_START drifted from register_map.json");
+static_assert(0x4F == cmd::REG_USER_RAM_END, "REG_USER_RAM_END drifted from register_map.json");
+static_assert(0xC0 == cmd::REG_ACTIVE_PMU, "REG_ACTIVE_PMU drifted from register_map.json");
+static_assert(ActivePmu::IMPLEMENTED_MASK == cmd::PMU_IMPLEMENTED_MASK, "PMU_IMPLEMENTED_MASK drifted from register_map.json");
+static_assert(ActivePmu::NCLKE.mask == cmd::PMU_NCLKE_MASK, "PMU_NCLKE_MASK drifted from register_map.json");
+static_assert(ActivePmu::BSM.mask == cmd::PMU_BSM_MASK, "PMU_BSM_MASK drifted from register_map.json");
+static_assert(ActivePmu::TCR.mask == cmd::PMU_TCR_MASK, "PMU_TCR_MASK drifted from register_map.json");
+static_assert(ActivePmu::TCM.mask == cmd::PMU_TCM_MASK, "PMU_TCM_MASK drifted from register_map.json");
+static_assert(0xC1 == cmd::REG_ACTIVE_OFFSET, "REG_ACTIVE_OFFSET drifted from register_map.json");
+static_assert(ActiveOffset::IMPLEMENTED_MASK == cmd::OFFSET_REGISTER_IMPLEMENTED_MASK, "OFFSET_REGISTER_IMPLEMENTED_MASK drifted from register_map.json");
+static_assert(ActiveOffset::PORIE.mask == cmd::OFFSET_PORIE_MASK, "OFFSET_PORIE_MASK drifted from register_map.json");
+static_assert(ActiveOffset::VLIE.mask == cmd::OFFSET_VLIE_MASK, "OFFSET_VLIE_MASK drifted from register_map.json");
+static_assert(ActiveOffset::OFFSET.mask == cmd::OFFSET_VALUE_MASK, "OFFSET_VALUE_MASK drifted from register_map.json");
+static_assert(0xC2 == cmd::REG_ACTIVE_CLKOUT1, "REG_ACTIVE_CLKOUT1 drifted from register_map.json");
+static_assert(0xC3 == cmd::REG_ACTIVE_CLKOUT2, "REG_ACTIVE_CLKOUT2 drifted from register_map.json");
+static_assert(ActiveClkout2::OS.mask == cmd::CLKOUT_OS_MASK, "CLKOUT_OS_MASK drifted from register_map.json");
+static_assert(ActiveClkout2::FD.mask == cmd::CLKOUT_FREQ_MASK, "CLKOUT_FREQ_MASK drifted from register_map.json");
+static_assert(ActiveClkout2::FD.shift == cmd::CLKOUT_FREQ_SHIFT, "CLKOUT_FREQ_SHIFT drifted from register_map.json");
+static_assert(ActiveClkout2::HFD_HIGH.mask == cmd::CLKOUT_HFD_HIGH_MASK, "CLKOUT_HFD_HIGH_MASK drifted from register_map.json");
+static_assert(0xC4 == cmd::REG_ACTIVE_TREFERENCE0, "REG_ACTIVE_TREFERENCE0 drifted from register_map.json");
+static_assert(0xC5 == cmd::REG_ACTIVE_TREFERENCE1, "REG_ACTIVE_TREFERENCE1 drifted from register_map.json");
+static_assert(0xC6 == cmd::REG_EEPROM_PASSWORD0, "REG_EEPROM_PASSWORD0 drifted from register_map.json");
+static_assert(0xC7 == cmd::REG_EEPROM_PASSWORD1, "REG_EEPROM_PASSWORD1 drifted from register_map.json");
+static_assert(0xC8 == cmd::REG_EEPROM_PASSWORD2, "REG_EEPROM_PASSWORD2 drifted from register_map.json");
+static_assert(0xC9 == cmd::REG_EEPROM_PASSWORD3, "REG_EEPROM_PASSWORD3 drifted from register_map.json");
+static_assert(0xCA == cmd::REG_EEPROM_PW_ENABLE, "REG_EEPROM_PW_ENABLE drifted from register_map.json");
+
+}  // namespace regmap
+
+}  // namespace RV3032
@@ -39,7 +39,8 @@ enum class Err : uint8_t {
   INCOHERENT_DATA = 22,        ///< Repeated hardware samples did not agree
   CONFIGURATION_CLEANUP_FAILED = 23, ///< Staged configuration cleanup could not be proven
   TRANSPORT_CONTRACT_VIOLATION = 24, ///< Transport callback returned an illegal status code
-  INTERNAL_STATE_ERROR = 25    ///< An impossible internal state was reached
+  INTERNAL_STATE_ERROR = 25,   ///< An impossible internal state was reached
+  JOB_CANCELLED = 26           ///< cancelJob() stopped the job before completion
 };
 
 /**
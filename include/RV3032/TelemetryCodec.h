@@ -0,0 +1,171 @@
+/**
+ * @file TelemetryCodec.h
+ * @brief Delta-compressed fixed-size blocks for RTC telemetry streams
+ *
+ * Each block is self-contained: a 16-byte header carries the first record and
+ * the record count, followed by one variable-length entry per later record.
+ * An entry starts with a varint holding the zigzag delta-of-delta of the
+ * centisecond timestamp and two change flags; the Status byte and the
+ * zigzag-varint temperature delta follow only when their flag is set, so a
+ * steady 1 Hz stream costs one byte per record. Blocks never reference each
+ * other, so an index of first timestamps gives random access.
+ *
+ * Block layout (little-endian):
+ * - 0..1 magic "RT", 2 version, 3 reserved (0)
+ * - 4..5 record count, 6..7 bytes used including the header
+ * - 8..11 first Unix timestamp, 12 first hundredths, 13 first Status,
+ *   14..15 first signed TEMP value
+ *
+ * Encoding and decoding never allocate; tools/decode_telemetry.py decodes the
+ * same format on a host.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "RV3032/RV3032.h"
+
+namespace RV3032 {
+
+/** @brief One telemetry sample as stored in a block. */
+struct TelemetryRecord {
+  uint32_t timestamp = 0;     ///< Unix seconds, 2000..2099.
+  uint8_t hundredths = 0;     ///< Hundredths of a second, 0-99.
+  uint8_t statusRaw = 0;      ///< Status register byte.
+  int16_t temperatureRaw = 0; ///< Signed 12-bit TEMP value in 1/16 degree C.
+};
+
+/** @brief Header fields of one encoded block, for building a block index. */
+struct TelemetryBlockInfo {
+  uint32_t firstTimestamp = 0; ///< Unix seconds of the first record.
+  uint16_t recordCount = 0;    ///< Records in the block.
+  uint16_t usedBytes = 0;      ///< Encoded bytes including the header.
+};
+
+/// @brief Encoded block header size in bytes.
+static constexpr size_t TELEMETRY_BLOCK_HEADER_SIZE = 16;
+/// @brief Smallest accepted block buffer.
+static constexpr size_t TELEMETRY_BLOCK_MIN_SIZE = 32;
+/// @brief Largest accepted block buffer; usedBytes is 16-bit.
+static constexpr size_t TELEMETRY_BLOCK_MAX_SIZE = 65535;
+/// @brief Format version written to byte 2.
+static constexpr uint8_t TELEMETRY_BLOCK_VERSION = 1;
+
+/**
+ * @brief Build a record from a telemetry frame
+ * @return OK, or INVALID_DATETIME without changing out when the frame's time
+ *         or hundredths are not valid.
+ */
+Status makeTelemetryRecord(const TelemetryFrame& frame, TelemetryRecord& out);
+
+/**
+ * @brief Build a record from a time snapshot
+ * @note Hundredths and temperature are stored as zero.
+ * @return OK, or INVALID_DATETIME without changing out when timeValid is false.
+ */
+Status makeTelemetryRecord(const TimeSnapshot& snapshot, TelemetryRecord& out);
+
+/**
+ * @brief Streaming encoder writing into one caller-owned block
+ *
+ * The caller writes the block to storage once append() reports it full, then
+ * calls begin() again with the next buffer.
+ */
+class TelemetryBlockEncoder {
+ public:
+  /**
+   * @brief Start a block in the caller's buffer
+   * @param block Buffer; the unused tail is filled with 0xFF (erased flash)
+   * @param size TELEMETRY_BLOCK_MIN_SIZE..TELEMETRY_BLOCK_MAX_SIZE bytes
+   * @return OK or INVALID_PARAM
+   */
+  Status begin(uint8_t* block, size_t size);
+
+  /**
+   * @brief Append one record
+   * @return OK; QUEUE_FULL when the encoded record does not fit, leaving the
+   *         block unchanged; INVALID_PARAM for an out-of-range record or
+   *         before begin().
+   * @note The header count and used length are updated on every append, so
+   *       the buffer is a complete block at all times.
+   */
+  Status append(const TelemetryRecord& record);
+
+  /** @brief Records encoded so far. */
+  uint16_t recordCount() const { return _count; }
+  /** @brief Bytes used so far, including the header. */
+  size_t usedBytes() const { return _used; }
+
+ private:
+  uint8_t* _block = nullptr;
+  size_t _size = 0;
+  size_t _used = 0;
+  uint16_t _count = 0;
+  uint64_t _previousCentis = 0;
+  int64_t _previousDelta = 0;
+  uint8_t _previousStatus = 0;
+  int16_t _previousTemperature = 0;
+};
+
+/** @brief Sequential decoder over one encoded block. */
+class TelemetryBlockDecoder {
+ public:
+  /**
+   * @brief Validate the header and rewind to the first record
+   * @return OK or INVALID_PARAM for a malformed header.
+   */
+  Status begin(const uint8_t* block, size_t size);
+
+  /**
+   * @brief Decode the next record
+   * @return OK; INVALID_PARAM when no record remains, the entry is malformed,
+   *         or the last entry does not end at the used length. out is
+   *         unchanged on failure.
+   */
+  Status next(TelemetryRecord& out);
+
+  /** @brief Records not yet returned by next(). */
+  uint16_t remaining() const { return static_cast<uint16_t>(_count - _index); }
+
+ private:
+  const uint8_t* _block = nullptr;
+  size_t _used = 0;
+  size_t _offset = 0;
+  uint16_t _count = 0;
+  uint16_t _index = 0;
+  uint64_t _previousCentis = 0;
+  int64_t _previousDelta = 0;
+  uint8_t _previousStatus = 0;
+  int16_t _previousTemperature = 0;
+};
+
+/**
+ * @brief Read a block header without decoding records
+ * @return OK or INVALID_PARAM for a malformed header; out unchanged on failure.
+ */
+Status readTelemetryBlockInfo(const uint8_t* block, size_t size,
+                              TelemetryBlockInfo& out);
+
+/**
+ * @brief Decode a whole block into an array
+ * @param[out] out Destination for up to capacity records
+ * @param[out] decoded Records written
+ * @return OK; INVALID_PARAM for a malformed block, a trailing-byte mismatch,
+ *         or a capacity below the record count.
+ */
+Status decodeTelemetryBlock(const uint8_t* block, size_t size,
+                            TelemetryRecord* out, size_t capacity,
+                            size_t& decoded);
+
+/**
+ * @brief Find the block that can contain a timestamp
+ * @param firstTimestamps Ascending first timestamps of consecutive blocks
+ * @return Index of the last block whose first timestamp is at or before
+ *         timestamp, or 0 when every block starts later. O(log n).
+ */
+size_t findTelemetryBlock(const uint32_t* firstTimestamps, size_t blockCount,
+                          uint32_t timestamp);
+
+}  // namespace RV3032
@@ -0,0 +1,418 @@
+/**
+ * @file TimeZones.h
+ * @brief Generated UTC-offset transition tables for 2000..2099.
+ *
+ * This file is AUTO-GENERATED by scripts/generate_timezones.py from
+ * scripts/timezones.json. DO NOT EDIT MANUALLY. Pass a zone to
+ * RV3032::utcToLocal() or RV3032::localToUtc(); unused zones cost no flash.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#include "RV3032/RV3032.h"
+
+namespace RV3032 {
+
+namespace tz {
+
+namespace detail {
+
+// UTC: UTC0 from 2000
+inline constexpr int16_t kUtcOffsetMin[] = {
+    0,
+};
+
+// Europe/Prague: CET-1CEST,M3.5.0,M10.5.0/3 from 2000
+inline constexpr uint32_t kEuropePragueUtc[] = {
+    954032400u, 972781200u, 985482000u, 1004230800u, 1017536400u, 1035680400u,
+    1048986000u, 1067130000u, 1080435600u, 1099184400u, 1111885200u, 1130634000u,
+    1143334800u, 1162083600u, 1174784400u, 1193533200u, 1206838800u, 1224982800u,
+    1238288400u, 1256432400u, 1269738000u, 1288486800u, 1301187600u, 1319936400u,
+    1332637200u, 1351386000u, 1364691600u, 1382835600u, 1396141200u, 1414285200u,
+    1427590800u, 1445734800u, 1459040400u, 1477789200u, 1490490000u, 1509238800u,
+    1521939600u, 1540688400u, 1553994000u, 1572138000u, 1585443600u, 1603587600u,
+    1616893200u, 1635642000u, 1648342800u, 1667091600u, 1679792400u, 1698541200u,
+    1711846800u, 1729990800u, 1743296400u, 1761440400u, 1774746000u, 1792890000u,
+    1806195600u, 1824944400u, 1837645200u, 1856394000u, 1869094800u, 1887843600u,
+    1901149200u, 1919293200u, 1932598800u, 1950742800u, 1964048400u, 1982797200u,
+    1995498000u, 2014246800u, 2026947600u, 2045696400u, 2058397200u, 2077146000u,
+    2090451600u, 2108595600u, 2121901200u, 2140045200u, 2153350800u, 2172099600u,
+    2184800400u, 2203549200u, 2216250000u, 2234998800u, 2248304400u, 2266448400u,
+    2279754000u, 2297898000u, 2311203600u, 2329347600u, 2342653200u, 2361402000u,
+    2374102800u, 2392851600u, 2405552400u, 2424301200u, 2437606800u, 2455750800u,
+    2469056400u, 2487200400u, 2500506000u, 2519254800u, 2531955600u, 2550704400u,
+    2563405200u, 2582154000u, 2595459600u, 2613603600u, 2626909200u, 2645053200u,
+    2658358800u, 2676502800u, 2689808400u, 2708557200u, 2721258000u, 2740006800u,
+    2752707600u, 2771456400u, 2784762000u, 2802906000u, 2816211600u, 2834355600u,
+    2847661200u, 2866410000u, 2879110800u, 2897859600u, 2910560400u, 2929309200u,
+    2942010000u, 2960758800u, 2974064400u, 2992208400u, 3005514000u, 3023658000u,
+    3036963600u, 3055712400u, 3068413200u, 3087162000u, 3099862800u, 3118611600u,
+    3131917200u, 3150061200u, 3163366800u, 3181510800u, 3194816400u, 3212960400u,
+    3226266000u, 3245014800u, 3257715600u, 3276464400u, 3289165200u, 3307914000u,
+    3321219600u, 3339363600u, 3352669200u, 3370813200u, 3384118800u, 3402867600u,
+    3415568400u, 3434317200u, 3447018000u, 3465766800u, 3479072400u, 3497216400u,
+    3510522000u, 3528666000u, 3541971600u, 3560115600u, 3573421200u, 3592170000u,
+    3604870800u, 3623619600u, 3636320400u, 3655069200u, 3668374800u, 3686518800u,
+    3699824400u, 3717968400u, 3731274000u, 3750022800u, 3762723600u, 3781472400u,
+    3794173200u, 3812922000u, 3825622800u, 3844371600u, 3857677200u, 3875821200u,
+    3889126800u, 3907270800u, 3920576400u, 3939325200u, 3952026000u, 3970774800u,
+    3983475600u, 4002224400u, 4015530000u, 4033674000u, 4046979600u, 4065123600u,
+    4078429200u, 4096573200u,
+};
+inline constexpr int16_t kEuropePragueOffsetMin[] = {
+    60, 120, 60, 120, 60, 120, 60, 120, 60, 120, 60, 120,
+    60, 120, 60, 120, 60, 120, 60, 120, 60, 120, 60, 120,
+    60, 120, 60, 120, 60, 120, 60, 120, 60, 120, 60, 120,
+    60, 120, 60, 120, 60, 120, 60, 120, 60, 120, 60, 120,
+    60, 120, 60, 120, 60, 120, 60, 120, 60, 120, 60, 120,
+    60, 120, 60, 120, 60, 120, 60, 120, 60, 120, 60, 120,
+    60, 120, 60, 120, 60, 120, 60, 120, 60, 120, 60, 120,
+    60, 120, 60, 120, 60, 120, 60, 120, 60, 120, 60, 120,
+    60, 120, 60, 120, 60, 120, 60, 120, 60, 120, 60, 120,
+    60, 120, 60, 120, 60, 120, 60, 120, 60, 120, 60, 120,
+    60, 120, 60, 120, 60, 120, 60, 120, 60, 120, 60, 120,
+    60, 120, 60, 120, 60, 120, 60, 120, 60, 120, 60, 120,
+    60, 120, 60, 120, 60, 120, 60, 120, 60, 120, 60, 120,
+    60, 120, 60, 120, 60, 120, 60, 120, 60, 120, 60, 120,
+    60, 120, 60, 120, 60, 120, 60, 120, 60, 120, 60, 120,
+    60, 120, 60, 120, 60, 120, 60, 120, 60, 120, 60, 120,
+    60, 120, 60, 120, 60, 120, 60, 120, 60,
+};
+
+// Europe/Berlin: CET-1CEST,M3.5.0,M10.5.0/3 from 2000
+inline constexpr uint32_t kEuropeBerlinUtc[] = {
+    954032400u, 972781200u, 985482000u, 1004230800u, 1017536400u, 1035680400u,
+    1048986000u, 1067130000u, 1080435600u, 1099184400u, 1111885200u, 1130634000u,
+    1143334800u, 1162083600u, 1174784400u, 1193533200u, 1206838800u, 1224982800u,
+    1238288400u, 1256432400u, 1269738000u, 1288486800u, 1301187600u, 1319936400u,
+    1332637200u, 1351386000u, 1364691600u, 1382835600u, 1396141200u, 1414285200u,
+    1427590800u, 1445734800u, 1459040400u, 1477789200u, 1490490000u, 1509238800u,
+    1521939600u, 1540688400u, 1553994000u, 1572138000u, 1585443600u, 1603587600u,
+    1616893200u, 1635642000u, 1648342800u, 1667091600u, 1679792400u, 1698541200u,
+    1711846800u, 1729990800u, 1743296400u, 1761440400u, 1774746000u, 1792890000u,
+    1806195600u, 1824944400u, 1837645200u, 1856394000u, 1869094800u, 1887843600u,
+    1901149200u, 1919293200u, 1932598800u, 1950742800u, 1964048400u, 1982797200u,
+    1995498000u, 2014246800u, 2026947600u, 2045696400u, 2058397200u, 2077146000u,
+    2090451600u, 2108595600u, 2121901200u, 2140045200u, 2153350800u, 2172099600u,
+    2184800400u, 2203549200u, 2216250000u, 2234998800u, 2248304400u, 2266448400u,
+    2279754000u, 2297898000u, 2311203600u, 2329347600u, 2342653200u, 2361402000u,
+    2374102800u, 2392851600u, 2405552400u, 2424301200u, 2437606800u, 2455750800u,
+    2469056400u, 2487200400u, 2500506000u, 2519254800u, 2531955600u, 2550704400u,
+    2563405200u, 2582154000u, 2595459600u, 2613603600u, 2626909200u, 2645053200u,
+    2658358800u, 2676502800u, 2689808400u, 2708557200u, 2721258000u, 2740006800u,
+    2752707600u, 2771456400u, 2784762000u, 2802906000u, 2816211600u, 2834355600u,
+    2847661200u, 2866410000u, 2879110800u, 2897859600u, 2910560400u, 2929309200u,
+    2942010000u, 2960758800u, 2974064400u, 2992208400u, 3005514000u, 3023658000u,
+    3036963600u, 3055712400u, 3068413200u, 3087162000u, 3099862800u, 3118611600u,
+    3131917200u, 3150061200u, 3163366800u, 3181510800u, 3194816400u, 3212960400u,
+    3226266000u, 3245014800u, 3257715600u, 3276464400u, 3289165200u, 3307914000u,
+    3321219600u, 3339363600u, 3352669200u, 3370813200u, 3384118800u, 3402867600u,
+    3415568400u, 3434317200u, 3447018000u, 3465766800u, 3479072400u, 3497216400u,
+    3510522000u, 3528666000u, 3541971600u, 3560115600u, 3573421200u, 3592170000u,
+    3604870800u, 3623619600u, 3636320400u, 3655069200u, 3668374800u, 3686518800u,
+    3699824400u, 3717968400u, 3731274000u, 3750022800u, 3762723600u, 3781472400u,
+    3794173200u, 3812922000u, 3825622800u, 3844371600u, 3857677200u, 3875821200u,
+    3889126800u, 3907270800u, 3920576400u, 3939325200u, 3952026000u, 3970774800u,
+    3983475600u, 4002224400u, 4015530000u, 4033674000u, 4046979600u, 4065123600u,
+    4078429200u, 4096573200u,
+};
+inline constexpr int16_t kEuropeBerlinOffsetMin[] = {
+    60, 120, 60, 120, 60, 120, 60, 120, 60, 120, 60, 120,
+    60, 120, 60, 120, 60, 120, 60, 120, 60, 120, 60, 120,
+    60, 120, 60, 120, 60, 120, 60, 120, 60, 120, 60, 120,
+    60, 120, 60, 120, 60, 120, 60, 120, 60, 120, 60, 120,
+    60, 120, 60, 120, 60, 120, 60, 120, 60, 120, 60, 120,
+    60, 120, 60, 120, 60, 120, 60, 120, 60, 120, 60, 120,
+    60, 120, 60, 120, 60, 120, 60, 120, 60, 120, 60, 120,
+    60, 120, 60, 120, 60, 120, 60, 120, 60, 120, 60, 120,
+    60, 120, 60, 120, 60, 120, 60, 120, 60, 120, 60, 120,
+    60, 120, 60, 120, 60, 120, 60, 120, 60, 120, 60, 120,
+    60, 120, 60, 120, 60, 120, 60, 120, 60, 120, 60, 120,
+    60, 120, 60, 120, 60, 120, 60, 120, 60, 120, 60, 120,
+    60, 120, 60, 120, 60, 120, 60, 120, 60, 120, 60, 120,
+    60, 120, 60, 120, 60, 120, 60, 120, 60, 120, 60, 120,
+    60, 120, 60, 120, 60, 120, 60, 120, 60, 120, 60, 120,
+    60, 120, 60, 120, 60, 120, 60, 120, 60, 120, 60, 120,
+    60, 120, 60, 120, 60, 120, 60, 120, 60,
+};
+
+// Europe/London: GMT0BST,M3.5.0/1,M10.5.0 from 2000
+inline constexpr uint32_t kEuropeLondonUtc[] = {
+    954032400u, 972781200u, 985482000u, 1004230800u, 1017536400u, 1035680400u,
+    1048986000u, 1067130000u, 1080435600u, 1099184400u, 1111885200u, 1130634000u,
+    1143334800u, 1162083600u, 1174784400u, 1193533200u, 1206838800u, 1224982800u,
+    1238288400u, 1256432400u, 1269738000u, 1288486800u, 1301187600u, 1319936400u,
+    1332637200u, 1351386000u, 1364691600u, 1382835600u, 1396141200u, 1414285200u,
+    1427590800u, 1445734800u, 1459040400u, 1477789200u, 1490490000u, 1509238800u,
+    1521939600u, 1540688400u, 1553994000u, 1572138000u, 1585443600u, 1603587600u,
+    1616893200u, 1635642000u, 1648342800u, 1667091600u, 1679792400u, 1698541200u,
+    1711846800u, 1729990800u, 1743296400u, 1761440400u, 1774746000u, 1792890000u,
+    1806195600u, 1824944400u, 1837645200u, 1856394000u, 1869094800u, 1887843600u,
+    1901149200u, 1919293200u, 1932598800u, 1950742800u, 1964048400u, 1982797200u,
+    1995498000u, 2014246800u, 2026947600u, 2045696400u, 2058397200u, 2077146000u,
+    2090451600u, 2108595600u, 2121901200u, 2140045200u, 2153350800u, 2172099600u,
+    2184800400u, 2203549200u, 2216250000u, 2234998800u, 2248304400u, 2266448400u,
+    2279754000u, 2297898000u, 2311203600u, 2329347600u, 2342653200u, 2361402000u,
+    2374102800u, 2392851600u, 2405552400u, 2424301200u, 2437606800u, 2455750800u,
+    2469056400u, 2487200400u, 2500506000u, 2519254800u, 2531955600u, 2550704400u,
+    2563405200u, 2582154000u, 2595459600u, 2613603600u, 2626909200u, 2645053200u,
+    2658358800u, 2676502800u, 2689808400u, 2708557200u, 2721258000u, 2740006800u,
+    2752707600u, 2771456400u, 2784762000u, 2802906000u, 2816211600u, 2834355600u,
+    2847661200u, 2866410000u, 2879110800u, 2897859600u, 2910560400u, 2929309200u,
+    2942010000u, 2960758800u, 2974064400u, 2992208400u, 3005514000u, 3023658000u,
+    3036963600u, 3055712400u, 3068413200u, 3087162000u, 3099862800u, 3118611600u,
+    3131917200u, 3150061200u, 3163366800u, 3181510800u, 3194816400u, 3212960400u,
+    3226266000u, 3245014800u, 3257715600u, 3276464400u, 3289165200u, 3307914000u,
+    3321219600u, 3339363600u, 3352669200u, 3370813200u, 3384118800u, 3402867600u,
+    3415568400u, 3434317200u, 3447018000u, 3465766800u, 3479072400u, 3497216400u,
+    3510522000u, 3528666000u, 3541971600u, 3560115600u, 3573421200u, 3592170000u,
+    3604870800u, 3623619600u, 3636320400u, 3655069200u, 3668374800u, 3686518800u,
+    3699824400u, 3717968400u, 3731274000u, 3750022800u, 3762723600u, 3781472400u,
+    3794173200u, 3812922000u, 3825622800u, 3844371600u, 3857677200u, 3875821200u,
+    3889126800u, 3907270800u, 3920576400u, 3939325200u, 3952026000u, 3970774800u,
+    3983475600u, 4002224400u, 4015530000u, 4033674000u, 4046979600u, 4065123600u,
+    4078429200u, 4096573200u,
+};
+inline constexpr int16_t kEuropeLondonOffsetMin[] = {
+    0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60,
+    0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60,
+    0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60,
+    0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60,
+    0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60,
+    0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60,
+    0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60,
+    0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60,
+    0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60,
+    0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60,
+    0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60,
+    0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60,
+    0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60,
+    0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60,
+    0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60,
+    0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60,
+    0, 60, 0, 60, 0, 60, 0, 60, 0,
+};
+
+// America/New_York: EST5EDT,M4.1.0,M10.5.0 from 2000; EST5EDT,M3.2.0,M11.1.0 from 2007
+inline constexpr uint32_t kAmericaNewYorkUtc[] = {
+    954658800u, 972799200u, 986108400u, 1004248800u, 1018162800u, 1035698400u,
+    1049612400u, 1067148000u, 1081062000u, 1099202400u, 1112511600u, 1130652000u,
+    1143961200u, 1162101600u, 1173596400u, 1194156000u, 1205046000u, 1225605600u,
+    1236495600u, 1257055200u, 1268550000u, 1289109600u, 1299999600u, 1320559200u,
+    1331449200u, 1352008800u, 1362898800u, 1383458400u, 1394348400u, 1414908000u,
+    1425798000u, 1446357600u, 1457852400u, 1478412000u, 1489302000u, 1509861600u,
+    1520751600u, 1541311200u, 1552201200u, 1572760800u, 1583650800u, 1604210400u,
+    1615705200u, 1636264800u, 1647154800u, 1667714400u, 1678604400u, 1699164000u,
+    1710054000u, 1730613600u, 1741503600u, 1762063200u, 1772953200u, 1793512800u,
+    1805007600u, 1825567200u, 1836457200u, 1857016800u, 1867906800u, 1888466400u,
+    1899356400u, 1919916000u, 1930806000u, 1951365600u, 1962860400u, 1983420000u,
+    1994310000u, 2014869600u, 2025759600u, 2046319200u, 2057209200u, 2077768800u,
+    2088658800u, 2109218400u, 2120108400u, 2140668000u, 2152162800u, 2172722400u,
+    2183612400u, 2204172000u, 2215062000u, 2235621600u, 2246511600u, 2267071200u,
+    2277961200u, 2298520800u, 2309410800u, 2329970400u, 2341465200u, 2362024800u,
+    2372914800u, 2393474400u, 2404364400u, 2424924000u, 2435814000u, 2456373600u,
+    2467263600u, 2487823200u, 2499318000u, 2519877600u, 2530767600u, 2551327200u,
+    2562217200u, 2582776800u, 2593666800u, 2614226400u, 2625116400u, 2645676000u,
+    2656566000u, 2677125600u, 2688620400u, 2709180000u, 2720070000u, 2740629600u,
+    2751519600u, 2772079200u, 2782969200u, 2803528800u, 2814418800u, 2834978400u,
+    2846473200u, 2867032800u, 2877922800u, 2898482400u, 2909372400u, 2929932000u,
+    2940822000u, 2961381600u, 2972271600u, 2992831200u, 3003721200u, 3024280800u,
+    3035775600u, 3056335200u, 3067225200u, 3087784800u, 3098674800u, 3119234400u,
+    3130124400u, 3150684000u, 3161574000u, 3182133600u, 3193023600u, 3213583200u,
+    3225078000u, 3245637600u, 3256527600u, 3277087200u, 3287977200u, 3308536800u,
+    3319426800u, 3339986400u, 3350876400u, 3371436000u, 3382930800u, 3403490400u,
+    3414380400u, 3434940000u, 3445830000u, 3466389600u, 3477279600u, 3497839200u,
+    3508729200u, 3529288800u, 3540178800u, 3560738400u, 3572233200u, 3592792800u,
+    3603682800u, 3624242400u, 3635132400u, 3655692000u, 3666582000u, 3687141600u,
+    3698031600u, 3718591200u, 3730086000u, 3750645600u, 3761535600u, 3782095200u,
+    3792985200u, 3813544800u, 3824434800u, 3844994400u, 3855884400u, 3876444000u,
+    3887334000u, 3907893600u, 3919388400u, 3939948000u, 3950838000u, 3971397600u,
+    3982287600u, 4002847200u, 4013737200u, 4034296800u, 4045186800u, 4065746400u,
+    4076636400u, 4097196000u,
+};
+inline constexpr int16_t kAmericaNewYorkOffsetMin[] = {
+    -300, -240, -300, -240, -300, -240, -300, -240, -300, -240, -300, -240,
+    -300, -240, -300, -240, -300, -240, -300, -240, -300, -240, -300, -240,
+    -300, -240, -300, -240, -300, -240, -300, -240, -300, -240, -300, -240,
+    -300, -240, -300, -240, -300, -240, -300, -240, -300, -240, -300, -240,
+    -300, -240, -300, -240, -300, -240, -300, -240, -300, -240, -300, -240,
+    -300, -240, -300, -240, -300, -240, -300, -240, -300, -240, -300, -240,
+    -300, -240, -300, -240, -300, -240, -300, -240, -300, -240, -300, -240,
+    -300, -240, -300, -240, -300, -240, -300, -240, -300, -240, -300, -240,
+    -300, -240, -300, -240, -300, -240, -300, -240, -300, -240, -300, -240,
+    -300, -240, -300, -240, -300, -240, -300, -240, -300, -240, -300, -240,
+    -300, -240, -300, -240, -300, -240, -300, -240, -300, -240, -300, -240,
+    -300, -240, -300, -240, -300, -240, -300, -240, -300, -240, -300, -240,
+    -300, -240, -300, -240, -300, -240, -300, -240, -300, -240, -300, -240,
+    -300, -240, -300, -240, -300, -240, -300, -240, -300, -240, -300, -240,
+    -300, -240, -300, -240, -300, -240, -300, -240, -300, -240, -300, -240,
+    -300, -240, -300, -240, -300, -240, -300, -240, -300, -240, -300, -240,
+    -300, -240, -300, -240, -300, -240, -300, -240, -300,
+};
+
+// America/Los_Angeles: PST8PDT,M4.1.0,M10.5.0 from 2000; PST8PDT,M3.2.0,M11.1.0 from 2007
+inline constexpr uint32_t kAmericaLosAngelesUtc[] = {
+    954669600u, 972810000u, 986119200u, 1004259600u, 1018173600u, 1035709200u,
+    1049623200u, 1067158800u, 1081072800u, 1099213200u, 1112522400u, 1130662800u,
+    1143972000u, 1162112400u, 1173607200u, 1194166800u, 1205056800u, 1225616400u,
+    1236506400u, 1257066000u, 1268560800u, 1289120400u, 1300010400u, 1320570000u,
+    1331460000u, 1352019600u, 1362909600u, 1383469200u, 1394359200u, 1414918800u,
+    1425808800u, 1446368400u, 1457863200u, 1478422800u, 1489312800u, 1509872400u,
+    1520762400u, 1541322000u, 1552212000u, 1572771600u, 1583661600u, 1604221200u,
+    1615716000u, 1636275600u, 1647165600u, 1667725200u, 1678615200u, 1699174800u,
+    1710064800u, 1730624400u, 1741514400u, 1762074000u, 1772964000u, 1793523600u,
+    1805018400u, 1825578000u, 1836468000u, 1857027600u, 1867917600u, 1888477200u,
+    1899367200u, 1919926800u, 1930816800u, 1951376400u, 1962871200u, 1983430800u,
+    1994320800u, 2014880400u, 2025770400u, 2046330000u, 2057220000u, 2077779600u,
+    2088669600u, 2109229200u, 2120119200u, 2140678800u, 2152173600u, 2172733200u,
+    2183623200u, 2204182800u, 2215072800u, 2235632400u, 2246522400u, 2267082000u,
+    2277972000u, 2298531600u, 2309421600u, 2329981200u, 2341476000u, 2362035600u,
+    2372925600u, 2393485200u, 2404375200u, 2424934800u, 2435824800u, 2456384400u,
+    2467274400u, 2487834000u, 2499328800u, 2519888400u, 2530778400u, 2551338000u,
+    2562228000u, 2582787600u, 2593677600u, 2614237200u, 2625127200u, 2645686800u,
+    2656576800u, 2677136400u, 2688631200u, 2709190800u, 2720080800u, 2740640400u,
+    2751530400u, 2772090000u, 2782980000u, 2803539600u, 2814429600u, 2834989200u,
+    2846484000u, 2867043600u, 2877933600u, 2898493200u, 2909383200u, 2929942800u,
+    2940832800u, 2961392400u, 2972282400u, 2992842000u, 3003732000u, 3024291600u,
+    3035786400u, 3056346000u, 3067236000u, 3087795600u, 3098685600u, 3119245200u,
+    3130135200u, 3150694800u, 3161584800u, 3182144400u, 3193034400u, 3213594000u,
+    3225088800u, 3245648400u, 3256538400u, 3277098000u, 3287988000u, 3308547600u,
+    3319437600u, 3339997200u, 3350887200u, 3371446800u, 3382941600u, 3403501200u,
+    3414391200u, 3434950800u, 3445840800u, 3466400400u, 3477290400u, 3497850000u,
+    3508740000u, 3529299600u, 3540189600u, 3560749200u, 3572244000u, 3592803600u,
+    3603693600u, 3624253200u, 3635143200u, 3655702800u, 3666592800u, 3687152400u,
+    3698042400u, 3718602000u, 3730096800u, 3750656400u, 3761546400u, 3782106000u,
+    3792996000u, 3813555600u, 3824445600u, 3845005200u, 3855895200u, 3876454800u,
+    3887344800u, 3907904400u, 3919399200u, 3939958800u, 3950848800u, 3971408400u,
+    3982298400u, 4002858000u, 4013748000u, 4034307600u, 4045197600u, 4065757200u,
+    4076647200u, 4097206800u,
+};
+inline constexpr int16_t kAmericaLosAngelesOffsetMin[] = {
+    -480, -420, -480, -420, -480, -420, -480, -420, -480, -420, -480, -420,
+    -480, -420, -480, -420, -480, -420, -480, -420, -480, -420, -480, -420,
+    -480, -420, -480, -420, -480, -420, -480, -420, -480, -420, -480, -420,
+    -480, -420, -480, -420, -480, -420, -480, -420, -480, -420, -480, -420,
+    -480, -420, -480, -420, -480, -420, -480, -420, -480, -420, -480, -420,
+    -480, -420, -480, -420, -480, -420, -480, -420, -480, -420, -480, -420,
+    -480, -420, -480, -420, -480, -420, -480, -420, -480, -420, -480, -420,
+    -480, -420, -480, -420, -480, -420, -480, -420, -480, -420, -480, -420,
+    -480, -420, -480, -420, -480, -420, -480, -420, -480, -420, -480, -420,
+    -480, -420, -480, -420, -480, -420, -480, -420, -480, -420, -480, -420,
+    -480, -420, -480, -420, -480, -420, -480, -420, -480, -420, -480, -420,
+    -480, -420, -480, -420, -480, -420, -480, -420, -480, -420, -480, -420,
+    -480, -420, -480, -420, -480, -420, -480, -420, -480, -420, -480, -420,
+    -480, -420, -480, -420, -480, -420, -480, -420, -480, -420, -480, -420,
+    -480, -420, -480, -420, -480, -420, -480, -420, -480, -420, -480, -420,
+    -480, -420, -480, -420, -480, -420, -480, -420, -480, -420, -480, -420,
+    -480, -420, -480, -420, -480, -420, -480, -420, -480,
+};
+
+// Asia/Tokyo: JST-9 from 2000
+inline constexpr int16_t kAsiaTokyoOffsetMin[] = {
+    540,
+};
+
+// Australia/Sydney: AEST-10AEDT,M8.5.0,M3.5.0/3 from 2000; AEST-10AEDT,M10.5.0,M3.5.0/3 from 2001; AEST-10AEDT,M10.5.0,M4.1.0/3 from 2006; AEST-10AEDT,M10.5.0,M3.5.0/3 from 2007; AEST-10AEDT,M10.1.0,M4.1.0/3 from 2008
+inline constexpr uint32_t kAustraliaSydneyUtc[] = {
+    954000000u, 967305600u, 985449600u, 1004198400u, 1017504000u, 1035648000u,
+    1048953600u, 1067097600u, 1080403200u, 1099152000u, 1111852800u, 1130601600u,
+    1143907200u, 1162051200u, 1174752000u, 1193500800u, 1207411200u, 1223136000u,
+    1238860800u, 1254585600u, 1270310400u, 1286035200u, 1301760000u, 1317484800u,
+    1333209600u, 1349539200u, 1365264000u, 1380988800u, 1396713600u, 1412438400u,
+    1428163200u, 1443888000u, 1459612800u, 1475337600u, 1491062400u, 1506787200u,
+    1522512000u, 1538841600u, 1554566400u, 1570291200u, 1586016000u, 1601740800u,
+    1617465600u, 1633190400u, 1648915200u, 1664640000u, 1680364800u, 1696089600u,
+    1712419200u, 1728144000u, 1743868800u, 1759593600u, 1775318400u, 1791043200u,
+    1806768000u, 1822492800u, 1838217600u, 1853942400u, 1869667200u, 1885996800u,
+    1901721600u, 1917446400u, 1933171200u, 1948896000u, 1964620800u, 1980345600u,
+    1996070400u, 2011795200u, 2027520000u, 2043244800u, 2058969600u, 2075299200u,
+    2091024000u, 2106748800u, 2122473600u, 2138198400u, 2153923200u, 2169648000u,
+    2185372800u, 2201097600u, 2216822400u, 2233152000u, 2248876800u, 2264601600u,
+    2280326400u, 2296051200u, 2311776000u, 2327500800u, 2343225600u, 2358950400u,
+    2374675200u, 2390400000u, 2406124800u, 2422454400u, 2438179200u, 2453904000u,
+    2469628800u, 2485353600u, 2501078400u, 2516803200u, 2532528000u, 2548252800u,
+    2563977600u, 2579702400u, 2596032000u, 2611756800u, 2627481600u, 2643206400u,
+    2658931200u, 2674656000u, 2690380800u, 2706105600u, 2721830400u, 2737555200u,
+    2753280000u, 2769609600u, 2785334400u, 2801059200u, 2816784000u, 2832508800u,
+    2848233600u, 2863958400u, 2879683200u, 2895408000u, 2911132800u, 2926857600u,
+    2942582400u, 2958912000u, 2974636800u, 2990361600u, 3006086400u, 3021811200u,
+    3037536000u, 3053260800u, 3068985600u, 3084710400u, 3100435200u, 3116764800u,
+    3132489600u, 3148214400u, 3163939200u, 3179664000u, 3195388800u, 3211113600u,
+    3226838400u, 3242563200u, 3258288000u, 3274012800u, 3289737600u, 3306067200u,
+    3321792000u, 3337516800u, 3353241600u, 3368966400u, 3384691200u, 3400416000u,
+    3416140800u, 3431865600u, 3447590400u, 3463315200u, 3479644800u, 3495369600u,
+    3511094400u, 3526819200u, 3542544000u, 3558268800u, 3573993600u, 3589718400u,
+    3605443200u, 3621168000u, 3636892800u, 3653222400u, 3668947200u, 3684672000u,
+    3700396800u, 3716121600u, 3731846400u, 3747571200u, 3763296000u, 3779020800u,
+    3794745600u, 3810470400u, 3826195200u, 3842524800u, 3858249600u, 3873974400u,
+    3889699200u, 3905424000u, 3921148800u, 3936873600u, 3952598400u, 3968323200u,
+    3984048000u, 4000377600u, 4016102400u, 4031827200u, 4047552000u, 4063276800u,
+    4079001600u, 4094726400u,
+};
+inline constexpr int16_t kAustraliaSydneyOffsetMin[] = {
+    660, 600, 660, 600, 660, 600, 660, 600, 660, 600, 660, 600,
+    660, 600, 660, 600, 660, 600, 660, 600, 660, 600, 660, 600,
+    660, 600, 660, 600, 660, 600, 660, 600, 660, 600, 660, 600,
+    660, 600, 660, 600, 660, 600, 660, 600, 660, 600, 660, 600,
+    660, 600, 660, 600, 660, 600, 660, 600, 660, 600, 660, 600,
+    660, 600, 660, 600, 660, 600, 660, 600, 660, 600, 660, 600,
+    660, 600, 660, 600, 660, 600, 660, 600, 660, 600, 660, 600,
+    660, 600, 660, 600, 660, 600, 660, 600, 660, 600, 660, 600,
+    660, 600, 660, 600, 660, 600, 660, 600, 660, 600, 660, 600,
+    660, 600, 660, 600, 660, 600, 660, 600, 660, 600, 660, 600,
+    660, 600, 660, 600, 660, 600, 660, 600, 660, 600, 660, 600,
+    660, 600, 660, 600, 660, 600, 660, 600, 660, 600, 660, 600,
+    660, 600, 660, 600, 660, 600, 660, 600, 660, 600, 660, 600,
+    660, 600, 660, 600, 660, 600, 660, 600, 660, 600, 660, 600,
+    660, 600, 660, 600, 660, 600, 660, 600, 660, 600, 660, 600,
+    660, 600, 660, 600, 660, 600, 660, 600, 660, 600, 660, 600,
+    660, 600, 660, 600, 660, 600, 660, 600, 660,
+};
+
+}  // namespace detail
+
+/// @brief UTC, 0 transitions.
+inline constexpr TimeZone Utc{
+    "UTC", nullptr, detail::kUtcOffsetMin,
+    0};
+
+/// @brief Europe/Prague, 200 transitions.
+inline constexpr TimeZone EuropePrague{
+    "Europe/Prague", detail::kEuropePragueUtc, detail::kEuropePragueOffsetMin,
+    200};
+
+/// @brief Europe/Berlin, 200 transitions.
+inline constexpr TimeZone EuropeBerlin{
+    "Europe/Berlin", detail::kEuropeBerlinUtc, detail::kEuropeBerlinOffsetMin,
+    200};
+
+/// @brief Europe/London, 200 transitions.
+inline constexpr TimeZone EuropeLondon{
+    "Europe/London", detail::kEuropeLondonUtc, detail::kEuropeLondonOffsetMin,
+    200};
+
+/// @brief America/New_York, 200 transitions.
+inline constexpr TimeZone AmericaNewYork{
+    "America/New_York", detail::kAmericaNewYorkUtc, detail::kAmericaNewYorkOffsetMin,
+    200};
+
+/// @brief America/Los_Angeles, 200 transitions.
+inline constexpr TimeZone AmericaLosAngeles{
+    "America/Los_Angeles", detail::kAmericaLosAngelesUtc, detail::kAmericaLosAngelesOffsetMin,
+    200};
+
+/// @brief Asia/Tokyo, 0 transitions.
+inline constexpr TimeZone AsiaTokyo{
+    "Asia/Tokyo", nullptr, detail::kAsiaTokyoOffsetMin,
+    0};
+
+/// @brief Australia/Sydney, 200 transitions.
+inline constexpr TimeZone AustraliaSydney{
+    "Australia/Sydney", detail::kAustraliaSydneyUtc, detail::kAustraliaSydneyOffsetMin,
+    200};
+
+}  // namespace tz
+
+}  // namespace RV3032
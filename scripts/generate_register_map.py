@@ -0,0 +1,436 @@
+#!/usr/bin/env python3
+"""Generate RegisterMap.h and docs/REGISTER_MAP.md from register_map.json.
+
+scripts/register_map.json is the single machine-readable description of the
+RV-3032-C7 register file used by the driver: addresses, implemented bits,
+public raw-access allowlists, the beginBatch() read-cache set, and named bit
+fields. The generated header
+cross-checks every fact that CommandTable.h also spells out, so the two can
+never drift silently.
+
+Standalone commands:
+  sync
+      Regenerate outputs only if the description changed.
+  check
+      Exit with code 1 when generated outputs are out of date.
+"""
+
+from __future__ import annotations
+
+import json
+import sys
+from pathlib import Path
+from typing import Dict, List, Optional, Tuple
+
+DESCRIPTION = Path("scripts") / "register_map.json"
+HEADER = Path("include") / "RV3032" / "RegisterMap.h"
+DOCS = Path("docs") / "REGISTER_MAP.md"
+
+
+def _find_project_root() -> Path:
+    return Path(__file__).resolve().parent.parent
+
+
+def _read_text(path: Path) -> str:
+    with open(path, "r", encoding="utf-8") as handle:
+        return handle.read()
+
+
+def _write_text(path: Path, content: str) -> None:
+    path.parent.mkdir(parents=True, exist_ok=True)
+    with open(path, "w", encoding="utf-8", newline="\n") as handle:
+        handle.write(content)
+
+
+def _parse_byte(value: object, what: str) -> int:
+    parsed = int(str(value), 0)
+    if parsed < 0 or parsed > 0xFF:
+        raise ValueError(f"{what} out of 8-bit range: {value}")
+    return parsed
+
+
+def _struct_name(register_name: str) -> str:
+    return "".join(part.capitalize() for part in register_name.split("_"))
+
+
+def _field_mask(field: Dict[str, object]) -> int:
+    lsb = int(field["lsb"])
+    width = int(field["width"])
+    if width < 1 or lsb < 0 or lsb + width > 8:
+        raise ValueError(f"field {field['name']} does not fit in one byte")
+    return ((1 << width) - 1) << lsb
+
+
+class Register:
+    def __init__(self, raw: Dict[str, object]) -> None:
+        self.name = str(raw["name"])
+        self.struct = str(raw.get("struct", _struct_name(self.name)))
+        self.first = _parse_byte(raw["address"], f"{self.name} address")
+        self.last = _parse_byte(raw.get("last", raw["address"]), f"{self.name} last")
+        if self.last < self.first:
+            raise ValueError(f"{self.name} range is reversed")
+        self.access = str(raw.get("access", ""))
+        self.implemented = _parse_byte(raw.get("implemented", "0xFF"),
+                                       f"{self.name} implemented mask")
+        self.cmd_implemented = raw.get("cmd_implemented")
+        self.cmd_last = raw.get("cmd_last")
+        self.has_cmd = raw.get("cmd", True) is not None
+        self.readable = bool(raw.get("readable", False))
+        self.raw_writable = bool(raw.get("raw_writable", False))
+        self.password = bool(raw.get("password", False))
+        self.volatile = bool(raw.get("volatile", False))
+        self.bcd = bool(raw.get("bcd", False))
+        self.eeprom_backed = bool(raw.get("eeprom_backed", False))
+        self.batch_cacheable = bool(raw.get("batch_cacheable", False))
+        self.fields: List[Dict[str, object]] = list(raw.get("fields", []))
+        used = 0
+        for field in self.fields:
+            mask = _field_mask(field)
+            if used & mask:
+                raise ValueError(f"{self.name}.{field['name']} overlaps another field")
+            used |= mask
+        if used & ~self.implemented & 0xFF:
+            raise ValueError(f"{self.name} fields exceed the implemented mask")
+        if self.raw_writable and not self.readable:
+            raise ValueError(f"{self.name} is raw-writable but not readable")
+        if self.password and (self.readable or self.raw_writable):
+            raise ValueError(f"{self.name} password bytes must stay fail-closed")
+        if self.batch_cacheable and (self.volatile or self.eeprom_backed or
+                                     not self.readable):
+            raise ValueError(
+                f"{self.name} is batch-cacheable but volatile, refreshed, or unreadable"
+            )
+
+    def addresses(self) -> range:
+        return range(self.first, self.last + 1)
+
+    def address_text(self) -> str:
+        if self.first == self.last:
+            return f"0x{self.first:02X}"
+        return f"0x{self.first:02X}-0x{self.last:02X}"
+
+
+def _load_registers(project_root: Path) -> List[Register]:
+    with open(project_root / DESCRIPTION, "r", encoding="utf-8") as handle:
+        data = json.load(handle)
+    registers = [Register(raw) for raw in data["registers"]]
+    seen: Dict[int, str] = {}
+    for register in registers:
+        for address in register.addresses():
+            if address in seen:
+                raise ValueError(
+                    f"0x{address:02X} described by both {seen[address]} and {register.name}"
+                )
+            seen[address] = register.name
+    return sorted(registers, key=lambda register: register.first)
+
+
+def _bitmap(registers: List[Register], predicate) -> List[int]:
+    words = [0] * 8
+    for register in registers:
+        if not predicate(register):
+            continue
+        for address in register.addresses():
+            words[address >> 5] |= 1 << (address & 31)
+    return words
+
+
+def _runs(registers: List[Register]) -> List[Tuple[int, int]]:
+    runs: List[Tuple[int, int]] = []
+    for register in registers:
+        if runs and runs[-1][1] + 1 == register.first:
+            runs[-1] = (runs[-1][0], register.last)
+        else:
+            runs.append((register.first, register.last))
+    return runs
+
+
+def _render_bitmap(name: str, doc: str, words: List[int]) -> str:
+    body = ",\n    ".join(
+        ", ".join(f"0x{word:08X}u" for word in words[index:index + 4])
+        for index in (0, 4)
+    )
+    return (
+        f"/// @brief {doc}\n"
+        f"static constexpr uint32_t {name}[8] = {{\n    {body}}};\n"
+    )
+
+
+def _render_register(register: Register) -> str:
+    lines: List[str] = []
+    lines.append(f"/// @brief {register.name} ({register.address_text()}, {register.access})")
+    lines.append(f"struct {register.struct} {{")
+    lines.append(f"  static constexpr uint8_t ADDRESS = 0x{register.first:02X};")
+    lines.append(
+        f"  static constexpr uint8_t IMPLEMENTED_MASK = 0x{register.implemented:02X};"
+    )
+    for field in register.fields:
+        mask = _field_mask(field)
+        lines.append(f"  /// {field.get('doc', field['name'])}")
+        lines.append(
+            f"  static constexpr Field {field['name']}{{0x{mask:02X}, "
+            f"{int(field['lsb'])}, {int(field['width'])}}};"
+        )
+    lines.append("};")
+    return "\n".join(lines) + "\n"
+
+
+def _render_asserts(registers: List[Register]) -> str:
+    lines: List[str] = []
+    for register in registers:
+        if not register.has_cmd:
+            continue
+        struct = register.struct
+        lines.append(
+            f"static_assert(0x{register.first:02X} == cmd::REG_{register.name}, "
+            f"\"REG_{register.name} drifted from register_map.json\");"
+        )
+        if register.cmd_last:
+            lines.append(
+                f"static_assert(0x{register.last:02X} == cmd::{register.cmd_last}, "
+                f"\"{register.cmd_last} drifted from register_map.json\");"
+            )
+        if register.cmd_implemented:
+            lines.append(
+                f"static_assert({struct}::IMPLEMENTED_MASK == cmd::{register.cmd_implemented}, "
+                f"\"{register.cmd_implemented} drifted from register_map.json\");"
+            )
+        for field in register.fields:
+            ref = f"{struct}::{field['name']}"
+            if field.get("cmd_bit"):
+                lines.append(
+                    f"static_assert({ref}.width == 1 && {ref}.shift == cmd::{field['cmd_bit']}, "
+                    f"\"{field['cmd_bit']} drifted from register_map.json\");"
+                )
+            if field.get("cmd_mask"):
+                lines.append(
+                    f"static_assert({ref}.mask == cmd::{field['cmd_mask']}, "
+                    f"\"{field['cmd_mask']} drifted from register_map.json\");"
+                )
+            if field.get("cmd_shift"):
+                lines.append(
+                    f"static_assert({ref}.shift == cmd::{field['cmd_shift']}, "
+                    f"\"{field['cmd_shift']} drifted from register_map.json\");"
+                )
+    return "\n".join(lines) + "\n"
+
+
+def _render_header(registers: List[Register]) -> str:
+    known = _bitmap(registers, lambda register: True)
+    readable = _bitmap(registers, lambda register: register.readable)
+    writable = _bitmap(registers, lambda register: register.raw_writable)
+    cacheable = _bitmap(registers, lambda register: register.batch_cacheable)
+    runs = _runs(registers)
+    run_text = ", ".join(f"{{0x{first:02X}, 0x{last:02X}}}" for first, last in runs)
+    structs = "\n".join(
+        _render_register(register) for register in registers if register.fields
+    )
+    return f'''/**
+ * @file RegisterMap.h
+ * @brief Generated RV-3032-C7 register map: field accessors and allowlists.
+ *
+ * This file is AUTO-GENERATED by scripts/generate_register_map.py from
+ * scripts/register_map.json. DO NOT EDIT MANUALLY. The static_asserts at the
+ * end pin every overlapping CommandTable.h constant to the same description.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "RV3032/CommandTable.h"
+
+namespace RV3032 {{
+
+namespace regmap {{
+
+/// @brief One contiguous bit field inside an 8-bit register.
+struct Field {{
+  uint8_t mask;
+  uint8_t shift;
+  uint8_t width;
+
+  /// @brief Right-aligned field value extracted from a raw register byte.
+  constexpr uint8_t get(uint8_t raw) const {{
+    return static_cast<uint8_t>((raw & mask) >> shift);
+  }}
+
+  /// @brief Field value sign-extended from its width (two's complement).
+  constexpr int8_t getSigned(uint8_t raw) const {{
+    const int16_t sign = static_cast<int16_t>(1U << (width - 1U));
+    return static_cast<int8_t>((get(raw) ^ sign) - sign);
+  }}
+
+  /// @brief True when any bit of the field is set.
+  constexpr bool test(uint8_t raw) const {{ return (raw & mask) != 0; }}
+
+  /// @brief Right-aligned value moved into field position; excess bits drop.
+  constexpr uint8_t encode(uint8_t value) const {{
+    return static_cast<uint8_t>((value << shift) & mask);
+  }}
+
+  /// @brief Raw byte with this field replaced and every other bit preserved.
+  constexpr uint8_t with(uint8_t raw, uint8_t value) const {{
+    return static_cast<uint8_t>((raw & ~mask) | encode(value));
+  }}
+}};
+
+/// @brief Inclusive address run of contiguously decoded registers.
+struct AddressRun {{
+  uint8_t first;
+  uint8_t last;
+}};
+
+{structs}
+// ===== Allowlists =====
+
+{_render_bitmap("KNOWN_ADDRESS_BITMAP", "Every decoded address, reserved gaps and password bytes included.", known)}
+{_render_bitmap("PUBLIC_READABLE_BITMAP", "Addresses accepted by readRegister()/readRegisters().", readable)}
+{_render_bitmap("RAW_WRITABLE_BITMAP", "Addresses accepted by writeRegister()/writeRegisters().", writable)}
+{_render_bitmap("BATCH_CACHEABLE_BITMAP", "Registers only software changes; served from the beginBatch() cache.", cacheable)}
+/// @brief Contiguous runs of KNOWN_ADDRESS_BITMAP, for O(1) block checks.
+static constexpr AddressRun KNOWN_ADDRESS_RUNS[] = {{{run_text}}};
+
+/// @brief True when @p reg is set in a 256-bit address bitmap.
+constexpr bool contains(const uint32_t (&bitmap)[8], uint8_t reg) {{
+  return ((bitmap[reg >> 5] >> (reg & 31U)) & 1U) != 0;
+}}
+
+/// @brief True when [reg, reg + len) lies inside one decoded address run.
+constexpr bool isKnownBlock(uint8_t reg, size_t len) {{
+  if (len == 0 || len > 256U) {{
+    return false;
+  }}
+  const size_t last = static_cast<size_t>(reg) + len - 1U;
+  for (const AddressRun& run : KNOWN_ADDRESS_RUNS) {{
+    if (reg >= run.first && last <= run.last) {{
+      return true;
+    }}
+  }}
+  return false;
+}}
+
+// ===== CommandTable.h consistency =====
+
+{_render_asserts(registers)}
+}}  // namespace regmap
+
+}}  // namespace RV3032
+'''
+
+
+def _yes(flag: bool) -> str:
+    return "yes" if flag else ""
+
+
+def _render_docs(registers: List[Register]) -> str:
+    rows: List[str] = []
+    for register in registers:
+        notes: List[str] = []
+        if register.bcd:
+            notes.append("BCD")
+        if register.volatile:
+            notes.append("volatile")
+        if register.eeprom_backed:
+            notes.append("EEPROM-backed")
+        if register.password:
+            notes.append("password, fail-closed")
+        if register.batch_cacheable:
+            notes.append("batch-cacheable")
+        rows.append(
+            f"| `{register.address_text()}` | `{register.name}` | {register.access} | "
+            f"`0x{register.implemented:02X}` | {_yes(register.readable)} | "
+            f"{_yes(register.raw_writable)} | {', '.join(notes)} |"
+        )
+    sections: List[str] = []
+    for register in registers:
+        if not register.fields:
+            continue
+        lines = [
+            f"### `{register.name}` (0x{register.first:02X})",
+            "",
+            "| Field | Bits | Mask | Description |",
+            "|---|---|---|---|",
+        ]
+        for field in register.fields:
+            lsb = int(field["lsb"])
+            msb = lsb + int(field["width"]) - 1
+            bits = f"{lsb}" if msb == lsb else f"{msb}:{lsb}"
+            signed = " (signed)" if field.get("signed") else ""
+            lines.append(
+                f"| `{field['name']}` | {bits} | `0x{_field_mask(field):02X}` | "
+                f"{field.get('doc', '')}{signed} |"
+            )
+        sections.append("\n".join(lines))
+    table = "\n".join(rows)
+    fields = "\n\n".join(sections)
+    return f"""# RV3032-C7 register map
+
+This file is generated by `scripts/generate_register_map.py` from
+`scripts/register_map.json`. Do not edit it manually; edit the description and
+run `python scripts/generate_register_map.py sync`. Behavioral notes live in
+[`DEVICE_REFERENCE.md`](DEVICE_REFERENCE.md).
+
+"Public read" and "Raw write" list the addresses accepted by the low-level
+`readRegister()`/`readRegisters()` and `writeRegister()`/`writeRegisters()`
+allowlists. Every other address is reachable only through typed APIs.
+"Batch-cacheable" registers change only through driver writes; between
+`beginBatch()` and `endBatch()` repeated synchronous reads of them are served
+from the first transfer.
+
+| Address | Name | Access | Implemented | Public read | Raw write | Notes |
+|---|---|---|---|---|---|---|
+{table}
+
+## Bit fields
+
+{fields}
+"""
+
+
+def _expected_outputs(project_root: Path) -> Dict[Path, str]:
+    registers = _load_registers(project_root)
+    return {
+        project_root / HEADER: _render_header(registers),
+        project_root / DOCS: _render_docs(registers),
+    }
+
+
+def _sync_outputs(project_root: Path, check_only: bool) -> bool:
+    clean = True
+    for path, expected in _expected_outputs(project_root).items():
+        current: Optional[str] = _read_text(path) if path.exists() else None
+        if current == expected:
+            print(f"Up to date: {path}")
+            continue
+        clean = False
+        if check_only:
+            print(f"Out of date: {path}")
+            continue
+        _write_text(path, expected)
+        print(f"Updated: {path}")
+    return clean
+
+
+def _usage() -> str:
+    return (
+        "Usage:\n"
+        "  scripts/generate_register_map.py sync\n"
+        "  scripts/generate_register_map.py check"
+    )
+
+
+def main(args: List[str]) -> int:
+    project_root = _find_project_root()
+    if not args or args[0] == "sync":
+        _sync_outputs(project_root, check_only=False)
+        return 0
+    if args[0] == "check":
+        return 0 if _sync_outputs(project_root, check_only=True) else 1
+    print(_usage(), file=sys.stderr)
+    return 2
+
+
+if __name__ == "__main__":
+    raise SystemExit(main(sys.argv[1:]))
@@ -0,0 +1,333 @@
+#!/usr/bin/env python3
+"""Generate TimeZones.h UTC-offset transition tables from timezones.json.
+
+scripts/timezones.json lists zones as one or more POSIX TZ rules, each taking
+effect on 1 January of its "from" year. This tool expands every rule over the
+library's 2000..2099 UTC domain into an ascending transition table, so the
+runtime lookup is a binary search with no heap and no string parsing.
+
+Standalone commands:
+  sync
+      Regenerate the header only if the description changed.
+  check
+      Exit with code 1 when the generated header is out of date.
+  verify
+      Compare every generated table against the host zoneinfo database.
+"""
+
+from __future__ import annotations
+
+import calendar
+import json
+import re
+import sys
+from pathlib import Path
+from typing import Dict, List, Optional, Tuple
+
+DESCRIPTION = Path("scripts") / "timezones.json"
+HEADER = Path("include") / "RV3032" / "TimeZones.h"
+
+EPOCH_2000 = 946684800
+END_OF_2099 = 4102444799
+FIRST_YEAR = 2000
+LAST_YEAR = 2099
+# RV3032::localToUtc() probes neighbouring table entries only.
+MIN_TRANSITION_SPACING_S = 2 * 86400
+
+
+def _find_project_root() -> Path:
+    return Path(__file__).resolve().parent.parent
+
+
+def _read_text(path: Path) -> str:
+    with open(path, "r", encoding="utf-8") as handle:
+        return handle.read()
+
+
+def _write_text(path: Path, content: str) -> None:
+    path.parent.mkdir(parents=True, exist_ok=True)
+    with open(path, "w", encoding="utf-8", newline="\n") as handle:
+        handle.write(content)
+
+
+_NAME = r"(?:[A-Za-z]{3,}|<[A-Za-z0-9+-]{3,}>)"
+_OFFSET = r"[+-]?\d{1,3}(?::\d{2}){0,2}"
+_POSIX = re.compile(
+    rf"^(?P<std>{_NAME})(?P<stdoff>{_OFFSET})"
+    rf"(?:(?P<dst>{_NAME})(?P<dstoff>{_OFFSET})?"
+    r",(?P<start>[^,/]+)(?:/(?P<starttime>[^,]+))?"
+    r",(?P<end>[^,/]+)(?:/(?P<endtime>[^,]+))?)?$"
+)
+
+
+def _parse_seconds(text: str) -> int:
+    sign = -1 if text.startswith("-") else 1
+    parts = [int(part) for part in text.lstrip("+-").split(":")]
+    while len(parts) < 3:
+        parts.append(0)
+    if parts[1] > 59 or parts[2] > 59:
+        raise ValueError(f"invalid POSIX time {text}")
+    return sign * (parts[0] * 3600 + parts[1] * 60 + parts[2])
+
+
+def _rule_day(rule: str, year: int) -> int:
+    """Return the 0-based day of year selected by a POSIX date rule."""
+    if rule.startswith("M"):
+        month, week, weekday = (int(part) for part in rule[1:].split("."))
+        if not (1 <= month <= 12 and 1 <= week <= 5 and 0 <= weekday <= 6):
+            raise ValueError(f"invalid POSIX M rule {rule}")
+        first = calendar.weekday(year, month, 1)  # Monday == 0
+        first_sunday_based = (first + 1) % 7
+        day = 1 + (weekday - first_sunday_based) % 7 + (week - 1) * 7
+        days_in_month = calendar.monthrange(year, month)[1]
+        while day > days_in_month:
+            day -= 7
+        return sum(calendar.monthrange(year, m)[1] for m in range(1, month)) + day - 1
+    if rule.startswith("J"):
+        julian = int(rule[1:])
+        if not 1 <= julian <= 365:
+            raise ValueError(f"invalid POSIX J rule {rule}")
+        return julian - 1 + (1 if calendar.isleap(year) and julian >= 60 else 0)
+    day = int(rule)
+    if not 0 <= day <= 365:
+        raise ValueError(f"invalid POSIX day rule {rule}")
+    return day
+
+
+class PosixRule:
+    def __init__(self, text: str) -> None:
+        match = _POSIX.match(text)
+        if not match:
+            raise ValueError(f"unsupported POSIX TZ string {text}")
+        self.text = text
+        # POSIX offsets are west-positive; tables store east-positive UTC offsets.
+        self.std_offset = -_parse_seconds(match["stdoff"])
+        self.has_dst = match["dst"] is not None
+        if self.has_dst:
+            dstoff = match["dstoff"]
+            self.dst_offset = (-_parse_seconds(dstoff) if dstoff
+                               else self.std_offset + 3600)
+            self.start = match["start"]
+            self.end = match["end"]
+            self.start_time = _parse_seconds(match["starttime"] or "2")
+            self.end_time = _parse_seconds(match["endtime"] or "2")
+
+    def transitions(self, year: int) -> List[Tuple[int, int]]:
+        """(UTC instant, new offset) pairs for one calendar year."""
+        if not self.has_dst:
+            return []
+        year_start = calendar.timegm((year, 1, 1, 0, 0, 0))
+        start_local = year_start + _rule_day(self.start, year) * 86400 + self.start_time
+        end_local = year_start + _rule_day(self.end, year) * 86400 + self.end_time
+        return [
+            (start_local - self.std_offset, self.dst_offset),
+            (end_local - self.dst_offset, self.std_offset),
+        ]
+
+
+class Zone:
+    def __init__(self, raw: Dict[str, object]) -> None:
+        self.name = str(raw["name"])
+        self.symbol = str(raw["symbol"])
+        if not re.match(r"^[A-Z][A-Za-z0-9]*$", self.symbol):
+            raise ValueError(f"{self.name} symbol {self.symbol} is not a C++ identifier")
+        rules = sorted(((int(rule["from"]), PosixRule(str(rule["tz"])))
+                        for rule in raw["rules"]), key=lambda item: item[0])
+        if not rules or rules[0][0] != FIRST_YEAR:
+            raise ValueError(f"{self.name} must have a rule from {FIRST_YEAR}")
+        if len({rule.std_offset for _, rule in rules}) != 1:
+            raise ValueError(f"{self.name} rules change standard offset")
+        self.rules = rules
+        self.initial_offset, self.transitions = self._expand()
+
+    def _rule_for(self, year: int) -> PosixRule:
+        chosen = self.rules[0][1]
+        for start_year, rule in self.rules:
+            if start_year <= year:
+                chosen = rule
+        return chosen
+
+    def _expand(self) -> Tuple[int, List[Tuple[int, int]]]:
+        events: List[Tuple[int, int]] = []
+        for year in range(FIRST_YEAR - 1, LAST_YEAR + 2):
+            events.extend(self._rule_for(year).transitions(year))
+        events.sort()
+        offset = self.rules[0][1].std_offset
+        transitions: List[Tuple[int, int]] = []
+        initial: Optional[int] = None
+        for instant, new_offset in events:
+            if instant <= EPOCH_2000:
+                offset = new_offset
+                continue
+            if initial is None:
+                initial = offset
+            if instant > END_OF_2099:
+                break
+            if new_offset != offset:
+                transitions.append((instant, new_offset))
+                offset = new_offset
+        if initial is None:
+            initial = offset
+        for instant, new_offset in [(EPOCH_2000, initial)] + transitions:
+            if new_offset % 60 != 0 or abs(new_offset) > 18 * 3600:
+                raise ValueError(f"{self.name} offset {new_offset} s is not representable")
+        for (first, _), (second, _) in zip(transitions, transitions[1:]):
+            if second - first < MIN_TRANSITION_SPACING_S:
+                raise ValueError(f"{self.name} transitions at {first} and {second} are too close")
+        return initial, transitions
+
+    def offset_at(self, instant: int) -> int:
+        offset = self.initial_offset
+        for transition, new_offset in self.transitions:
+            if transition > instant:
+                break
+            offset = new_offset
+        return offset
+
+
+def _load_zones(project_root: Path) -> List[Zone]:
+    with open(project_root / DESCRIPTION, "r", encoding="utf-8") as handle:
+        data = json.load(handle)
+    zones = [Zone(raw) for raw in data["zones"]]
+    symbols = [zone.symbol for zone in zones]
+    if len(set(symbols)) != len(symbols):
+        raise ValueError("duplicate zone symbol")
+    return zones
+
+
+def _render_words(values: List[str], per_line: int) -> str:
+    lines = []
+    for index in range(0, len(values), per_line):
+        lines.append("    " + ", ".join(values[index:index + per_line]) + ",")
+    return "\n".join(lines)
+
+
+def _render_zone(zone: Zone) -> Tuple[str, str]:
+    rules = "; ".join(f"{rule.text} from {year}" for year, rule in zone.rules)
+    offsets = [zone.initial_offset // 60] + [offset // 60 for _, offset in zone.transitions]
+    lines = [f"// {zone.name}: {rules}"]
+    if zone.transitions:
+        lines.append(f"inline constexpr uint32_t k{zone.symbol}Utc[] = {{")
+        lines.append(_render_words([f"{instant}u" for instant, _ in zone.transitions], 6))
+        lines.append("};")
+        utc = f"detail::k{zone.symbol}Utc"
+    else:
+        utc = "nullptr"
+    lines.append(f"inline constexpr int16_t k{zone.symbol}OffsetMin[] = {{")
+    lines.append(_render_words([str(offset) for offset in offsets], 12))
+    lines.append("};")
+    return "\n".join(lines) + "\n", (
+        f"/// @brief {zone.name}, {len(zone.transitions)} transitions.\n"
+        f"inline constexpr TimeZone {zone.symbol}{{\n"
+        f"    \"{zone.name}\", {utc}, detail::k{zone.symbol}OffsetMin,\n"
+        f"    {len(zone.transitions)}}};\n"
+    )
+
+
+def _render_header(zones: List[Zone]) -> str:
+    tables: List[str] = []
+    handles: List[str] = []
+    for zone in zones:
+        table, handle = _render_zone(zone)
+        tables.append(table)
+        handles.append(handle)
+    return f"""/**
+ * @file TimeZones.h
+ * @brief Generated UTC-offset transition tables for 2000..2099.
+ *
+ * This file is AUTO-GENERATED by scripts/generate_timezones.py from
+ * scripts/timezones.json. DO NOT EDIT MANUALLY. Pass a zone to
+ * RV3032::utcToLocal() or RV3032::localToUtc(); unused zones cost no flash.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#include "RV3032/RV3032.h"
+
+namespace RV3032 {{
+
+namespace tz {{
+
+namespace detail {{
+
+{chr(10).join(tables)}
+}}  // namespace detail
+
+{chr(10).join(handles)}
+}}  // namespace tz
+
+}}  // namespace RV3032
+"""
+
+
+def _expected_outputs(project_root: Path) -> Dict[Path, str]:
+    zones = _load_zones(project_root)
+    return {project_root / HEADER: _render_header(zones)}
+
+
+def _sync_outputs(project_root: Path, check_only: bool) -> bool:
+    clean = True
+    for path, expected in _expected_outputs(project_root).items():
+        current: Optional[str] = _read_text(path) if path.exists() else None
+        if current == expected:
+            print(f"Up to date: {path}")
+            continue
+        clean = False
+        if check_only:
+            print(f"Out of date: {path}")
+            continue
+        _write_text(path, expected)
+        print(f"Updated: {path}")
+    return clean
+
+
+def _verify(project_root: Path) -> bool:
+    from datetime import datetime, timezone
+    from zoneinfo import ZoneInfo
+
+    clean = True
+    for zone in _load_zones(project_root):
+        reference = ZoneInfo(zone.name)
+        probes = set(range(EPOCH_2000, END_OF_2099 + 1, 6 * 3600))
+        for instant, _ in zone.transitions:
+            probes.update((instant - 1, instant))
+        mismatches = 0
+        for instant in sorted(probes):
+            moment = datetime.fromtimestamp(instant, timezone.utc)
+            expected = int(moment.astimezone(reference).utcoffset().total_seconds())
+            if expected != zone.offset_at(instant):
+                mismatches += 1
+                if mismatches <= 3:
+                    print(f"{zone.name}: {moment.isoformat()} table "
+                          f"{zone.offset_at(instant)} s, zoneinfo {expected} s")
+        print(f"{zone.name}: {'OK' if mismatches == 0 else f'{mismatches} mismatches'}")
+        clean = clean and mismatches == 0
+    return clean
+
+
+def _usage() -> str:
+    return (
+        "Usage:\n"
+        "  scripts/generate_timezones.py sync\n"
+        "  scripts/generate_timezones.py check\n"
+        "  scripts/generate_timezones.py verify"
+    )
+
+
+def main(args: List[str]) -> int:
+    project_root = _find_project_root()
+    if not args or args[0] == "sync":
+        _sync_outputs(project_root, check_only=False)
+        return 0
+    if args[0] == "check":
+        return 0 if _sync_outputs(project_root, check_only=True) else 1
+    if args[0] == "verify":
+        return 0 if _verify(project_root) else 1
+    print(_usage(), file=sys.stderr)
+    return 2
+
+
+if __name__ == "__main__":
+    raise SystemExit(main(sys.argv[1:]))
@@ -5,6 +5,7 @@
 
 #include "RV3032/RV3032.h"
 #include "RV3032/CommandTable.h"
+#include "RV3032/RegisterMap.h"
 #include <cmath>
 #include <cstdio>
 #include <cstring>
@@ -25,13 +26,9 @@ constexpr uint32_t PRIMARY_CELL_OPERATION_TIMEOUT_MS = 1000;
 constexpr uint32_t PRIMARY_CELL_WRITE_START_CUTOFF_MS = 500;
 constexpr uint32_t PRIMARY_CELL_MIN_CLEANUP_RESERVE_MS = 300;
 constexpr uint32_t PRIMARY_CELL_TRANSFER_TIMEOUT_MS = 5;
-constexpr uint32_t TWO_TRANSFER_JOB_CALLBACK_CAP = 2;
-constexpr uint32_t VERIFIED_SET_JOB_CALLBACK_CAP = 7;
-constexpr uint32_t VERIFIED_SET_STATUS_WRITE_PREFIX_CAP = 4;
-constexpr uint16_t EEPROM_READY_CHECK_CAP = 256;
-constexpr uint16_t EEPROM_READ_CHECK_CAP = 32;
-constexpr uint16_t EEPROM_WRITE_CHECK_CAP = 101;
-constexpr uint16_t EEPROM_CLEANUP_CHECK_CAP = 256;
+constexpr uint32_t VERIFIED_SET_STATUS_WRITE_PREFIX_CAP = 3;
+// Calendar (0x01..0x07) through Status (0x0D) in one read-only burst.
+constexpr size_t VERIFIED_SET_READBACK_LEN = cmd::REG_STATUS - cmd::REG_SECONDS + 1U;
 constexpr uint8_t kMaxTimerFrequency = static_cast<uint8_t>(TimerFrequency::Hz1_60);
 constexpr uint8_t kMaxClkoutFrequency = static_cast<uint8_t>(ClkoutFrequency::Hz1);
 constexpr uint8_t kMaxEviDebounce = static_cast<uint8_t>(EviDebounce::Hz8);
@@ -39,6 +36,8 @@ constexpr uint32_t kEpoch2000 = 946684800UL;  // 2000-01-01 00:00:00 UTC
 constexpr uint32_t kEndOf2099 = 4102444799UL; // 2099-12-31 23:59:59 UTC
 constexpr float kOffsetPpmPerStep =
     1000000.0f / (32768.0f * 128.0f);
+constexpr float kOffsetPpmMin = -7.6295f;
+constexpr float kOffsetPpmMax = 7.3915f;
 constexpr uint8_t kUserRamSize =
     static_cast<uint8_t>(cmd::REG_USER_RAM_END - cmd::REG_USER_RAM_START + 1U);
 constexpr size_t REGISTER_WRITE_BUFFER_CAPACITY = 16;
@@ -51,6 +50,29 @@ constexpr uint32_t persistentCleanupReserveMs(uint32_t i2cTimeoutMs) {
          6U * i2cTimeoutMs + EEPROM_WRITE_SETTLE_MS;
 }
 
+// Nearest ppb of an offset step. A half-ppb remainder needs
+// steps * 1953125 = 4096 (mod 8192), i.e. a multiple of 4096 steps, so no
+// 6-bit value ties and round-half-away is exact nearest.
+constexpr int32_t offsetStepsToPpb(int32_t steps) {
+  return (steps * RV3032::OFFSET_STEP_PPB_NUM +
+          (steps >= 0 ? 1 : -1) * (RV3032::OFFSET_STEP_PPB_DEN / 2)) /
+         RV3032::OFFSET_STEP_PPB_DEN;
+}
+
+constexpr bool offsetStepsSurvivePpb() {
+  for (int32_t steps = -32; steps <= 31; ++steps) {
+    const int32_t scaled = offsetStepsToPpb(steps) * RV3032::OFFSET_STEP_PPB_DEN;
+    const int32_t half = RV3032::OFFSET_STEP_PPB_NUM / 2;
+    if ((scaled >= 0 ? scaled + half : scaled - half) /
+            RV3032::OFFSET_STEP_PPB_NUM != steps) {
+      return false;
+    }
+  }
+  return true;
+}
+static_assert(offsetStepsSurvivePpb(),
+              "setOffsetPpm() relies on setOffsetPpb() keeping each step");
+
 int16_t decodeTemperatureRaw(const uint8_t* bytes) {
   const uint16_t raw = static_cast<uint16_t>(
       (static_cast<uint16_t>(bytes[1]) << 4) | (bytes[0] >> 4));
@@ -59,6 +81,57 @@ int16_t decodeTemperatureRaw(const uint8_t* bytes) {
       : static_cast<int16_t>(raw);
 }
 
+constexpr size_t TELEMETRY_FRAME_LEN = cmd::REG_TEMP_MSB - cmd::REG_100TH_SECONDS + 1U;
+
+constexpr uint8_t WAKE_FLAG_BURST_START = cmd::REG_STATUS;
+constexpr size_t WAKE_FLAG_BURST_LEN =
+    cmd::REG_TS_EVI_YEAR - cmd::REG_STATUS + 1U;
+
+uint16_t wakeBit(WakeReason reason) {
+  return static_cast<uint16_t>(reason);
+}
+
+uint16_t wakeReasonsFromStatus(uint8_t status) {
+  uint16_t reasons = 0;
+  if (status & (1u << cmd::STATUS_AF_BIT)) reasons |= wakeBit(WakeReason::ALARM);
+  if (status & (1u << cmd::STATUS_TF_BIT)) reasons |= wakeBit(WakeReason::TIMER);
+  if (status & (1u << cmd::STATUS_UF_BIT)) reasons |= wakeBit(WakeReason::UPDATE);
+  if (status & (1u << cmd::STATUS_EVF_BIT)) reasons |= wakeBit(WakeReason::EVENT);
+  if (status & (1u << cmd::STATUS_TLF_BIT)) reasons |= wakeBit(WakeReason::TEMP_LOW);
+  if (status & (1u << cmd::STATUS_THF_BIT)) reasons |= wakeBit(WakeReason::TEMP_HIGH);
+  if (status & (1u << cmd::STATUS_PORF_BIT)) {
+    reasons |= wakeBit(WakeReason::POWER_ON_RESET);
+  }
+  if (status & (1u << cmd::STATUS_VLF_BIT)) {
+    reasons |= wakeBit(WakeReason::VOLTAGE_LOW);
+  }
+  return reasons;
+}
+
+uint16_t wakeReasonsFromTempLsb(uint8_t tempLsb) {
+  uint16_t reasons = 0;
+  if (tempLsb & cmd::TEMP_BSF_MASK) reasons |= wakeBit(WakeReason::BACKUP_SWITCH);
+  if (tempLsb & cmd::TEMP_CLKF_MASK) reasons |= wakeBit(WakeReason::CLOCK_OUTPUT);
+  return reasons;
+}
+
+uint16_t wakeInterruptEnables(uint8_t control2, uint8_t control3) {
+  uint16_t enabled = 0;
+  if (control2 & (1u << cmd::CTRL2_AIE_BIT)) enabled |= wakeBit(WakeReason::ALARM);
+  if (control2 & (1u << cmd::CTRL2_TIE_BIT)) enabled |= wakeBit(WakeReason::TIMER);
+  if (control2 & (1u << cmd::CTRL2_UIE_BIT)) enabled |= wakeBit(WakeReason::UPDATE);
+  if (control2 & (1u << cmd::CTRL2_EIE_BIT)) enabled |= wakeBit(WakeReason::EVENT);
+  if (control2 & (1u << cmd::CTRL2_CLKIE_BIT)) {
+    enabled |= wakeBit(WakeReason::CLOCK_OUTPUT);
+  }
+  if (control3 & (1u << cmd::CTRL3_TLIE_BIT)) enabled |= wakeBit(WakeReason::TEMP_LOW);
+  if (control3 & (1u << cmd::CTRL3_THIE_BIT)) enabled |= wakeBit(WakeReason::TEMP_HIGH);
+  if (control3 & (1u << cmd::CTRL3_BSIE_BIT)) {
+    enabled |= wakeBit(WakeReason::BACKUP_SWITCH);
+  }
+  return enabled;
+}
+
 /// @brief Check if deadline has passed, with wraparound-safe comparison.
 /// Uses signed arithmetic to handle 32-bit millisecond wraparound (~49 days).
 bool hasDeadlinePassed(uint32_t now_ms, uint32_t deadline_ms) {
@@ -72,38 +145,32 @@ Status mapPresenceError(const Status& st) {
   return st;
 }
 
+// Allowlists are generated from scripts/register_map.json.
 bool isKnownRegisterAddress(uint8_t reg) {
-  return reg <= cmd::REG_USER_RAM_END ||
-         (reg >= cmd::CONFIG_EEPROM_START && reg <= cmd::CONFIG_EEPROM_END);
+  return regmap::contains(regmap::KNOWN_ADDRESS_BITMAP, reg);
 }
 
 bool isPublicReadableAddress(uint8_t reg) {
-  return reg <= cmd::REG_TS_EVI_YEAR ||
-         (reg >= cmd::REG_USER_RAM_START && reg <= cmd::REG_USER_RAM_END) ||
-         (reg >= cmd::REG_ACTIVE_PMU && reg <= cmd::REG_ACTIVE_TREFERENCE1);
+  return regmap::contains(regmap::PUBLIC_READABLE_BITMAP, reg);
 }
 
 bool isRawWritableAddress(uint8_t reg) {
-  return reg == cmd::REG_TLOW_THRESHOLD || reg == cmd::REG_THIGH_THRESHOLD ||
-         (reg >= cmd::REG_USER_RAM_START && reg <= cmd::REG_USER_RAM_END);
+  return regmap::contains(regmap::RAW_WRITABLE_BITMAP, reg);
 }
 
 bool isKnownRegisterBlock(uint8_t reg, size_t len) {
-  if (len == 0 || len > 256) {
-    return false;
-  }
-
-  const uint16_t start = reg;
-  const uint16_t end = static_cast<uint16_t>(start + len - 1);
-  if (end > 0xFFu) {
-    return false;
-  }
-
-  return end <= cmd::REG_USER_RAM_END ||
-         (start >= cmd::CONFIG_EEPROM_START &&
-          end <= cmd::CONFIG_EEPROM_END);
+  return regmap::isKnownBlock(reg, len);
 }
 
+static_assert((regmap::BATCH_CACHEABLE_BITMAP[1] |
+               regmap::BATCH_CACHEABLE_BITMAP[2] |
+               regmap::BATCH_CACHEABLE_BITMAP[3] |
+               regmap::BATCH_CACHEABLE_BITMAP[4] |
+               regmap::BATCH_CACHEABLE_BITMAP[5] |
+               regmap::BATCH_CACHEABLE_BITMAP[6] |
+               regmap::BATCH_CACHEABLE_BITMAP[7]) == 0,
+              "beginBatch() cache only covers addresses below 0x20");
+
 bool timestampBlock(TimestampSource source, uint8_t& startReg, size_t& len) {
   switch (source) {
     case TimestampSource::TLow:
@@ -159,9 +226,16 @@ Status RV3032::begin(const Config& config) {
       (config.eepromTimeoutMs < 10 || config.eepromTimeoutMs > 250)) {
     return Status::Error(Err::INVALID_CONFIG, "EEPROM timeout must be 10..250 ms");
   }
+  if (config.persistenceDebounceMs > PERSISTENCE_DEBOUNCE_MAX_MS) {
+    return Status::Error(Err::INVALID_CONFIG,
+                         "Persistence debounce must be 0..60000 ms");
+  }
   if (config.offlineThreshold < 1) {
     return Status::Error(Err::INVALID_CONFIG, "Offline threshold must be at least 1");
   }
+  if (config.reuseTransferTimestamps && config.nowMs == nullptr) {
+    return Status::Error(Err::INVALID_CONFIG, "Timestamp reuse requires nowMs");
+  }
   const uint32_t cleanupReserveMs =
       persistentCleanupReserveMs(config.i2cTimeoutMs);
   if (GENERIC_EEPROM_OPERATION_TIMEOUT_MS <
@@ -186,6 +260,52 @@ void RV3032::end() {
   _resetRuntimeState();
 }
 
+Status RV3032::beginBatch() {
+  if (!_initialized) {
+    return Status::Error(Err::NOT_INITIALIZED, "Call begin() first");
+  }
+  _batch = BatchCache{};
+  _batch.active = true;
+  return Status::Ok();
+}
+
+void RV3032::endBatch() {
+  _batch = BatchCache{};
+}
+
+void RV3032::invalidateValidityCache() {
+  _validityProven = false;
+}
+
+void RV3032::invalidatePersistentCache() {
+  _persistentCache.validMask = 0;
+}
+
+void RV3032::cachePersistentByte(uint8_t address, uint8_t value) {
+  if (!_config.cachePersistentReads || address < cmd::CONFIG_EEPROM_START ||
+      address > cmd::USER_EEPROM_END) {
+    return;
+  }
+  const uint8_t index = static_cast<uint8_t>(address - cmd::CONFIG_EEPROM_START);
+  _persistentCache.values[index] = value;
+  _persistentCache.validMask |= (1ULL << index);
+}
+
+void RV3032::dropPersistentByte(uint8_t address) {
+  if (address < cmd::CONFIG_EEPROM_START || address > cmd::USER_EEPROM_END) {
+    return;
+  }
+  _persistentCache.validMask &=
+      ~(1ULL << (address - cmd::CONFIG_EEPROM_START));
+}
+
+void RV3032::notePowerStatus(uint8_t statusRaw) {
+  if ((statusRaw & ((1u << cmd::STATUS_PORF_BIT) |
+                    (1u << cmd::STATUS_VLF_BIT))) != 0) {
+    invalidatePersistentCache();
+  }
+}
+
 bool RV3032::isEepromBusy() const {
   return _eeprom.state != EepromState::IDLE || _eeprom.queueCount > 0;
 }
@@ -194,6 +314,9 @@ Status RV3032::getEepromStatus() const {
   if (isEepromBusy()) {
     return Status::Error(Err::IN_PROGRESS, "EEPROM update in progress");
   }
+  if (_eeprom.writeBehindCount > 0) {
+    return Status::Error(Err::IN_PROGRESS, "EEPROM write-behind pending");
+  }
   return eepromTerminalStatus();
 }
 
@@ -242,6 +365,200 @@ Status RV3032::getConfigurationJobResult(
   return _job.lastStatus;
 }
 
+bool RV3032::jobResultReady(JobKind kind) const {
+  return kind != JobKind::NONE && _job.activeKind == JobKind::NONE &&
+         _job.completedKind == kind;
+}
+
+namespace {
+
+template <typename T>
+Status viewCompletedJob(bool active, bool completed, const T& report,
+                        const Status& terminal, uint32_t generation,
+                        JobResultView<T>& out) {
+  if (active) {
+    return Status::Error(Err::IN_PROGRESS, "Job in progress");
+  }
+  if (!completed) {
+    return Status::Error(Err::JOB_RESULT_UNAVAILABLE, "Job result unavailable");
+  }
+  out.report = &report;
+  out.generation = generation;
+  return terminal;
+}
+
+}  // namespace
+
+Status RV3032::viewJobResult(JobResultView<ConfigurationJobReport>& out) const {
+  return viewCompletedJob(isConfigurationJobKind(_job.activeKind),
+                          isConfigurationJobKind(_job.completedKind),
+                          _job.configurationReport, _job.lastStatus,
+                          _jobGeneration, out);
+}
+
+Status RV3032::viewJobResult(JobResultView<TimeSnapshot>& out) const {
+  return viewCompletedJob(_job.activeKind == JobKind::READ_TIME_SNAPSHOT,
+                          _job.completedKind == JobKind::READ_TIME_SNAPSHOT,
+                          _job.timeSnapshot, _job.lastStatus, _jobGeneration,
+                          out);
+}
+
+Status RV3032::viewJobResult(JobResultView<WakeReasonReport>& out) const {
+  return viewCompletedJob(_job.activeKind == JobKind::READ_WAKE_REASON,
+                          _job.completedKind == JobKind::READ_WAKE_REASON,
+                          _job.wakeReason, _job.lastStatus, _jobGeneration,
+                          out);
+}
+
+Status RV3032::viewJobResult(JobResultView<TelemetryFrame>& out) const {
+  return viewCompletedJob(_job.activeKind == JobKind::READ_TELEMETRY_FRAME,
+                          _job.completedKind == JobKind::READ_TELEMETRY_FRAME,
+                          _job.telemetryFrame, _job.lastStatus, _jobGeneration,
+                          out);
+}
+
+Status RV3032::viewJobResult(JobResultView<VerifiedTimeSetReport>& out) const {
+  return viewCompletedJob(_job.activeKind == JobKind::SET_TIME_VERIFIED,
+                          _job.completedKind == JobKind::SET_TIME_VERIFIED,
+                          _job.verifiedSet, _job.lastStatus, _jobGeneration,
+                          out);
+}
+
+Status RV3032::viewJobResult(JobResultView<PersistentReadResult>& out) const {
+  return viewCompletedJob(_job.activeKind == JobKind::PERSISTENT_READ,
+                          _job.completedKind == JobKind::PERSISTENT_READ,
+                          _job.persistentRead, _job.lastStatus, _jobGeneration,
+                          out);
+}
+
+Status RV3032::viewJobResult(JobResultView<UserEepromWriteReport>& out) const {
+  return viewCompletedJob(_job.activeKind == JobKind::USER_EEPROM_WRITE,
+                          _job.completedKind == JobKind::USER_EEPROM_WRITE,
+                          _job.userEepromWrite, _job.lastStatus,
+                          _jobGeneration, out);
+}
+
+Status RV3032::viewJobResult(
+    JobResultView<PrimaryCellConfigurationReport>& out) const {
+  return viewCompletedJob(_job.activeKind == JobKind::ENSURE_PRIMARY_CELL,
+                          _job.completedKind == JobKind::ENSURE_PRIMARY_CELL,
+                          _job.primaryCell, _job.lastStatus, _jobGeneration,
+                          out);
+}
+
+Status RV3032::viewJobResult(
+    JobResultView<CoherentTemperatureResult>& out) const {
+  return viewCompletedJob(
+      _job.activeKind == JobKind::READ_COHERENT_TEMPERATURE,
+      _job.completedKind == JobKind::READ_COHERENT_TEMPERATURE,
+      _job.coherentTemperature, _job.lastStatus, _jobGeneration, out);
+}
+
+Status RV3032::planJob(const JobRequest& request, JobPlan& out) {
+  JobPlan plan;
+  bool persistent = false;
+  uint8_t persistentBytes = 0;
+  uint8_t changedBytes = 0;
+  uint8_t writableBytes = 0;
+  if (request.kind != JobKind::NONE &&
+      static_cast<size_t>(request.kind) <
+          sizeof(JOB_CALLBACK_BOUNDS) / sizeof(JOB_CALLBACK_BOUNDS[0])) {
+    // Fixed-cost kinds take the published table as is; the cases below
+    // refine only what the request changes.
+    const JobCallbackBound& bound = jobCallbackBound(request.kind);
+    plan.successCallbacks = bound.successCallbacks;
+    plan.worstCaseCallbacks = bound.worstCaseCallbacks;
+  }
+  switch (request.kind) {
+    case JobKind::SET_TIMER:
+    case JobKind::SET_PERIODIC_UPDATE:
+    case JobKind::SET_CLKOUT_CONFIG:
+    case JobKind::SET_TEMPERATURE_EVENT_CONFIG:
+    case JobKind::TEMP_LSB_FLAG_CLEAR:
+    case JobKind::READ_COHERENT_TEMPERATURE:
+    case JobKind::SET_TIME_VERIFIED:
+    case JobKind::READ_TELEMETRY_FRAME:
+      break;
+    case JobKind::REGISTER_UPDATE:
+      // startRegisterUpdateJob() reads and writes once; the table's third
+      // callback belongs to the guarded EVI reset.
+      plan.successCallbacks = TWO_TRANSFER_JOB_CALLBACK_CAP;
+      break;
+    case JobKind::SET_BACKUP_SWITCH_MODE:
+      // Control 3 and PMU reads; a mode change adds the PMU write and
+      // readback, and leaving Off adds the activation settle.
+      if (request.backupMode == request.backupCurrentMode) {
+        plan.successCallbacks = 2;
+        break;
+      }
+      if (request.backupCurrentMode == BackupSwitchMode::Off) {
+        if (request.backupMode == BackupSwitchMode::Direct) {
+          plan.minimumDurationMs = 2;
+        } else if (request.backupMode == BackupSwitchMode::Level) {
+          plan.minimumDurationMs = 10;
+        }
+      }
+      break;
+    case JobKind::WRITE_USER_RAM:
+      if (request.length == 0 || request.length > kUserRamSize) {
+        return Status::Error(Err::INVALID_PARAM, "User RAM plan length out of range");
+      }
+      plan.successCallbacks = static_cast<uint32_t>(
+          (request.length + REGISTER_WRITE_PAYLOAD_CAPACITY - 1U) /
+          REGISTER_WRITE_PAYLOAD_CAPACITY);
+      plan.worstCaseCallbacks = plan.successCallbacks;
+      break;
+    case JobKind::READ_TIME_SNAPSHOT:
+      // A validity-cache hit skips the status read; the worst case keeps it
+      // because the cache can expire between planning and starting.
+      if (request.validityCached) {
+        plan.successCallbacks = 1;
+      }
+      break;
+    case JobKind::READ_WAKE_REASON:
+      plan.successCallbacks = 1;
+      if (!request.acknowledgeWake) plan.worstCaseCallbacks = 1;
+      break;
+    case JobKind::PERSISTENT_READ:
+      persistent = true;
+      persistentBytes = request.length;
+      break;
+    case JobKind::USER_EEPROM_WRITE:
+      persistent = true;
+      persistentBytes = request.length;
+      changedBytes = request.changedBytes;
+      writableBytes = request.length;
+      break;
+    case JobKind::ENSURE_PRIMARY_CELL:
+      persistent = true;
+      persistentBytes = 1;
+      changedBytes = request.changedBytes;
+      writableBytes = 1;
+      break;
+    case JobKind::NONE:
+    default:
+      return Status::Error(Err::INVALID_PARAM, "No job to plan");
+  }
+
+  if (persistent) {
+    if (persistentBytes == 0 || persistentBytes > USER_EEPROM_JOB_MAX_BYTES ||
+        changedBytes > writableBytes) {
+      return Status::Error(Err::INVALID_PARAM, "Persistent plan bounds out of range");
+    }
+    plan.successCallbacks =
+        persistentSuccessCallbacks(persistentBytes, changedBytes) -
+        (request.activePmuSafe ? 1U : 0U);
+    plan.worstCaseCallbacks =
+        persistentWorstCaseCallbacks(persistentBytes, writableBytes);
+    plan.minimumDurationMs =
+        persistentBytes * 2U * EEPROM_READ_SETTLE_MS +
+        changedBytes * (EEPROM_WRITE_SETTLE_MS + 2U * EEPROM_READ_SETTLE_MS) +
+        EEPROM_WRITE_SETTLE_MS;
+  }
+  out = plan;
+  return Status::Ok();
+}
+
 Status RV3032::getSetTimerJobResult(ConfigurationJobReport& out) const {
   return getConfigurationJobResult(
       JobKind::SET_TIMER, "Timer configuration in progress",
@@ -295,7 +612,7 @@ Status RV3032::startSetTimerJob(uint16_t ticks, TimerFrequency freq, bool enable
     return Status::Error(Err::INVALID_PARAM, "Timer frequency out of range");
   }
 
-  _job = JobOp{};
+  resetJob();
   _job.timerTargetPreset[0] = static_cast<uint8_t>(ticks & 0xFFu);
   _job.timerTargetPreset[1] = static_cast<uint8_t>((ticks >> 8) & 0x0Fu);
   _job.timerTargetControl1 = static_cast<uint8_t>(freqRaw & cmd::CTRL1_TD_MASK);
@@ -305,7 +622,7 @@ Status RV3032::startSetTimerJob(uint16_t ticks, TimerFrequency freq, bool enable
   }
   _job.activeKind = JobKind::SET_TIMER;
   _job.lastStatus = Status::Error(Err::IN_PROGRESS, "Job in progress");
-  _job.state = JobState::TIMER_READ_CONTROL2_GUARD;
+  _job.state = JobState::TIMER_READ_CONTROLS;
   return _job.lastStatus;
 }
 
@@ -320,7 +637,7 @@ Status RV3032::startRegisterUpdateJob(uint8_t reg, uint8_t clearMask, uint8_t se
     return Status::Error(Err::INVALID_PARAM, "Register update is not allowlisted");
   }
 
-  _job = JobOp{};
+  resetJob();
   _job.registerUpdateReg = reg;
   _job.registerUpdateImplementedMask = 0xFF;
   _job.registerUpdateClearMask = clearMask;
@@ -346,7 +663,7 @@ Status RV3032::startWriteUserRamJob(uint8_t offset, const uint8_t* buf, size_t l
     return Status::Error(Err::INVALID_PARAM, "User RAM write out of range");
   }
 
-  _job = JobOp{};
+  resetJob();
   _job.userRamOffset = offset;
   _job.userRamLen = static_cast<uint8_t>(len);
   std::memcpy(_job.userRamBuf, buf, len);
@@ -365,35 +682,12 @@ Status RV3032::pollJob(uint32_t now_ms, uint8_t maxInstructions, uint8_t& instru
       _job.activeKind == JobKind::NONE && _job.state != JobState::IDLE) {
     return Status::Error(Err::BUSY, "EEPROM queue owns the shared engine");
   }
-  const auto isConfigurationKind = [&](JobKind kind) -> bool {
-    return kind == JobKind::SET_TIMER ||
-           kind == JobKind::SET_PERIODIC_UPDATE ||
-           kind == JobKind::SET_BACKUP_SWITCH_MODE ||
-           kind == JobKind::SET_CLKOUT_CONFIG ||
-           kind == JobKind::SET_TEMPERATURE_EVENT_CONFIG;
-  };
-  const auto configurationRecoveryState = [&](JobKind kind) -> JobState {
-    switch (kind) {
-      case JobKind::SET_TIMER:
-        return JobState::TIMER_CLEANUP_READ;
-      case JobKind::SET_PERIODIC_UPDATE:
-        return JobState::PERIODIC_CLEANUP_READ;
-      case JobKind::SET_BACKUP_SWITCH_MODE:
-        return JobState::BACKUP_VERIFY_PMU;
-      case JobKind::SET_CLKOUT_CONFIG:
-        return JobState::CLKOUT_CLEANUP_READ;
-      case JobKind::SET_TEMPERATURE_EVENT_CONFIG:
-        return JobState::TEMPERATURE_CLEANUP_READ;
-      default:
-        return JobState::IDLE;
-    }
-  };
   if (!isJobBusy()) {
     if (_job.activeKind != JobKind::NONE) {
       const Status internal = Status::Error(
           Err::INTERNAL_STATE_ERROR, "Active job has idle state",
           static_cast<int32_t>(_job.activeKind));
-      if (isConfigurationKind(_job.activeKind)) {
+      if (isConfigurationJobKind(_job.activeKind)) {
         if (!_job.configurationReport.mutationAttempted) {
           if (_job.configurationReport.operationStatus.ok()) {
             _job.configurationReport.operationStatus = internal;
@@ -427,7 +721,8 @@ Status RV3032::pollJob(uint32_t now_ms, uint8_t maxInstructions, uint8_t& instru
         _job.configurationReport.operationStatus = internal;
         _job.state = configurationRecoveryState(_job.activeKind);
       } else if ((_job.activeKind == JobKind::PERSISTENT_READ ||
-                  _job.activeKind == JobKind::USER_EEPROM_WRITE) &&
+                  _job.activeKind == JobKind::USER_EEPROM_WRITE ||
+                  _job.activeKind == JobKind::ENSURE_PRIMARY_CELL) &&
                  _job.persistentCleanupRequired) {
         if (_job.persistentOperationStatus.ok()) {
           _job.persistentOperationStatus = internal;
@@ -445,12 +740,14 @@ Status RV3032::pollJob(uint32_t now_ms, uint8_t maxInstructions, uint8_t& instru
   }
 
   uint32_t currentNowMs = now_ms;
+  _clockStampValid = false;
   while (isJobBusy() && instructionsUsed < maxInstructions) {
-    if (_config.nowMs != nullptr) {
+    if (_config.nowMs != nullptr && !_clockStampCurrent(currentNowMs)) {
       const uint32_t observedNowMs = _nowMs();
       if (static_cast<int32_t>(observedNowMs - currentNowMs) > 0) {
         currentNowMs = observedNowMs;
       }
+      _noteClockStamp(currentNowMs);
     }
     if (_job.deadlineActive &&
         hasDeadlinePassed(currentNowMs, _job.deadlineMs)) {
@@ -585,7 +882,8 @@ Status RV3032::pollJob(uint32_t now_ms, uint8_t maxInstructions, uint8_t& instru
           ConfigurationFinalState::REQUESTED_VERIFIED;
       if (_job.configurationReport.operationStatus.ok() &&
           _job.persistRegisterUpdate &&
-          !eepromQueuePush(cmd::REG_ACTIVE_PMU, _job.backupTargetPmu)) {
+          !queuePersistence(cmd::REG_ACTIVE_PMU, _job.backupTargetPmu,
+                            currentNowMs)) {
         rememberConfigurationOperationFailure(Status::Error(
             Err::QUEUE_FULL, "Backup persistence queue full"));
       }
@@ -594,25 +892,19 @@ Status RV3032::pollJob(uint32_t now_ms, uint8_t maxInstructions, uint8_t& instru
 
     Status st = Status::Ok();
     switch (_job.state) {
-      case JobState::TIMER_READ_CONTROL2_GUARD: {
-        uint8_t control2 = 0;
-        st = readJob(cmd::REG_CONTROL2, &control2, 1);
+      case JobState::TIMER_READ_CONTROLS: {
+        // Control 1 (original) and Control 2 (TIE guard) in one burst.
+        uint8_t controls[2] = {};
+        st = readJob(cmd::REG_CONTROL1, controls, sizeof(controls));
         if (!st.ok()) {
           return failConfiguration(st, JobState::TIMER_CLEANUP_READ);
         }
-        if ((control2 & (1u << cmd::CTRL2_TIE_BIT)) != 0) {
+        if ((controls[1] & (1u << cmd::CTRL2_TIE_BIT)) != 0) {
           st = Status::Error(
               Err::BUSY, "Disable timer interrupt before configuration");
           return failConfiguration(st, JobState::TIMER_CLEANUP_READ);
         }
-        _job.state = JobState::TIMER_READ_CONTROL1;
-        break;
-      }
-      case JobState::TIMER_READ_CONTROL1: {
-        st = readJob(cmd::REG_CONTROL1, &_job.timerOriginalControl1, 1);
-        if (!st.ok()) {
-          return failConfiguration(st, JobState::TIMER_CLEANUP_READ);
-        }
+        _job.timerOriginalControl1 = controls[0];
         const uint8_t timerMask = static_cast<uint8_t>(
             cmd::CTRL1_TD_MASK | (1u << cmd::CTRL1_TE_BIT));
         _job.timerOriginalControl1 = static_cast<uint8_t>(
@@ -857,7 +1149,7 @@ Status RV3032::pollJob(uint32_t now_ms, uint8_t maxInstructions, uint8_t& instru
         if (_job.persistRegisterUpdate &&
             !eepromQueueContains(cmd::REG_ACTIVE_PMU,
                                  _job.backupTargetPmu) &&
-            _eeprom.queueCount >= kEepromQueueSize) {
+            persistenceCapacity() == 0) {
           st = Status::Error(Err::QUEUE_FULL,
                              "Backup persistence queue full");
           return failConfiguration(st, JobState::BACKUP_VERIFY_PMU);
@@ -960,21 +1252,49 @@ Status RV3032::pollJob(uint32_t now_ms, uint8_t maxInstructions, uint8_t& instru
         }
         return finishBackupRequested();
       case JobState::REGISTER_UPDATE_READ_QUIESCENCE: {
-        uint8_t guard = 0;
-        st = readJob(_job.quiescenceGuard.reg, &guard, 1);
+        // When the guard register sits next to the target (at most one
+        // filler register apart), read both in one burst and hand the target
+        // bytes to the next state instead of re-reading them.
+        uint8_t targetReg = _job.registerUpdateReg;
+        uint8_t targetLen = 1;
+        uint8_t* targetData = &_job.registerUpdateValue;
+        if (_job.quiescenceNextState == JobState::REGISTER_BLOCK_UPDATE_READ) {
+          targetReg = _job.registerBlockReg;
+          targetLen = _job.registerBlockLen;
+          targetData = _job.registerBlockValues;
+        } else if (_job.quiescenceNextState == JobState::EVI_RESET_READ) {
+          targetReg = cmd::REG_TS_CONTROL;
+        }
+        const uint8_t guardReg = _job.quiescenceGuard.reg;
+        const uint16_t targetLast =
+            static_cast<uint16_t>(targetReg + targetLen - 1U);
+        const uint8_t first = guardReg < targetReg ? guardReg : targetReg;
+        const uint16_t last = guardReg > targetLast ? guardReg : targetLast;
+        const size_t span = static_cast<size_t>(last - first + 1U);
+        const bool fused = span <= static_cast<size_t>(targetLen) + 2U;
+        uint8_t window[sizeof(_job.registerBlockValues) + 2] = {};
+        const uint8_t readReg = fused ? first : guardReg;
+        st = readJob(readReg, window, fused ? span : 1U);
         if (!st.ok()) {
           return finishJob(st);
         }
+        const uint8_t guard = window[guardReg - readReg];
         if ((guard & _job.quiescenceGuard.forbiddenMask) != 0) {
           st = Status::Error(
               Err::BUSY, "Disable interrupt before reconfiguration");
           return finishJob(st);
         }
+        if (fused) {
+          std::memcpy(targetData, window + (targetReg - readReg), targetLen);
+        }
+        _job.quiescencePrefetched = fused;
         _job.state = _job.quiescenceNextState;
         break;
       }
       case JobState::REGISTER_UPDATE_READ:
-        st = readJob(_job.registerUpdateReg, &_job.registerUpdateValue, 1);
+        st = _job.quiescencePrefetched
+            ? Status::Ok()
+            : readJob(_job.registerUpdateReg, &_job.registerUpdateValue, 1);
         if (!st.ok()) {
           return finishJob(st);
         }
@@ -1005,7 +1325,7 @@ Status RV3032::pollJob(uint32_t now_ms, uint8_t maxInstructions, uint8_t& instru
         if (_job.persistRegisterUpdate &&
             !eepromQueueContains(_job.registerUpdateReg,
                                  _job.registerUpdateValue) &&
-            _eeprom.queueCount >= kEepromQueueSize) {
+            persistenceCapacity() == 0) {
           st = Status::Error(Err::QUEUE_FULL,
                              "Configuration persistence queue full");
           return finishJob(st);
@@ -1018,8 +1338,8 @@ Status RV3032::pollJob(uint32_t now_ms, uint8_t maxInstructions, uint8_t& instru
           return finishJob(st);
         }
         if (_job.persistRegisterUpdate &&
-            !eepromQueuePush(_job.registerUpdateReg,
-                             _job.registerUpdateValue)) {
+            !queuePersistence(_job.registerUpdateReg,
+                              _job.registerUpdateValue, currentNowMs)) {
           st = Status::Error(Err::QUEUE_FULL,
                              "Configuration persistence queue full");
           return finishJob(st);
@@ -1047,7 +1367,9 @@ Status RV3032::pollJob(uint32_t now_ms, uint8_t maxInstructions, uint8_t& instru
         st = writeJob(cmd::REG_TEMP_LSB, &_job.registerUpdateValue, 1);
         return finishJob(st);
       case JobState::EVI_RESET_READ: {
-        st = readJob(cmd::REG_TS_CONTROL, &_job.registerUpdateValue, 1);
+        st = _job.quiescencePrefetched
+            ? Status::Ok()
+            : readJob(cmd::REG_TS_CONTROL, &_job.registerUpdateValue, 1);
         if (!st.ok()) {
           return finishJob(st);
         }
@@ -1083,7 +1405,9 @@ Status RV3032::pollJob(uint32_t now_ms, uint8_t maxInstructions, uint8_t& instru
         }
         return finishJob(Status::Ok());
       case JobState::REGISTER_BLOCK_UPDATE_READ:
-        st = readJob(_job.registerBlockReg, _job.registerBlockValues,
+        st = _job.quiescencePrefetched
+            ? Status::Ok()
+            : readJob(_job.registerBlockReg, _job.registerBlockValues,
                       _job.registerBlockLen);
         if (!st.ok()) {
           return finishJob(st);
@@ -1104,8 +1428,7 @@ Status RV3032::pollJob(uint32_t now_ms, uint8_t maxInstructions, uint8_t& instru
               ++requiredCapacity;
             }
           }
-          if (requiredCapacity >
-              static_cast<uint8_t>(kEepromQueueSize - _eeprom.queueCount)) {
+          if (requiredCapacity > persistenceCapacity()) {
             st = Status::Error(
                 Err::QUEUE_FULL,
                 "Configuration persistence queue lacks capacity");
@@ -1119,9 +1442,9 @@ Status RV3032::pollJob(uint32_t now_ms, uint8_t maxInstructions, uint8_t& instru
                        _job.registerBlockLen);
         if (st.ok() && _job.persistRegisterUpdate) {
           for (uint8_t i = 0; i < _job.registerBlockLen; ++i) {
-            if (!eepromQueuePush(
+            if (!queuePersistence(
                     static_cast<uint8_t>(_job.registerBlockReg + i),
-                    _job.registerBlockValues[i])) {
+                    _job.registerBlockValues[i], currentNowMs)) {
               st = Status::Error(Err::QUEUE_FULL,
                                  "Configuration persistence queue full");
               break;
@@ -1163,8 +1486,7 @@ Status RV3032::pollJob(uint32_t now_ms, uint8_t maxInstructions, uint8_t& instru
               ++requiredCapacity;
             }
           }
-          if (requiredCapacity >
-              static_cast<uint8_t>(kEepromQueueSize - _eeprom.queueCount)) {
+          if (requiredCapacity > persistenceCapacity()) {
             st = Status::Error(
                 Err::QUEUE_FULL,
                 "CLKOUT persistence queue lacks capacity");
@@ -1231,9 +1553,9 @@ Status RV3032::pollJob(uint32_t now_ms, uint8_t maxInstructions, uint8_t& instru
         if (_job.persistRegisterUpdate &&
             _job.configurationReport.operationStatus.ok()) {
           for (uint8_t index : CLKOUT_PERSIST_INDEXES) {
-            if (!eepromQueuePush(
+            if (!queuePersistence(
                     static_cast<uint8_t>(cmd::REG_ACTIVE_PMU + index),
-                    _job.clkoutTarget[index])) {
+                    _job.clkoutTarget[index], currentNowMs)) {
               st = Status::Error(Err::QUEUE_FULL,
                                  "CLKOUT persistence queue full");
               rememberConfigurationOperationFailure(st);
@@ -1485,9 +1807,11 @@ Status RV3032::pollJob(uint32_t now_ms, uint8_t maxInstructions, uint8_t& instru
         }
         _job.timeSnapshot.statusFlags =
             decodeStatusFlags(_job.timeSnapshot.statusRaw);
+        notePowerStatus(_job.timeSnapshot.statusRaw);
         _job.timeSnapshot.statusValid = true;
         if (_job.timeSnapshot.statusFlags.powerOnReset ||
             _job.timeSnapshot.statusFlags.voltageLow) {
+          _validityProven = false;
           return finishJob(Status::Ok());
         }
         _job.state = JobState::READ_TIME_CALENDAR;
@@ -1498,20 +1822,216 @@ Status RV3032::pollJob(uint32_t now_ms, uint8_t maxInstructions, uint8_t& instru
           return finishJob(st);
         }
         if (!decodeCalendar(_job.calendarBuf, _job.timeSnapshot.time)) {
+          _validityProven = false;
           st = Status::Error(Err::INVALID_DATETIME, "Invalid calendar encoding");
           return finishJob(st);
         }
         _job.timeSnapshot.timeValid = true;
+        if (_config.snapshotValidityMaxAgeMs != 0) {
+          _validityProvenMs = _job.timeSnapshotStartMs;
+          _validityProven = true;
+        }
+        return finishJob(Status::Ok());
+      case JobState::READ_TIME_FUSED: {
+        // Status follows the calendar in the same burst, so a PORF/VLF that
+        // asserted since the cached proof still voids this calendar.
+        uint8_t observed[VERIFIED_SET_READBACK_LEN] = {};
+        st = readJob(cmd::REG_SECONDS, observed, sizeof(observed));
+        if (!st.ok()) {
+          _validityProven = false;
+          return finishJob(st);
+        }
+        TimeSnapshot& snapshot = _job.timeSnapshot;
+        snapshot.cachedValidity = true;
+        snapshot.statusRaw = observed[cmd::REG_STATUS - cmd::REG_SECONDS];
+        snapshot.statusFlags = decodeStatusFlags(snapshot.statusRaw);
+        snapshot.statusValid = true;
+        notePowerStatus(snapshot.statusRaw);
+        if (snapshot.statusFlags.powerOnReset || snapshot.statusFlags.voltageLow) {
+          _validityProven = false;
+          return finishJob(Status::Ok());
+        }
+        if (!decodeCalendar(observed, snapshot.time)) {
+          _validityProven = false;
+          st = Status::Error(Err::INVALID_DATETIME, "Invalid calendar encoding");
+          return finishJob(st);
+        }
+        snapshot.timeValid = true;
+        return finishJob(Status::Ok());
+      }
+      case JobState::WAKE_READ_FLAGS: {
+        uint8_t burst[WAKE_FLAG_BURST_LEN] = {};
+        st = readJob(WAKE_FLAG_BURST_START, burst, sizeof(burst));
+        if (!st.ok()) {
+          return finishJob(st);
+        }
+        const auto at = [&](uint8_t reg) -> const uint8_t* {
+          return &burst[reg - WAKE_FLAG_BURST_START];
+        };
+        WakeReasonReport& report = _job.wakeReason;
+        report.statusRaw = *at(cmd::REG_STATUS);
+        report.tempLsbRaw = *at(cmd::REG_TEMP_LSB);
+        report.statusFlags = decodeStatusFlags(report.statusRaw);
+        notePowerStatus(report.statusRaw);
+        report.reasons = static_cast<uint16_t>(
+            wakeReasonsFromStatus(report.statusRaw) |
+            wakeReasonsFromTempLsb(report.tempLsbRaw));
+        report.interruptEnabled = wakeInterruptEnables(
+            *at(cmd::REG_CONTROL2), *at(cmd::REG_CONTROL3));
+        report.flagsValid = true;
+        const auto decodeFlagged = [&](WakeReason reason,
+                                       TimestampSource source,
+                                       Timestamp& out) -> Status {
+          uint8_t startReg = 0;
+          size_t len = 0;
+          if (!report.has(reason) || !timestampBlock(source, startReg, len)) {
+            return Status::Ok();
+          }
+          return decodeTimestamp(source, at(startReg), len, out);
+        };
+        st = decodeFlagged(WakeReason::EVENT, TimestampSource::Evi,
+                           report.eventTimestamp);
+        if (st.ok()) {
+          st = decodeFlagged(WakeReason::TEMP_LOW, TimestampSource::TLow,
+                             report.tempLowTimestamp);
+        }
+        if (st.ok()) {
+          st = decodeFlagged(WakeReason::TEMP_HIGH, TimestampSource::THigh,
+                             report.tempHighTimestamp);
+        }
+        if (!st.ok()) {
+          return finishJob(st);
+        }
+        if (!_job.wakeAcknowledge) {
+          return finishJob(Status::Ok());
+        }
+        // THF/TLF clear on any Status write, so they are named only when
+        // observed. PORF, VLF, EEF, and flags asserting after this read are
+        // written as 1 and preserved.
+        _job.wakeStatusAck = static_cast<uint8_t>(
+            report.statusRaw &
+            ((1u << cmd::STATUS_AF_BIT) | (1u << cmd::STATUS_TF_BIT) |
+             (1u << cmd::STATUS_UF_BIT) | (1u << cmd::STATUS_EVF_BIT) |
+             (1u << cmd::STATUS_THF_BIT) | (1u << cmd::STATUS_TLF_BIT)));
+        _job.wakeTempLsbAck = static_cast<uint8_t>(
+            report.tempLsbRaw & (cmd::TEMP_BSF_MASK | cmd::TEMP_CLKF_MASK));
+        if (_job.wakeStatusAck != 0) {
+          _job.state = JobState::WAKE_ACK_STATUS;
+          break;
+        }
+        if (_job.wakeTempLsbAck == 0) {
+          return finishJob(Status::Ok());
+        }
+        if ((report.tempLsbRaw & cmd::EEPROM_BUSY_MASK) != 0) {
+          st = Status::Error(Err::BUSY, "EEPROM engine is busy");
+          return finishJob(st);
+        }
+        _job.state = JobState::WAKE_ACK_TEMP_LSB;
+        break;
+      }
+      case JobState::WAKE_ACK_STATUS: {
+        const uint8_t payload = static_cast<uint8_t>(
+            cmd::STATUS_W0C_PRESERVE_MASK & ~_job.wakeStatusAck);
+        st = writeJob(cmd::REG_STATUS, &payload, 1);
+        if (!st.ok()) {
+          return finishJob(st);
+        }
+        _job.wakeReason.acknowledged = static_cast<uint16_t>(
+            _job.wakeReason.acknowledged |
+            wakeReasonsFromStatus(_job.wakeStatusAck));
+        if (_job.wakeTempLsbAck == 0) {
+          return finishJob(Status::Ok());
+        }
+        if ((_job.wakeReason.tempLsbRaw & cmd::EEPROM_BUSY_MASK) != 0) {
+          st = Status::Error(Err::BUSY, "EEPROM engine is busy");
+          return finishJob(st);
+        }
+        _job.state = JobState::WAKE_ACK_TEMP_LSB;
+        break;
+      }
+      case JobState::WAKE_ACK_TEMP_LSB: {
+        const uint8_t payload = static_cast<uint8_t>(
+            cmd::TEMP_LSB_W0C_MASK & ~_job.wakeTempLsbAck);
+        st = writeJob(cmd::REG_TEMP_LSB, &payload, 1);
+        if (!st.ok()) {
+          return finishJob(st);
+        }
+        _job.wakeReason.acknowledged = static_cast<uint16_t>(
+            _job.wakeReason.acknowledged |
+            wakeReasonsFromTempLsb(_job.wakeTempLsbAck));
         return finishJob(Status::Ok());
-      case JobState::SET_TIME_READ_STATUS_BEFORE:
+      }
+      case JobState::TELEMETRY_READ_FRAME: {
+        uint8_t frame[TELEMETRY_FRAME_LEN] = {};
+        st = readJob(cmd::REG_100TH_SECONDS, frame, sizeof(frame));
+        if (!st.ok()) {
+          return finishJob(st);
+        }
+        decodeTelemetryFrame(frame, _job.telemetryFrame);
+        notePowerStatus(_job.telemetryFrame.statusRaw);
+        return finishJob(Status::Ok());
+      }
+      case JobState::SET_TIME_READ_STATUS_BEFORE: {
+        const uint32_t readStartedAtMs = currentNowMs;
         st = readJob(cmd::REG_STATUS, &_job.verifiedSet.statusBefore, 1);
         if (!st.ok()) {
           return finishJob(st);
         }
         _job.verifiedSet.statusBeforeValid = true;
+        notePowerStatus(_job.verifiedSet.statusBefore);
+        if (_job.verifiedSet.aligned) {
+          // The one-byte read is the latency sample; the calendar write is
+          // dispatched this far ahead of the boundary it targets.
+          const uint32_t leadMs = currentNowMs - readStartedAtMs;
+          _job.verifiedSet.alignmentLatencyMs = leadMs;
+          const uint32_t firstBoundaryMs =
+              _job.alignment.referenceAtMs - _job.alignment.referenceMillis;
+          const int32_t lateMs = static_cast<int32_t>(
+              currentNowMs + leadMs - firstBoundaryMs);
+          _job.alignmentSeconds = lateMs > 0
+              ? (static_cast<uint32_t>(lateMs) + 999U) / 1000U : 0U;
+          _job.verifiedSet.alignmentTargetMs =
+              firstBoundaryMs + _job.alignmentSeconds * 1000U;
+        }
         _job.state = JobState::SET_TIME_WRITE_CALENDAR;
         break;
+      }
       case JobState::SET_TIME_WRITE_CALENDAR: {
+        if (_job.verifiedSet.aligned) {
+          const uint32_t leadMs = _job.verifiedSet.alignmentLatencyMs;
+          // Retarget a slipped boundary only while the next one still fits
+          // before the mutation cutoff; otherwise write late and report it.
+          while (static_cast<int32_t>(
+                     currentNowMs - (_job.verifiedSet.alignmentTargetMs - leadMs)) >
+                     static_cast<int32_t>(SET_TIME_ALIGNMENT_TOLERANCE_MS) &&
+                 !hasDeadlinePassed(
+                     _job.verifiedSet.alignmentTargetMs + 1000U - leadMs,
+                     _job.mutationCutoffMs)) {
+            _job.verifiedSet.alignmentTargetMs += 1000U;
+            ++_job.alignmentSeconds;
+          }
+          if (static_cast<int32_t>(
+                  currentNowMs - (_job.verifiedSet.alignmentTargetMs - leadMs)) < 0) {
+            return Status::Error(Err::IN_PROGRESS, "Waiting for second boundary");
+          }
+          uint32_t referenceUnix = 0;
+          DateTime target{};
+          if (!dateTimeToUnix(_job.alignment.reference, referenceUnix).ok() ||
+              !unixToDateTime(referenceUnix + _job.alignmentSeconds, target).ok()) {
+            st = Status::Error(Err::INVALID_DATETIME, "Aligned time out of range");
+            return finishJob(st);
+          }
+          const uint32_t dayDelta =
+              (referenceUnix + _job.alignmentSeconds) / 86400U -
+              referenceUnix / 86400U;
+          target.weekday = static_cast<uint8_t>(
+              (_job.alignment.reference.weekday + dayDelta % 7U) % 7U);
+          if (!isValidDateTime(target)) {
+            st = Status::Error(Err::INVALID_DATETIME, "Aligned time out of range");
+            return finishJob(st);
+          }
+          encodeVerifiedSetCalendar(target);
+        }
         const uint32_t boundary = earlierDeadline(
             currentNowMs, callbackBoundary(), _job.mutationCutoffMs);
         const TimedTransferResult transfer = writeRegsBefore(
@@ -1527,11 +2047,17 @@ Status RV3032::pollJob(uint32_t now_ms, uint8_t maxInstructions, uint8_t& instru
           return finishJob(st);
         }
         _job.verifiedSet.calendarWriteAmbiguous = !st.ok();
+        if (_job.verifiedSet.aligned) {
+          _job.verifiedSet.alignmentErrorMs = static_cast<int32_t>(
+              transfer.completedAtMs - _job.verifiedSet.alignmentTargetMs);
+          _job.verifiedSet.alignmentErrorValid = true;
+        }
         _job.state = JobState::SET_TIME_VERIFY_CALENDAR;
         break;
       }
       case JobState::SET_TIME_VERIFY_CALENDAR: {
-        uint8_t observed[7] = {};
+        // Calendar proof and the pre-clear Status come from one burst.
+        uint8_t observed[VERIFIED_SET_READBACK_LEN] = {};
         st = readJob(cmd::REG_SECONDS, observed, sizeof(observed));
         if (!st.ok()) {
           return finishJob(st);
@@ -1547,14 +2073,8 @@ Status RV3032::pollJob(uint32_t now_ms, uint8_t maxInstructions, uint8_t& instru
         if (_job.verifiedSet.calendarWriteAmbiguous) {
           _job.verifiedSet.verifiedAfterAmbiguousWrite = true;
         }
-        _job.state = JobState::SET_TIME_READ_STATUS_BEFORE_CLEAR;
-        break;
-      }
-      case JobState::SET_TIME_READ_STATUS_BEFORE_CLEAR:
-        st = readJob(cmd::REG_STATUS, &_job.verifiedSet.statusBeforeClear, 1);
-        if (!st.ok()) {
-          return finishJob(st);
-        }
+        _job.verifiedSet.statusBeforeClear =
+            observed[cmd::REG_STATUS - cmd::REG_SECONDS];
         _job.verifiedSet.statusBeforeClearValid = true;
         _job.verifiedSet.temperatureHighWasSetBeforeClear =
             (_job.verifiedSet.statusBeforeClear & 0x80u) != 0;
@@ -1562,6 +2082,7 @@ Status RV3032::pollJob(uint32_t now_ms, uint8_t maxInstructions, uint8_t& instru
             (_job.verifiedSet.statusBeforeClear & 0x40u) != 0;
         _job.state = JobState::SET_TIME_WRITE_STATUS;
         break;
+      }
       case JobState::SET_TIME_WRITE_STATUS: {
         const uint8_t value = cmd::STATUS_CLEAR_INVALID_TIME_VALUE;
         const uint32_t boundary = earlierDeadline(
@@ -1578,14 +2099,18 @@ Status RV3032::pollJob(uint32_t now_ms, uint8_t maxInstructions, uint8_t& instru
           return finishJob(st);
         }
         _job.verifiedSet.statusWriteAmbiguous = !st.ok();
-        _job.state = JobState::SET_TIME_READ_STATUS_AFTER;
+        _job.state = JobState::SET_TIME_READ_FINAL_CALENDAR;
         break;
       }
-      case JobState::SET_TIME_READ_STATUS_AFTER:
-        st = readJob(cmd::REG_STATUS, &_job.verifiedSet.statusAfter, 1);
+      case JobState::SET_TIME_READ_FINAL_CALENDAR: {
+        // Post-clear Status and the final calendar come from one burst.
+        uint8_t observed[VERIFIED_SET_READBACK_LEN] = {};
+        st = readJob(cmd::REG_SECONDS, observed, sizeof(observed));
         if (!st.ok()) {
           return finishJob(st);
         }
+        _job.verifiedSet.statusAfter =
+            observed[cmd::REG_STATUS - cmd::REG_SECONDS];
         _job.verifiedSet.statusAfterValid = true;
         if ((_job.verifiedSet.statusAfter & 0x03u) != 0) {
           st = Status::Error(Err::EEPROM_VERIFY_FAILED, "Invalid-time flags remain set");
@@ -1594,14 +2119,6 @@ Status RV3032::pollJob(uint32_t now_ms, uint8_t maxInstructions, uint8_t& instru
         if (_job.verifiedSet.statusWriteAmbiguous) {
           _job.verifiedSet.verifiedAfterAmbiguousWrite = true;
         }
-        _job.state = JobState::SET_TIME_READ_FINAL_CALENDAR;
-        break;
-      case JobState::SET_TIME_READ_FINAL_CALENDAR: {
-        uint8_t observed[7] = {};
-        st = readJob(cmd::REG_SECONDS, observed, sizeof(observed));
-        if (!st.ok()) {
-          return finishJob(st);
-        }
         DateTime decoded{};
         if (!decodeCalendar(observed, decoded) ||
             !acceptedVerifiedTime(_job.verifiedSet.requested, decoded)) {
@@ -1661,7 +2178,7 @@ Status RV3032::pollJob(uint32_t now_ms, uint8_t maxInstructions, uint8_t& instru
         st = Status::Error(
             Err::INTERNAL_STATE_ERROR, "Impossible cooperative job state",
             static_cast<int32_t>(_job.state));
-        if (isConfigurationKind(_job.activeKind)) {
+        if (isConfigurationJobKind(_job.activeKind)) {
           const bool cleanupAlreadyEntered =
               !_job.configurationReport.operationStatus.ok() ||
               _job.configurationCleanupWriteAttempted;
@@ -1693,6 +2210,9 @@ Status RV3032::pollJob(uint32_t now_ms, uint8_t maxInstructions, uint8_t& instru
 }
 
 Status RV3032::finishJob(const Status& status) {
+  if (_job.activeKind == JobKind::ENSURE_PRIMARY_CELL) {
+    finalizePrimaryCellReport();
+  }
   _job.lastStatus = status;
   _job.completedKind = _job.activeKind;
   _job.activeKind = JobKind::NONE;
@@ -1700,10 +2220,142 @@ Status RV3032::finishJob(const Status& status) {
   return _job.lastStatus;
 }
 
+Status RV3032::cancelJob() {
+  if (!_initialized) {
+    return Status::Error(Err::NOT_INITIALIZED, "Call begin() first");
+  }
+  if (_job.activeKind == JobKind::NONE) {
+    if (_eeprom.state != EepromState::IDLE && _job.state != JobState::IDLE) {
+      return Status::Error(Err::BUSY, "EEPROM queue owns the shared engine");
+    }
+    return _job.lastStatus;
+  }
+  const Status cancelled = Status::Error(Err::JOB_CANCELLED, "Job cancelled");
+  const Status cleanupInProgress =
+      Status::Error(Err::IN_PROGRESS, "Cancelled job cleanup in progress");
+
+  if (isConfigurationJobKind(_job.activeKind)) {
+    ConfigurationJobReport& report = _job.configurationReport;
+    // A failed operation or an issued cleanup write means the job already
+    // owns its cleanup states; let them run to their proof.
+    const bool cleanupAlreadyEntered =
+        !report.operationStatus.ok() || _job.configurationCleanupWriteAttempted;
+    if (report.operationStatus.ok()) {
+      report.operationStatus = cancelled;
+    }
+    if (!report.mutationAttempted) {
+      report.finalState = ConfigurationFinalState::UNCHANGED;
+      return finishJob(report.operationStatus);
+    }
+    if (_job.activeKind == JobKind::SET_BACKUP_SWITCH_MODE &&
+        report.finalState == ConfigurationFinalState::REQUESTED_VERIFIED) {
+      return finishJob(report.operationStatus);
+    }
+    if (!cleanupAlreadyEntered) {
+      _job.state = configurationRecoveryState(_job.activeKind);
+    }
+    return cleanupInProgress;
+  }
+
+  if (_job.activeKind == JobKind::PERSISTENT_READ ||
+      _job.activeKind == JobKind::USER_EEPROM_WRITE ||
+      _job.activeKind == JobKind::ENSURE_PRIMARY_CELL) {
+    if (_job.persistentOperationStatus.ok()) {
+      _job.persistentOperationStatus = cancelled;
+    }
+    if (!_job.persistentCleanupRequired) {
+      // Access state was never changed, so no restore is owed.
+      exposePersistentEvidence();
+      return finishJob(_job.persistentOperationStatus);
+    }
+    // processPersistentJob() enters the restore path before its next forward
+    // callback; a job already cleaning up just keeps going.
+    _job.persistentCancelRequested = true;
+    return cleanupInProgress;
+  }
+
+  // Reads, user RAM, wake, telemetry and verified set have no cleanup path;
+  // their reports already record which writes were dispatched.
+  return finishJob(cancelled);
+}
+
+void RV3032::resetJob() {
+  _job = JobOp{};
+  ++_jobGeneration;
+}
+
+void RV3032::resetPersistentEngine() {
+  static_cast<PersistentEngineOp&>(_job) = PersistentEngineOp{};
+  _job.state = JobState::IDLE;
+  _job.activeKind = JobKind::NONE;
+  _job.completedKind = JobKind::NONE;
+  _job.lastStatus = Status::Ok();
+  _job.deadlineMs = 0;
+  _job.mutationCutoffMs = 0;
+  _job.deadlineActive = false;
+  _job.mutationCutoffActive = false;
+  ++_jobGeneration;
+}
+
+bool RV3032::isConfigurationJobKind(JobKind kind) {
+  return kind == JobKind::SET_TIMER ||
+         kind == JobKind::SET_PERIODIC_UPDATE ||
+         kind == JobKind::SET_BACKUP_SWITCH_MODE ||
+         kind == JobKind::SET_CLKOUT_CONFIG ||
+         kind == JobKind::SET_TEMPERATURE_EVENT_CONFIG;
+}
+
+RV3032::JobState RV3032::configurationRecoveryState(JobKind kind) {
+  switch (kind) {
+    case JobKind::SET_TIMER:
+      return JobState::TIMER_CLEANUP_READ;
+    case JobKind::SET_PERIODIC_UPDATE:
+      return JobState::PERIODIC_CLEANUP_READ;
+    case JobKind::SET_BACKUP_SWITCH_MODE:
+      return JobState::BACKUP_VERIFY_PMU;
+    case JobKind::SET_CLKOUT_CONFIG:
+      return JobState::CLKOUT_CLEANUP_READ;
+    case JobKind::SET_TEMPERATURE_EVENT_CONFIG:
+      return JobState::TEMPERATURE_CLEANUP_READ;
+    default:
+      return JobState::IDLE;
+  }
+}
+
 bool RV3032::workIdle() const {
   return !isJobBusy() && !isEepromBusy();
 }
 
+void RV3032::finalizePrimaryCellReport() {
+  PrimaryCellConfigurationReport& report = _job.primaryCell;
+  report.operationStatus = _job.persistentOperationStatus;
+  report.cleanupStatus = _job.persistentCleanupStatus;
+  // Without an entered cleanup owner no access state was changed.
+  report.cleanupVerified = _job.persistentRead.cleanupVerified ||
+      (!_job.persistentCleanupRequired &&
+       _job.persistentCleanupStatus.ok());
+  if (report.operationStatus.ok() && report.cleanupStatus.ok() &&
+      report.cleanupVerified) {
+    report.outcome = report.writeCommandAttempted
+        ? PrimaryCellConfigurationOutcome::EEPROM_UPDATED
+        : PrimaryCellConfigurationOutcome::ALREADY_CONFIGURED;
+    report.failureStage = PrimaryCellFailureStage::NONE;
+    return;
+  }
+  report.outcome = PrimaryCellConfigurationOutcome::FAILED;
+  if (!report.cleanupStatus.ok() || !report.cleanupVerified) {
+    report.failureStage = PrimaryCellFailureStage::CLEANUP;
+  } else if (!_job.persistentSafeC0Verified) {
+    report.failureStage = PrimaryCellFailureStage::PREPARE_ACCESS;
+  } else if (!report.persistentBeforeValid) {
+    report.failureStage = PrimaryCellFailureStage::READ_PERSISTENT;
+  } else if (!report.writeCommandAttempted) {
+    report.failureStage = PrimaryCellFailureStage::WRITE_PERSISTENT;
+  } else {
+    report.failureStage = PrimaryCellFailureStage::VERIFY_PERSISTENT;
+  }
+}
+
 void RV3032::exposePersistentEvidence() {
   _job.persistentRead.operationStatus = _job.persistentOperationStatus;
   _job.persistentRead.cleanupStatus = _job.persistentCleanupStatus;
@@ -1711,12 +2363,11 @@ void RV3032::exposePersistentEvidence() {
   _job.userEepromWrite.cleanupStatus = _job.persistentCleanupStatus;
 }
 
-uint32_t RV3032::twoTransferJobMinimumTimeoutMs() const {
+uint32_t RV3032::transferJobMinimumTimeoutMs(uint32_t callbackCap) const {
   if (_config.nowMs != nullptr) {
     return 2U;
   }
-  const uint32_t fullTransferBound =
-      TWO_TRANSFER_JOB_CALLBACK_CAP * _config.i2cTimeoutMs;
+  const uint32_t fullTransferBound = callbackCap * _config.i2cTimeoutMs;
   const uint32_t twoDispatchMinimum = _config.i2cTimeoutMs + 2U;
   return fullTransferBound > twoDispatchMinimum
       ? fullTransferBound : twoDispatchMinimum;
@@ -1739,7 +2390,7 @@ Status RV3032::updateRegisterSingle(
       (!persist && _eeprom.queueCount > 0)) {
     return Status::Error(Err::BUSY, "Driver work already in progress");
   }
-  _job = JobOp{};
+  resetJob();
   _job.activeKind = JobKind::REGISTER_UPDATE;
   _job.registerUpdateReg = reg;
   _job.registerUpdateImplementedMask = implementedMask;
@@ -1785,7 +2436,7 @@ Status RV3032::startTempLsbFlagClear(uint8_t targetMask) {
   if (!workIdle()) {
     return Status::Error(Err::BUSY, "Driver work already in progress");
   }
-  _job = JobOp{};
+  resetJob();
   _job.activeKind = JobKind::TEMP_LSB_FLAG_CLEAR;
   _job.state = JobState::TEMP_LSB_CLEAR_READ;
   _job.tempLsbClearMask = targetMask;
@@ -1821,7 +2472,7 @@ Status RV3032::updateRegisterBlock(uint8_t reg, uint8_t length,
       (!persist && _eeprom.queueCount > 0)) {
     return Status::Error(Err::BUSY, "Driver work already in progress");
   }
-  _job = JobOp{};
+  resetJob();
   _job.activeKind = JobKind::REGISTER_UPDATE;
   _job.registerBlockReg = reg;
   _job.registerBlockLen = length;
@@ -1847,18 +2498,25 @@ Status RV3032::startReadTimeSnapshotJob(uint32_t nowMs,
   if (!workIdle()) {
     return Status::Error(Err::BUSY, "Driver work already in progress");
   }
-  const uint32_t minimumTimeoutMs = twoTransferJobMinimumTimeoutMs();
+  const uint32_t minimumTimeoutMs = transferJobMinimumTimeoutMs(TWO_TRANSFER_JOB_CALLBACK_CAP);
   if (operationTimeoutMs < minimumTimeoutMs || operationTimeoutMs > 1000) {
     return Status::Error(Err::INVALID_PARAM,
                          "Read-time timeout is not executable",
                          static_cast<int32_t>(minimumTimeoutMs));
   }
-  _job = JobOp{};
+  // The timeout floor stays at two callbacks so admission never depends on
+  // cache state; a cache hit only finishes sooner.
+  const bool cacheHit = _validityProven && _consecutiveFailures == 0 &&
+      _config.snapshotValidityMaxAgeMs != 0 &&
+      static_cast<uint32_t>(nowMs - _validityProvenMs) <
+          _config.snapshotValidityMaxAgeMs;
+  resetJob();
   _job.activeKind = JobKind::READ_TIME_SNAPSHOT;
+  _job.timeSnapshotStartMs = nowMs;
   _job.deadlineMs = nowMs + operationTimeoutMs;
   _job.deadlineActive = true;
   _job.lastStatus = Status::Error(Err::IN_PROGRESS, "Job in progress");
-  _job.state = JobState::READ_TIME_STATUS;
+  _job.state = cacheHit ? JobState::READ_TIME_FUSED : JobState::READ_TIME_STATUS;
   return _job.lastStatus;
 }
 
@@ -1873,17 +2531,95 @@ Status RV3032::getReadTimeSnapshotJobResult(TimeSnapshot& out) const {
   return _job.lastStatus;
 }
 
-Status RV3032::startSetTimeAndClearInvalidFlagsVerifiedJob(
-    const DateTime& value, uint32_t nowMs, uint32_t operationTimeoutMs) {
+Status RV3032::startReadWakeReasonJob(bool acknowledge, uint32_t nowMs,
+                                      uint32_t operationTimeoutMs) {
   if (!_initialized) {
     return Status::Error(Err::NOT_INITIALIZED, "Call begin() first");
   }
   if (!workIdle()) {
     return Status::Error(Err::BUSY, "Driver work already in progress");
   }
-  if (!isValidDateTime(value)) {
+  const uint32_t minimumTimeoutMs = transferJobMinimumTimeoutMs(
+      acknowledge ? WAKE_REASON_JOB_CALLBACK_CAP : 1U);
+  if (operationTimeoutMs < minimumTimeoutMs || operationTimeoutMs > 1000) {
+    return Status::Error(Err::INVALID_PARAM,
+                         "Wake-reason timeout is not executable",
+                         static_cast<int32_t>(minimumTimeoutMs));
+  }
+  resetJob();
+  _job.activeKind = JobKind::READ_WAKE_REASON;
+  _job.wakeAcknowledge = acknowledge;
+  _job.deadlineMs = nowMs + operationTimeoutMs;
+  _job.deadlineActive = true;
+  _job.lastStatus = Status::Error(Err::IN_PROGRESS, "Job in progress");
+  _job.state = JobState::WAKE_READ_FLAGS;
+  return _job.lastStatus;
+}
+
+Status RV3032::getReadWakeReasonJobResult(WakeReasonReport& out) const {
+  if (_job.activeKind == JobKind::READ_WAKE_REASON) {
+    return Status::Error(Err::IN_PROGRESS, "Wake-reason job in progress");
+  }
+  if (_job.completedKind != JobKind::READ_WAKE_REASON) {
+    return Status::Error(Err::JOB_RESULT_UNAVAILABLE,
+                         "Wake-reason result unavailable");
+  }
+  out = _job.wakeReason;
+  return _job.lastStatus;
+}
+
+Status RV3032::startReadTelemetryFrameJob(uint32_t nowMs,
+                                          uint32_t operationTimeoutMs) {
+  if (!_initialized) {
+    return Status::Error(Err::NOT_INITIALIZED, "Call begin() first");
+  }
+  if (!workIdle()) {
+    return Status::Error(Err::BUSY, "Driver work already in progress");
+  }
+  const uint32_t minimumTimeoutMs = transferJobMinimumTimeoutMs(1U);
+  if (operationTimeoutMs < minimumTimeoutMs || operationTimeoutMs > 1000) {
+    return Status::Error(Err::INVALID_PARAM,
+                         "Telemetry timeout is not executable",
+                         static_cast<int32_t>(minimumTimeoutMs));
+  }
+  resetJob();
+  _job.activeKind = JobKind::READ_TELEMETRY_FRAME;
+  _job.deadlineMs = nowMs + operationTimeoutMs;
+  _job.deadlineActive = true;
+  _job.lastStatus = Status::Error(Err::IN_PROGRESS, "Job in progress");
+  _job.state = JobState::TELEMETRY_READ_FRAME;
+  return _job.lastStatus;
+}
+
+Status RV3032::getReadTelemetryFrameJobResult(TelemetryFrame& out) const {
+  if (_job.activeKind == JobKind::READ_TELEMETRY_FRAME) {
+    return Status::Error(Err::IN_PROGRESS, "Telemetry job in progress");
+  }
+  if (_job.completedKind != JobKind::READ_TELEMETRY_FRAME) {
+    return Status::Error(Err::JOB_RESULT_UNAVAILABLE,
+                         "Telemetry result unavailable");
+  }
+  out = _job.telemetryFrame;
+  return _job.lastStatus;
+}
+
+Status RV3032::startSetTimeAndClearInvalidFlagsVerifiedJob(
+    const DateTime& value, uint32_t nowMs, uint32_t operationTimeoutMs) {
+  if (_initialized && workIdle() && !isValidDateTime(value)) {
     return Status::Error(Err::INVALID_DATETIME, "Invalid date/time");
   }
+  return startSetTimeAndClearInvalidFlagsVerifiedJob(
+      ValidDateTime(value), nowMs, operationTimeoutMs);
+}
+
+Status RV3032::startSetTimeAndClearInvalidFlagsVerifiedJob(
+    const ValidDateTime& value, uint32_t nowMs, uint32_t operationTimeoutMs) {
+  if (!_initialized) {
+    return Status::Error(Err::NOT_INITIALIZED, "Call begin() first");
+  }
+  if (!workIdle()) {
+    return Status::Error(Err::BUSY, "Driver work already in progress");
+  }
   uint32_t minimumTimeoutMs = MIN_SET_TIME_OPERATION_BUDGET_MS + 2U;
   if (_config.nowMs == nullptr) {
     const uint32_t fullTransferBound =
@@ -1900,13 +2636,58 @@ Status RV3032::startSetTimeAndClearInvalidFlagsVerifiedJob(
                          static_cast<int32_t>(minimumTimeoutMs));
   }
 
-  _job = JobOp{};
-  _job.activeKind = JobKind::SET_TIME_VERIFIED;
-  _job.deadlineMs = nowMs + operationTimeoutMs;
-  _job.mutationCutoffMs = nowMs +
-      (operationTimeoutMs - MIN_SET_TIME_OPERATION_BUDGET_MS);
-  _job.deadlineActive = true;
-  _job.mutationCutoffActive = true;
+  resetJob();
+  _job.activeKind = JobKind::SET_TIME_VERIFIED;
+  _job.deadlineMs = nowMs + operationTimeoutMs;
+  _job.mutationCutoffMs = nowMs +
+      (operationTimeoutMs - MIN_SET_TIME_OPERATION_BUDGET_MS);
+  _job.deadlineActive = true;
+  _job.mutationCutoffActive = true;
+  encodeVerifiedSetCalendar(value.value());
+  _job.lastStatus = Status::Error(Err::IN_PROGRESS, "Job in progress");
+  _job.state = JobState::SET_TIME_READ_STATUS_BEFORE;
+  return _job.lastStatus;
+}
+
+Status RV3032::startSetTimeAndClearInvalidFlagsVerifiedJob(
+    const SetTimeAlignment& alignment, uint32_t nowMs,
+    uint32_t operationTimeoutMs) {
+  if (!_initialized) {
+    return Status::Error(Err::NOT_INITIALIZED, "Call begin() first");
+  }
+  if (!workIdle()) {
+    return Status::Error(Err::BUSY, "Driver work already in progress");
+  }
+  if (_config.nowMs == nullptr) {
+    return Status::Error(Err::INVALID_CONFIG,
+                         "Aligned set requires a nowMs hook");
+  }
+  if (alignment.referenceMillis > 999U) {
+    return Status::Error(Err::INVALID_PARAM,
+                         "Reference milliseconds must be 0..999",
+                         alignment.referenceMillis);
+  }
+  const int32_t referenceAgeMs =
+      static_cast<int32_t>(nowMs - alignment.referenceAtMs);
+  if (referenceAgeMs < 0 ||
+      static_cast<uint32_t>(referenceAgeMs) >
+          SET_TIME_ALIGNMENT_REFERENCE_MAX_AGE_MS) {
+    return Status::Error(Err::INVALID_PARAM,
+                         "Alignment reference is not recent", referenceAgeMs);
+  }
+  const Status admitted = startSetTimeAndClearInvalidFlagsVerifiedJob(
+      alignment.reference, nowMs, operationTimeoutMs);
+  if (!admitted.inProgress()) {
+    return admitted;
+  }
+  _job.deadlineMs += SET_TIME_ALIGNMENT_WINDOW_MS;
+  _job.mutationCutoffMs += SET_TIME_ALIGNMENT_WINDOW_MS;
+  _job.alignment = alignment;
+  _job.verifiedSet.aligned = true;
+  return admitted;
+}
+
+void RV3032::encodeVerifiedSetCalendar(const DateTime& value) {
   _job.verifiedSet.requested = value;
   _job.calendarBuf[0] = binToBcd(value.second);
   _job.calendarBuf[1] = binToBcd(value.minute);
@@ -1915,9 +2696,6 @@ Status RV3032::startSetTimeAndClearInvalidFlagsVerifiedJob(
   _job.calendarBuf[4] = binToBcd(value.day);
   _job.calendarBuf[5] = binToBcd(value.month);
   _job.calendarBuf[6] = binToBcd(static_cast<uint8_t>(value.year - 2000));
-  _job.lastStatus = Status::Error(Err::IN_PROGRESS, "Job in progress");
-  _job.state = JobState::SET_TIME_READ_STATUS_BEFORE;
-  return _job.lastStatus;
 }
 
 Status RV3032::getSetTimeAndClearInvalidFlagsVerifiedJobResult(
@@ -1948,7 +2726,26 @@ Status RV3032::startPersistentReadJob(uint8_t address, uint8_t length,
       timeoutMs < minimumTimeoutMs || timeoutMs > 10000) {
     return Status::Error(Err::INVALID_PARAM, "Invalid persistent-read bounds");
   }
-  _job = JobOp{};
+  if (_config.cachePersistentReads) {
+    const uint8_t first = static_cast<uint8_t>(address - cmd::CONFIG_EEPROM_START);
+    const uint64_t wanted = ((1ULL << length) - 1U) << first;
+    if ((_persistentCache.validMask & wanted) == wanted) {
+      ++_persistentCache.hits;
+      resetJob();
+      PersistentReadResult& result = _job.persistentRead;
+      result.eepromAddress = address;
+      std::memcpy(result.data, &_persistentCache.values[first], length);
+      result.length = length;
+      result.persistentVerified = true;
+      result.cleanupVerified = true;
+      result.fromCache = true;
+      _job.completedKind = JobKind::PERSISTENT_READ;
+      _job.lastStatus = Status::Ok();
+      return _job.lastStatus;
+    }
+    ++_persistentCache.misses;
+  }
+  resetJob();
   _job.activeKind = JobKind::PERSISTENT_READ;
   _job.state = JobState::PERSISTENT;
   _job.persistentState = EepromState::READ_CONTROL1;
@@ -2007,7 +2804,7 @@ Status RV3032::startWriteUserEepromJob(uint8_t offset, const uint8_t* data,
       operationTimeoutMs < minimumTimeoutMs || operationTimeoutMs > 10000) {
     return Status::Error(Err::INVALID_PARAM, "User EEPROM write out of range");
   }
-  _job = JobOp{};
+  resetJob();
   _job.activeKind = JobKind::USER_EEPROM_WRITE;
   _job.state = JobState::PERSISTENT;
   _job.persistentState = EepromState::READ_CONTROL1;
@@ -2048,6 +2845,62 @@ Status RV3032::getUserEepromWriteJobResult(UserEepromWriteReport& out) const {
   return _job.lastStatus;
 }
 
+Status RV3032::startEnsurePrimaryCellConfigurationJob(
+    uint32_t nowMs, uint32_t operationTimeoutMs) {
+  if (!_initialized) {
+    return Status::Error(Err::NOT_INITIALIZED, "Call begin() first");
+  }
+  if (!workIdle()) {
+    return Status::Error(Err::BUSY, "Driver work already in progress");
+  }
+  if (_eeprom.writeBehindCount > 0) {
+    // A later release would overwrite the provisioned persistent PMU.
+    return Status::Error(Err::BUSY, "Flush staged persistence first");
+  }
+  if (_config.nowMs == nullptr) {
+    return Status::Error(Err::INVALID_CONFIG, "Primary ensure job requires nowMs");
+  }
+  if (_primaryCellEnsureAttempted) {
+    return Status::Error(Err::PRIMARY_CELL_ALREADY_ATTEMPTED,
+                         "Primary-cell ensure already attempted");
+  }
+  const uint32_t cleanupReserveMs =
+      persistentCleanupReserveMs(_config.i2cTimeoutMs);
+  const uint32_t minimumTimeoutMs =
+      cleanupReserveMs + _config.i2cTimeoutMs + 1U;
+  if (operationTimeoutMs < minimumTimeoutMs || operationTimeoutMs > 10000) {
+    return Status::Error(Err::INVALID_PARAM, "Invalid primary ensure bounds",
+                         static_cast<int32_t>(minimumTimeoutMs));
+  }
+  _primaryCellEnsureAttempted = true;
+  resetJob();
+  _job.activeKind = JobKind::ENSURE_PRIMARY_CELL;
+  _job.state = JobState::PERSISTENT;
+  _job.persistentState = EepromState::READ_CONTROL1;
+  _job.persistentAddress = cmd::REG_ACTIVE_PMU;
+  _job.persistentLength = 1;
+  _job.persistentWriteMode = true;
+  _job.deadlineMs = nowMs + operationTimeoutMs;
+  _job.mutationCutoffMs = nowMs + (operationTimeoutMs - cleanupReserveMs);
+  _job.deadlineActive = true;
+  _job.mutationCutoffActive = true;
+  _job.lastStatus = Status::Error(Err::IN_PROGRESS, "Primary ensure in progress");
+  return _job.lastStatus;
+}
+
+Status RV3032::getEnsurePrimaryCellConfigurationJobResult(
+    PrimaryCellConfigurationReport& out) const {
+  if (_job.activeKind == JobKind::ENSURE_PRIMARY_CELL) {
+    return Status::Error(Err::IN_PROGRESS, "Primary ensure in progress");
+  }
+  if (_job.completedKind != JobKind::ENSURE_PRIMARY_CELL) {
+    return Status::Error(Err::JOB_RESULT_UNAVAILABLE,
+                         "Primary ensure result unavailable");
+  }
+  out = _job.primaryCell;
+  return _job.lastStatus;
+}
+
 Status RV3032::getSettings(SettingsSnapshot& out) const {
   out.initialized = _initialized;
   out.state = _driverState;
@@ -2066,6 +2919,8 @@ Status RV3032::getSettings(SettingsSnapshot& out) const {
   out.eepromWriteCount = _eepromWriteCount;
   out.eepromWriteFailures = _eepromWriteFailures;
   out.eepromQueueDepth = _eeprom.queueCount;
+  out.persistenceDebounceMs = _config.persistenceDebounceMs;
+  out.persistenceStaged = _eeprom.writeBehindCount;
   out.jobBusy = isJobBusy();
   out.primaryCellEnsureAttempted = _primaryCellEnsureAttempted;
   out.lastOkMs = _lastOkMs;
@@ -2173,6 +3028,8 @@ RV3032::RawTransferResult RV3032::_i2cWriteRaw(
     result.status = Status::Error(Err::INVALID_PARAM, "Invalid I2C write buffer");
     return result;
   }
+  // Any write, even a failed or ambiguous one, may have changed a cached byte.
+  _batch.validMask = 0;
   result.callbackInvoked = true;
   result.status = normalizeTransportResult(
       _config.i2cWrite(_config.i2cAddress, buf, len,
@@ -2217,7 +3074,7 @@ RV3032::TimedTransferResult RV3032::_i2cWriteReadTrackedBefore(
   TimedTransferResult result{};
 
   uint32_t callbackStartedAt = nowMs;
-  if (_config.nowMs != nullptr) {
+  if (_config.nowMs != nullptr && !_clockStampCurrent(nowMs)) {
     callbackStartedAt = _nowMs();
     if (static_cast<int32_t>(callbackStartedAt - nowMs) > 0) {
       nowMs = callbackStartedAt;
@@ -2247,6 +3104,7 @@ RV3032::TimedTransferResult RV3032::_i2cWriteReadTrackedBefore(
       result.callbackTimeoutViolated =
           static_cast<uint32_t>(observed - callbackStartedAt) > timeoutMs;
       if (static_cast<int32_t>(observed - nowMs) > 0) nowMs = observed;
+      _noteClockStamp(nowMs);
     } else {
       nowMs += timeoutMs;
     }
@@ -2261,7 +3119,10 @@ RV3032::TimedTransferResult RV3032::_i2cWriteReadTrackedBefore(
     healthStatus = Status::Error(Err::I2C_TIMEOUT,
                                  "Transport callback exceeded timeout");
   }
-  if (raw.callbackInvoked) (void)_updateHealth(healthStatus);
+  if (raw.callbackInvoked) {
+    (void)_updateHealth(healthStatus,
+                        _clockStampCurrent(nowMs) ? &nowMs : nullptr);
+  }
 
   if (!raw.callbackInvoked) {
     result.status = raw.status;
@@ -2287,7 +3148,7 @@ RV3032::TimedTransferResult RV3032::_i2cWriteTrackedBefore(
   TimedTransferResult result{};
 
   uint32_t callbackStartedAt = nowMs;
-  if (_config.nowMs != nullptr) {
+  if (_config.nowMs != nullptr && !_clockStampCurrent(nowMs)) {
     callbackStartedAt = _nowMs();
     if (static_cast<int32_t>(callbackStartedAt - nowMs) > 0) {
       nowMs = callbackStartedAt;
@@ -2316,6 +3177,7 @@ RV3032::TimedTransferResult RV3032::_i2cWriteTrackedBefore(
       result.callbackTimeoutViolated =
           static_cast<uint32_t>(observed - callbackStartedAt) > timeoutMs;
       if (static_cast<int32_t>(observed - nowMs) > 0) nowMs = observed;
+      _noteClockStamp(nowMs);
     } else {
       nowMs += timeoutMs;
     }
@@ -2330,7 +3192,10 @@ RV3032::TimedTransferResult RV3032::_i2cWriteTrackedBefore(
     healthStatus = Status::Error(Err::I2C_TIMEOUT,
                                  "Transport callback exceeded timeout");
   }
-  if (raw.callbackInvoked) (void)_updateHealth(healthStatus);
+  if (raw.callbackInvoked) {
+    (void)_updateHealth(healthStatus,
+                        _clockStampCurrent(nowMs) ? &nowMs : nullptr);
+  }
 
   if (!raw.callbackInvoked) {
     result.status = raw.status;
@@ -2358,7 +3223,7 @@ Status RV3032::_readRegisterRaw(uint8_t reg, uint8_t& value) {
   return _i2cWriteReadRaw(&tx, 1, &value, 1).status;
 }
 
-Status RV3032::_updateHealth(const Status& st) {
+Status RV3032::_updateHealth(const Status& st, const uint32_t* stampMs) {
   if (!_initialized || st.inProgress()) {
     return st;
   }
@@ -2367,7 +3232,7 @@ Status RV3032::_updateHealth(const Status& st) {
 
   if (isSuccess) {
     // Success path
-    _lastOkMs = _nowMs();
+    _lastOkMs = stampMs != nullptr ? *stampMs : _nowMs();
     _consecutiveFailures = 0;
     ++_totalSuccess;
 
@@ -2380,7 +3245,7 @@ Status RV3032::_updateHealth(const Status& st) {
   } else {
     // Failure path
     _lastError = st;
-    _lastErrorMs = _nowMs();
+    _lastErrorMs = stampMs != nullptr ? *stampMs : _nowMs();
     if (_consecutiveFailures < 0xFFu) {
       ++_consecutiveFailures;
     }
@@ -2400,6 +3265,16 @@ Status RV3032::_updateHealth(const Status& st) {
   return st;
 }
 
+bool RV3032::_clockStampCurrent(uint32_t nowMs) const {
+  return _config.reuseTransferTimestamps && _clockStampValid &&
+         _clockStampMs == nowMs;
+}
+
+void RV3032::_noteClockStamp(uint32_t nowMs) {
+  _clockStampMs = nowMs;
+  _clockStampValid = true;
+}
+
 uint32_t RV3032::_nowMs() const {
   if (_config.nowMs != nullptr) {
     return _config.nowMs(_config.timeUser);
@@ -2412,12 +3287,18 @@ void RV3032::_resetRuntimeState() {
   _initialized = false;
   _driverState = DriverState::UNINIT;
   _eeprom = EepromOp{};
-  _job = JobOp{};
+  resetJob();
   _eepromOperationStatus = Status::Ok();
   _eepromCleanupStatus = Status::Ok();
   _eepromWriteCount = 0;
   _eepromWriteFailures = 0;
   _primaryCellEnsureAttempted = false;
+  _batch = BatchCache{};
+  _clockStampMs = 0;
+  _clockStampValid = false;
+  _validityProvenMs = 0;
+  _validityProven = false;
+  _persistentCache = PersistentCache{};
   _lastOkMs = 0;
   _lastError = Status::Ok();
   _lastErrorMs = 0;
@@ -2446,6 +3327,15 @@ Status RV3032::readTime(DateTime& out) {
   return Status::Ok();
 }
 
+Status RV3032::readTime(ValidDateTime& out) {
+  DateTime decoded{};
+  const Status st = readTime(decoded);
+  if (st.ok()) {
+    out = ValidDateTime(decoded);
+  }
+  return st;
+}
+
 Status RV3032::readHundredths(uint8_t& hundredths) {
   uint8_t raw = 0;
   Status st = readRegs(cmd::REG_100TH_SECONDS, &raw, 1);
@@ -2460,15 +3350,34 @@ Status RV3032::readHundredths(uint8_t& hundredths) {
   return Status::Ok();
 }
 
-Status RV3032::setTime(const DateTime& time) {
+Status RV3032::readTelemetryFrame(TelemetryFrame& out) {
   if (!_initialized) {
     return Status::Error(Err::NOT_INITIALIZED, "Call begin() first");
   }
 
-  if (!isValidDateTime(time)) {
+  uint8_t frame[TELEMETRY_FRAME_LEN] = {0};
+  Status st = readRegs(cmd::REG_100TH_SECONDS, frame, sizeof(frame));
+  if (!st.ok()) {
+    return st;
+  }
+  decodeTelemetryFrame(frame, out);
+  notePowerStatus(out.statusRaw);
+  return Status::Ok();
+}
+
+Status RV3032::setTime(const DateTime& time) {
+  if (_initialized && !isValidDateTime(time)) {
     return Status::Error(Err::INVALID_DATETIME, "Invalid date/time values");
   }
+  return setTime(ValidDateTime(time));
+}
+
+Status RV3032::setTime(const ValidDateTime& valid) {
+  if (!_initialized) {
+    return Status::Error(Err::NOT_INITIALIZED, "Call begin() first");
+  }
 
+  const DateTime& time = valid.value();
   uint8_t buf[7] = {
     binToBcd(time.second),
     binToBcd(time.minute),
@@ -2490,7 +3399,7 @@ Status RV3032::readUnix(uint32_t& out) {
 }
 
 Status RV3032::setUnix(uint32_t ts) {
-  DateTime dt;
+  ValidDateTime dt;
   if (!unixToDateTime(ts, dt).ok()) {
     return Status::Error(Err::INVALID_DATETIME, "Unix timestamp out of range");
   }
@@ -2507,7 +3416,18 @@ Status RV3032::setAlarmTime(uint8_t minute, uint8_t hour, uint8_t date) {
   if (minute > 59 || hour > 23 || date > 31) {
     return Status::Error(Err::INVALID_PARAM, "Invalid alarm time values");
   }
+  return applyAlarmTime(minute, hour, date);
+}
+
+Status RV3032::setAlarmTime(const ValidDateTime& time) {
+  if (!_initialized) {
+    return Status::Error(Err::NOT_INITIALIZED, "Call begin() first");
+  }
+  const DateTime& value = time.value();
+  return applyAlarmTime(value.minute, value.hour, value.day);
+}
 
+Status RV3032::applyAlarmTime(uint8_t minute, uint8_t hour, uint8_t date) {
   const uint8_t implemented[3] = {0xFF, 0xBF, 0xBF};
   const uint8_t clear[3] = {
       0x7F, 0x3F, static_cast<uint8_t>(date == 0 ? 0xBF : 0x3F)};
@@ -2544,66 +3464,7 @@ Status RV3032::getAlarmConfig(AlarmConfig& out) {
   uint8_t buf[3] = {0};
   Status st = readRegs(cmd::REG_ALARM_MINUTE, buf, sizeof(buf));
   if (!st.ok()) return st;
-
-  const uint8_t minReg = buf[0];
-  const uint8_t hourReg = buf[1];
-  const uint8_t dateReg = buf[2];
-  if ((hourReg & 0x40u) != 0 || (dateReg & 0x40u) != 0) {
-    return Status::Error(Err::INVALID_PARAM, "Alarm registers contain reserved bits");
-  }
-
-  out.matchMinute = ((minReg & 0x80) == 0);
-  out.matchHour = ((hourReg & 0x80) == 0);
-  out.matchDate = ((dateReg & 0x80) == 0);
-
-  const uint8_t minRaw = static_cast<uint8_t>(minReg & 0x7F);
-  const uint8_t hourRaw = static_cast<uint8_t>(hourReg & 0x7F);
-  const uint8_t dateRaw = static_cast<uint8_t>(dateReg & 0x7F);
-
-  auto decodeAlarmField = [&](uint8_t rawBcd, bool fieldEnabled,
-                              uint8_t minValue, uint8_t maxValue,
-                              uint8_t disabledFallback,
-                              bool allowEnabledZero,
-                              uint8_t& outValue) -> Status {
-    if (!isValidBcd(rawBcd)) {
-      if (fieldEnabled) {
-        return Status::Error(Err::INVALID_PARAM, "Alarm registers contain invalid BCD");
-      }
-      outValue = disabledFallback;
-      return Status::Ok();
-    }
-    const uint8_t value = bcdToBin(rawBcd);
-    if (value < minValue || value > maxValue) {
-      if (fieldEnabled && allowEnabledZero && value == 0) {
-        outValue = 0;
-        return Status::Ok();
-      }
-      if (fieldEnabled) {
-        return Status::Error(Err::INVALID_PARAM, "Alarm registers out of range");
-      }
-      outValue = disabledFallback;
-      return Status::Ok();
-    }
-    outValue = value;
-    return Status::Ok();
-  };
-
-  Status decode = decodeAlarmField(minRaw, out.matchMinute, 0, 59, 0, false, out.minute);
-  if (!decode.ok()) {
-    return decode;
-  }
-  decode = decodeAlarmField(hourRaw, out.matchHour, 0, 23, 0, false, out.hour);
-  if (!decode.ok()) {
-    return decode;
-  }
-  // RV-3032-C7 reset state uses AE_D=0 with Date Alarm=00h to keep the alarm
-  // function inactive. Report that documented hardware state instead of failing.
-  decode = decodeAlarmField(dateRaw, out.matchDate, 1, 31, 1, true, out.date);
-  if (!decode.ok()) {
-    return decode;
-  }
-
-  return Status::Ok();
+  return decodeAlarmConfig(buf, out);
 }
 
 Status RV3032::getAlarmFlag(bool& triggered) {
@@ -2642,19 +3503,39 @@ Status RV3032::getTimer(uint16_t& ticks, TimerFrequency& freq, bool& enabled) {
   uint8_t values[6] = {};
   Status st = readRegs(cmd::REG_TIMER_LOW, values, sizeof(values));
   if (!st.ok()) return st;
+  return decodeTimer(values, ticks, freq, enabled);
+}
 
-  const uint8_t low = values[0];
-  const uint8_t high = values[1];
-  const uint8_t control1 = values[5];
-  if ((high & 0xF0u) != 0) {
-    return Status::Error(Err::INVALID_PARAM,
-                         "Timer high register contains reserved bits");
-  }
-
-  ticks = static_cast<uint16_t>((static_cast<uint16_t>(high & 0x0F) << 8) | low);
-  freq = static_cast<TimerFrequency>(control1 & cmd::CTRL1_TD_MASK);
-  enabled = ((control1 & (1u << cmd::CTRL1_TE_BIT)) != 0);
+Status RV3032::readTimerRemaining(uint32_t nowMs, uint32_t anchorMs,
+                                  TimerRemaining& out) {
+  uint8_t values[6] = {};
+  Status st = readRegs(cmd::REG_TIMER_LOW, values, sizeof(values));
+  if (!st.ok()) return st;
+  uint16_t ticks = 0;
+  TimerFrequency freq = TimerFrequency::Hz4096;
+  bool enabled = false;
+  st = decodeTimer(values, ticks, freq, enabled);
+  if (!st.ok()) return st;
 
+  // Durations are kept in 1/4096 ms so every source divides exactly.
+  static constexpr uint64_t kTickQ[] = {1000ULL, 64000ULL, 4096000ULL,
+                                        245760000ULL};
+  const uint64_t tickQ = kTickQ[static_cast<uint8_t>(freq)];
+  const uint64_t periodQ = tickQ * ticks;
+
+  TimerRemaining result{};
+  result.ticks = ticks;
+  result.frequency = freq;
+  result.enabled = enabled;
+  result.flagSet = (values[2] & (1u << cmd::STATUS_TF_BIT)) != 0;
+  result.periodMs = static_cast<uint32_t>((periodQ + 4095U) / 4096U);
+  result.uncertaintyMs = static_cast<uint32_t>((tickQ + 4095U) / 4096U);
+  if (enabled && periodQ != 0) {
+    const uint64_t elapsedQ = static_cast<uint64_t>(nowMs - anchorMs) * 4096U;
+    const uint64_t remainingQ = periodQ - (elapsedQ % periodQ);
+    result.remainingMs = static_cast<uint32_t>((remainingQ + 4095U) / 4096U);
+  }
+  out = result;
   return Status::Ok();
 }
 
@@ -2692,7 +3573,7 @@ Status RV3032::setPeriodicUpdate(PeriodicUpdateFrequency frequency,
   if (!workIdle()) {
     return Status::Error(Err::BUSY, "Driver work already in progress");
   }
-  _job = JobOp{};
+  resetJob();
   _job.activeKind = JobKind::SET_PERIODIC_UPDATE;
   _job.periodicTarget[0] = static_cast<uint8_t>(
       raw ? (1u << cmd::CTRL1_USEL_BIT) : 0);
@@ -2764,7 +3645,7 @@ Status RV3032::startSetBackupSwitchModeJob(
       (!persist && _eeprom.queueCount > 0)) {
     return Status::Error(Err::BUSY, "Driver work already in progress");
   }
-  _job = JobOp{};
+  resetJob();
   _job.activeKind = JobKind::SET_BACKUP_SWITCH_MODE;
   _job.state = JobState::BACKUP_READ_CONTROL3;
   _job.backupTargetPmu = requestedBsm;
@@ -2865,6 +3746,9 @@ Status RV3032::ensurePrimaryCellConfiguration(
   if (!workIdle()) {
     return Status::Error(Err::BUSY, "Driver work already in progress");
   }
+  if (_eeprom.writeBehindCount > 0) {
+    return Status::Error(Err::BUSY, "Flush staged persistence first");
+  }
   if (_config.nowMs == nullptr || _config.waitMs == nullptr) {
     return Status::Error(Err::INVALID_CONFIG, "Primary ensure requires nowMs and waitMs");
   }
@@ -3070,6 +3954,7 @@ Status RV3032::ensurePrimaryCellConfiguration(
         callbackReturnedLate = callbackReturnedLate ||
                                writeCommandReturnedLate;
         if (writeCommandAttempted) {
+          dropPersistentByte(cmd::REG_ACTIVE_PMU);
           local.writeCommandAttempted = true;
         } else {
           operation = writeCommandStatus;
@@ -3205,7 +4090,7 @@ Status RV3032::setClkoutFrequency(ClkoutFrequency freq) {
       (!persist && _eeprom.queueCount > 0)) {
     return Status::Error(Err::BUSY, "Driver work already in progress");
   }
-  _job = JobOp{};
+  resetJob();
   _job.activeKind = JobKind::SET_CLKOUT_CONFIG;
   _job.clkoutTarget[3] = static_cast<uint8_t>(
       (freqRaw << cmd::CLKOUT_FREQ_SHIFT) & cmd::CLKOUT_FREQ_MASK);
@@ -3257,7 +4142,7 @@ Status RV3032::setClkoutConfig(const ClkoutConfig& config) {
       (!persist && _eeprom.queueCount > 0)) {
     return Status::Error(Err::BUSY, "Driver work already in progress");
   }
-  _job = JobOp{};
+  resetJob();
   _job.activeKind = JobKind::SET_CLKOUT_CONFIG;
   const uint16_t hfd = static_cast<uint16_t>(
       config.highFrequencyDivider - 1U);
@@ -3280,12 +4165,13 @@ Status RV3032::getClkoutConfig(ClkoutConfig& config) {
   uint8_t values[4] = {};
   Status st = readRegs(cmd::REG_ACTIVE_PMU, values, sizeof(values));
   if (!st.ok()) return st;
-  config.enabled = (values[0] & cmd::PMU_NCLKE_MASK) == 0;
-  config.highFrequencyMode = (values[3] & cmd::CLKOUT_OS_MASK) != 0;
+  config.enabled = !regmap::ActivePmu::NCLKE.test(values[0]);
+  config.highFrequencyMode = regmap::ActiveClkout2::OS.test(values[3]);
   config.xtalFrequency = static_cast<ClkoutFrequency>(
-      (values[3] & cmd::CLKOUT_FREQ_MASK) >> cmd::CLKOUT_FREQ_SHIFT);
+      regmap::ActiveClkout2::FD.get(values[3]));
   const uint16_t hfd = static_cast<uint16_t>(values[2]) |
-      (static_cast<uint16_t>(values[3] & cmd::CLKOUT_HFD_HIGH_MASK) << 8);
+      (static_cast<uint16_t>(regmap::ActiveClkout2::HFD_HIGH.get(values[3]))
+       << 8);
   config.highFrequencyDivider = static_cast<uint16_t>(hfd + 1U);
   return Status::Ok();
 }
@@ -3353,15 +4239,31 @@ Status RV3032::setOffsetPpm(float ppm) {
     return Status::Error(Err::INVALID_PARAM, "Offset must be finite");
   }
 
-  const float steps = ppm / kOffsetPpmPerStep;
-  int value = lrintf(steps);
+  if (ppm < kOffsetPpmMin || ppm > kOffsetPpmMax) {
+    return Status::Error(Err::INVALID_PARAM, "Offset is outside vendor range");
+  }
+  // The original float division and lrintf() pick the step, so ties still
+  // round half to even. The step's nearest ppb maps back to that same step
+  // in setOffsetPpb(), which owns the write.
+  const int32_t steps = static_cast<int32_t>(lrintf(ppm / kOffsetPpmPerStep));
+  return setOffsetPpb(offsetStepsToPpb(steps));
+}
 
-  if (value < -32 || value > 31 ||
-      ppm < (-32.0f * kOffsetPpmPerStep) ||
-      ppm > (31.0f * kOffsetPpmPerStep)) {
+Status RV3032::setOffsetPpb(int32_t ppb) {
+  if (!_initialized) {
+    return Status::Error(Err::NOT_INITIALIZED, "Call begin() first");
+  }
+  if (ppb < OFFSET_PPB_MIN || ppb > OFFSET_PPB_MAX) {
     return Status::Error(Err::INVALID_PARAM, "Offset is outside vendor range");
   }
 
+  // steps = ppb * 8192 / 1953125. The odd divisor makes ties impossible, so
+  // round-half-away matches lrintf() exactly.
+  const int32_t scaled = ppb * OFFSET_STEP_PPB_DEN;
+  const int32_t half = OFFSET_STEP_PPB_NUM / 2;
+  const int32_t value = (scaled >= 0 ? scaled + half : scaled - half) /
+                        OFFSET_STEP_PPB_NUM;
+
   const uint8_t raw = static_cast<uint8_t>(value & cmd::OFFSET_VALUE_MASK);
   return updateRegisterSingle(cmd::REG_ACTIVE_OFFSET,
                               cmd::OFFSET_REGISTER_IMPLEMENTED_MASK,
@@ -3380,9 +4282,25 @@ Status RV3032::getOffsetPpm(float& ppm) {
     return st;
   }
 
-  raw = static_cast<uint8_t>(raw & cmd::OFFSET_VALUE_MASK);
-  int8_t signedRaw = (raw & 0x20) ? static_cast<int8_t>(raw | 0xC0) : static_cast<int8_t>(raw);
-  ppm = static_cast<float>(signedRaw) * kOffsetPpmPerStep;
+  ppm = static_cast<float>(regmap::ActiveOffset::OFFSET.getSigned(raw)) *
+        kOffsetPpmPerStep;
+
+  return Status::Ok();
+}
+
+Status RV3032::getOffsetPpb(int32_t& ppb) {
+  if (!_initialized) {
+    return Status::Error(Err::NOT_INITIALIZED, "Call begin() first");
+  }
+
+  uint8_t raw = 0;
+  Status st = readRegister(cmd::REG_ACTIVE_OFFSET, raw);
+  if (!st.ok()) {
+    return st;
+  }
+
+  ppb = offsetStepsToPpb(
+      static_cast<int32_t>(regmap::ActiveOffset::OFFSET.getSigned(raw)));
 
   return Status::Ok();
 }
@@ -3412,6 +4330,18 @@ Status RV3032::getVoltageLowInterruptEnabled(bool& enabled) {
 // ===== Temperature Sensor =====
 
 Status RV3032::readTemperatureC(float& celsius) {
+  int16_t sixteenths = 0;
+  Status st = readTemperatureSixteenths(sixteenths);
+  if (!st.ok()) {
+    return st;
+  }
+
+  celsius = static_cast<float>(sixteenths) / 16.0f;
+
+  return Status::Ok();
+}
+
+Status RV3032::readTemperatureSixteenths(int16_t& sixteenths) {
   if (!_initialized) {
     return Status::Error(Err::NOT_INITIALIZED, "Call begin() first");
   }
@@ -3422,7 +4352,7 @@ Status RV3032::readTemperatureC(float& celsius) {
     return st;
   }
 
-  celsius = static_cast<float>(decodeTemperatureRaw(buf)) / 16.0f;
+  sixteenths = decodeTemperatureRaw(buf);
 
   return Status::Ok();
 }
@@ -3435,13 +4365,13 @@ Status RV3032::startReadCoherentTemperatureJob(
   if (!workIdle()) {
     return Status::Error(Err::BUSY, "Driver work already in progress");
   }
-  const uint32_t minimumTimeoutMs = twoTransferJobMinimumTimeoutMs();
+  const uint32_t minimumTimeoutMs = transferJobMinimumTimeoutMs(TWO_TRANSFER_JOB_CALLBACK_CAP);
   if (operationTimeoutMs < minimumTimeoutMs || operationTimeoutMs > 1000) {
     return Status::Error(Err::INVALID_PARAM,
                          "Temperature timeout is not executable",
                          static_cast<int32_t>(minimumTimeoutMs));
   }
-  _job = JobOp{};
+  resetJob();
   _job.activeKind = JobKind::READ_COHERENT_TEMPERATURE;
   _job.state = JobState::READ_TEMPERATURE_FIRST;
   _job.deadlineMs = nowMs + operationTimeoutMs;
@@ -3481,7 +4411,7 @@ Status RV3032::setTemperatureEventConfig(
   const uint8_t overwrite = static_cast<uint8_t>(
       (config.lowTimestampOverwrite ? (1u << cmd::TS_TLOW_OVERWRITE_BIT) : 0) |
       (config.highTimestampOverwrite ? (1u << cmd::TS_THIGH_OVERWRITE_BIT) : 0));
-  _job = JobOp{};
+  resetJob();
   _job.activeKind = JobKind::SET_TEMPERATURE_EVENT_CONFIG;
   _job.temperatureTarget[0] = control3;
   _job.temperatureTarget[1] = overwrite;
@@ -3598,11 +4528,11 @@ Status RV3032::getEviConfig(EviConfig& out) {
   const uint8_t ts = values[0];
   const uint8_t evi = values[2];
 
-  out.rising = ((evi & (1u << cmd::EVI_EB_BIT)) != 0);
-  out.debounce = static_cast<EviDebounce>((evi & cmd::EVI_DB_MASK) >> cmd::EVI_DB_SHIFT);
-  out.overwrite = ((ts & (1u << cmd::TS_EVI_OVERWRITE_BIT)) != 0);
-  out.synchronized = (evi & (1u << cmd::EVI_ESYN_BIT)) != 0;
-  out.clkoutStopDelay = (evi & (1u << cmd::EVI_CLKDE_BIT)) != 0;
+  out.rising = regmap::EviControl::EHL.test(evi);
+  out.debounce = static_cast<EviDebounce>(regmap::EviControl::ET.get(evi));
+  out.overwrite = regmap::TsControl::EVOW.test(ts);
+  out.synchronized = regmap::EviControl::ESYN.test(evi);
+  out.clkoutStopDelay = regmap::EviControl::CLKDE.test(evi);
 
   return Status::Ok();
 }
@@ -3706,7 +4636,11 @@ Status RV3032::readTimestamp(TimestampSource source, Timestamp& out) {
   if (!st.ok()) {
     return st;
   }
+  return decodeTimestamp(source, buf, len, out);
+}
 
+Status RV3032::decodeTimestamp(TimestampSource source, const uint8_t* buf,
+                               size_t len, Timestamp& out) {
   const bool hasHundredths = (source == TimestampSource::Evi);
   const size_t timeOffset = hasHundredths ? 2U : 1U;
   bool allZero = buf[0] == 0;
@@ -3779,7 +4713,7 @@ Status RV3032::resetTimestamp(TimestampSource source) {
     if (!workIdle()) {
       return Status::Error(Err::BUSY, "Driver work already in progress");
     }
-    _job = JobOp{};
+    resetJob();
     _job.activeKind = JobKind::REGISTER_UPDATE;
     _job.registerUpdateReg = cmd::REG_TS_CONTROL;
     _job.quiescenceGuard = QuiescenceGuard{
@@ -3819,6 +4753,7 @@ Status RV3032::readStatusFlags(StatusFlags& out) {
   }
 
   out = decodeStatusFlags(status);
+  notePowerStatus(status);
 
   return Status::Ok();
 }
@@ -3833,7 +4768,7 @@ Status RV3032::clearStatus(uint8_t mask) {
   if (!workIdle()) {
     return Status::Error(Err::BUSY, "Driver work already in progress");
   }
-  _job = JobOp{};
+  resetJob();
   _job.activeKind = JobKind::REGISTER_UPDATE;
   _job.registerUpdateReg = cmd::REG_STATUS;
   _job.registerUpdateImplementedMask = 0xFF;
@@ -3925,6 +4860,14 @@ bool RV3032::isValidDateTime(const DateTime& time) {
   return true;
 }
 
+Status RV3032::makeValidDateTime(const DateTime& time, ValidDateTime& out) {
+  if (!isValidDateTime(time)) {
+    return Status::Error(Err::INVALID_DATETIME, "Invalid date/time");
+  }
+  out = ValidDateTime(time);
+  return Status::Ok();
+}
+
 Status RV3032::computeWeekday(uint16_t year, uint8_t month, uint8_t day,
                               uint8_t& weekday) {
   DateTime date{};
@@ -3963,38 +4906,152 @@ Status RV3032::parseBuildTime(DateTime& out) {
     return Status::Error(Err::INVALID_DATETIME, "Invalid build time");
   }
 
-  static const char* const months[] = {
-      "Jan", "Feb", "Mar", "Apr", "May", "Jun",
-      "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"};
-  uint8_t month = 0;
-  for (uint8_t i = 0; i < 12; ++i) {
-    if (strcmp(monthStr, months[i]) == 0) {
-      month = static_cast<uint8_t>(i + 1U);
-      break;
+  static const char* const months[] = {
+      "Jan", "Feb", "Mar", "Apr", "May", "Jun",
+      "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"};
+  uint8_t month = 0;
+  for (uint8_t i = 0; i < 12; ++i) {
+    if (strcmp(monthStr, months[i]) == 0) {
+      month = static_cast<uint8_t>(i + 1U);
+      break;
+    }
+  }
+  if (month == 0) {
+    return Status::Error(Err::INVALID_DATETIME, "Invalid build month");
+  }
+  if (year < 2000 || year > 2099 || day < 1 || day > 31 ||
+      hour < 0 || hour > 23 || minute < 0 || minute > 59 ||
+      second < 0 || second > 59) {
+    return Status::Error(Err::INVALID_DATETIME,
+                         "Build date/time out of range");
+  }
+
+  DateTime parsed{};
+  parsed.year = static_cast<uint16_t>(year);
+  parsed.month = month;
+  parsed.day = static_cast<uint8_t>(day);
+  parsed.hour = static_cast<uint8_t>(hour);
+  parsed.minute = static_cast<uint8_t>(minute);
+  parsed.second = static_cast<uint8_t>(second);
+  if (!isValidDateTime(parsed)) {
+    return Status::Error(Err::INVALID_DATETIME, "Build date/time out of range");
+  }
+  parsed.weekday = weekdayFromValidDate(parsed.year, parsed.month, parsed.day);
+  out = parsed;
+  return Status::Ok();
+}
+
+namespace {
+
+constexpr char kDigitPairs[] =
+    "00010203040506070809101112131415161718192021222324"
+    "25262728293031323334353637383940414243444546474849"
+    "50515253545556575859606162636465666768697071727374"
+    "75767778798081828384858687888990919293949596979899";
+
+inline char* writeDigitPair(char* out, uint8_t value) {
+  out[0] = kDigitPairs[value * 2U];
+  out[1] = kDigitPairs[value * 2U + 1U];
+  return out + 2;
+}
+
+// Stops at a non-digit first character, so text[1] is never read past a NUL.
+inline bool readDigitPair(const char* text, uint8_t& value) {
+  const uint8_t tens = static_cast<uint8_t>(text[0] - '0');
+  if (tens > 9) {
+    return false;
+  }
+  const uint8_t ones = static_cast<uint8_t>(text[1] - '0');
+  if (ones > 9) {
+    return false;
+  }
+  value = static_cast<uint8_t>(tens * 10U + ones);
+  return true;
+}
+
+}  // namespace
+
+Status RV3032::formatIso8601(const DateTime& time, uint8_t hundredths,
+                             char* out, size_t size) {
+  if (!isValidDateTime(time)) {
+    return Status::Error(Err::INVALID_DATETIME, "Invalid date/time");
+  }
+  const bool fraction = hundredths != ISO8601_NO_HUNDREDTHS;
+  if (fraction && hundredths > 99) {
+    return Status::Error(Err::INVALID_PARAM, "Hundredths must be 0..99");
+  }
+  const size_t needed =
+      fraction ? ISO8601_BUFFER_SIZE : ISO8601_BUFFER_SIZE - 3U;
+  if (out == nullptr || size < needed) {
+    return Status::Error(Err::INVALID_PARAM, "ISO-8601 buffer too small");
+  }
+  char* p = writeDigitPair(out, static_cast<uint8_t>(time.year / 100U));
+  p = writeDigitPair(p, static_cast<uint8_t>(time.year % 100U));
+  *p++ = '-';
+  p = writeDigitPair(p, time.month);
+  *p++ = '-';
+  p = writeDigitPair(p, time.day);
+  *p++ = 'T';
+  p = writeDigitPair(p, time.hour);
+  *p++ = ':';
+  p = writeDigitPair(p, time.minute);
+  *p++ = ':';
+  p = writeDigitPair(p, time.second);
+  if (fraction) {
+    *p++ = '.';
+    p = writeDigitPair(p, hundredths);
+  }
+  *p++ = 'Z';
+  *p = '\0';
+  return Status::Ok();
+}
+
+Status RV3032::parseIso8601(const char* text, DateTime& out,
+                            uint8_t* hundredths) {
+  if (text == nullptr) {
+    return Status::Error(Err::INVALID_PARAM, "ISO-8601 text is null");
+  }
+  // Fixed layout "CCYY-MM-DDTHH:MM:SS"; every index is checked before the
+  // next is read, so a short string stops at its NUL.
+  static constexpr char kLayout[] = "dddd-dd-ddTdd:dd:dd";
+  for (size_t i = 0; i + 1U < sizeof(kLayout); ++i) {
+    const char c = text[i];
+    const bool ok = kLayout[i] == 'd' ? (c >= '0' && c <= '9') : c == kLayout[i];
+    if (!ok) {
+      return Status::Error(Err::INVALID_DATETIME, "Malformed ISO-8601 text");
     }
   }
-  if (month == 0) {
-    return Status::Error(Err::INVALID_DATETIME, "Invalid build month");
+  const char* tail = text + sizeof(kLayout) - 1U;
+  uint8_t fraction = ISO8601_NO_HUNDREDTHS;
+  if (tail[0] == '.') {
+    if (!readDigitPair(tail + 1, fraction)) {
+      return Status::Error(Err::INVALID_DATETIME, "Malformed ISO-8601 text");
+    }
+    tail += 3;
   }
-  if (year < 2000 || year > 2099 || day < 1 || day > 31 ||
-      hour < 0 || hour > 23 || minute < 0 || minute > 59 ||
-      second < 0 || second > 59) {
-    return Status::Error(Err::INVALID_DATETIME,
-                         "Build date/time out of range");
+  if (tail[0] != 'Z' || tail[1] != '\0') {
+    return Status::Error(Err::INVALID_DATETIME, "Malformed ISO-8601 text");
   }
 
+  uint8_t century = 0;
+  uint8_t yy = 0;
   DateTime parsed{};
-  parsed.year = static_cast<uint16_t>(year);
-  parsed.month = month;
-  parsed.day = static_cast<uint8_t>(day);
-  parsed.hour = static_cast<uint8_t>(hour);
-  parsed.minute = static_cast<uint8_t>(minute);
-  parsed.second = static_cast<uint8_t>(second);
+  (void)readDigitPair(text, century);
+  (void)readDigitPair(text + 2, yy);
+  (void)readDigitPair(text + 5, parsed.month);
+  (void)readDigitPair(text + 8, parsed.day);
+  (void)readDigitPair(text + 11, parsed.hour);
+  (void)readDigitPair(text + 14, parsed.minute);
+  (void)readDigitPair(text + 17, parsed.second);
+  parsed.year = static_cast<uint16_t>(century * 100U + yy);
   if (!isValidDateTime(parsed)) {
-    return Status::Error(Err::INVALID_DATETIME, "Build date/time out of range");
+    return Status::Error(Err::INVALID_DATETIME, "ISO-8601 date/time out of range");
   }
   parsed.weekday = weekdayFromValidDate(parsed.year, parsed.month, parsed.day);
   out = parsed;
+  if (hundredths != nullptr) {
+    *hundredths = fraction;
+  }
   return Status::Ok();
 }
 
@@ -4025,9 +5082,39 @@ Status RV3032::validateReadRegsRequest(
 Status RV3032::readRegs(uint8_t reg, uint8_t* buf, size_t len) {
   const Status validation = validateReadRegsRequest(reg, buf, len);
   if (!validation.ok()) return validation;
+  if (batchCacheServes(reg, buf, len)) return Status::Ok();
   uint8_t tx = reg;
   // Use tracked wrapper - health is updated automatically
-  return _i2cWriteReadTracked(&tx, 1, buf, len);
+  const Status st = _i2cWriteReadTracked(&tx, 1, buf, len);
+  if (st.ok()) batchCacheFill(reg, buf, len);
+  return st;
+}
+
+bool RV3032::batchCacheServes(uint8_t reg, uint8_t* buf, size_t len) const {
+  if (!_batch.active) return false;
+  for (size_t i = 0; i < len; ++i) {
+    const size_t address = reg + i;
+    if (address >= sizeof(_batch.values) ||
+        (_batch.validMask & (1UL << address)) == 0) {
+      return false;
+    }
+  }
+  std::memcpy(buf, &_batch.values[reg], len);
+  return true;
+}
+
+void RV3032::batchCacheFill(uint8_t reg, const uint8_t* buf, size_t len) {
+  if (!_batch.active) return;
+  for (size_t i = 0; i < len; ++i) {
+    const size_t address = reg + i;
+    if (address >= sizeof(_batch.values) ||
+        !regmap::contains(regmap::BATCH_CACHEABLE_BITMAP,
+                          static_cast<uint8_t>(address))) {
+      continue;
+    }
+    _batch.values[address] = buf[i];
+    _batch.validMask |= 1UL << address;
+  }
 }
 
 Status RV3032::validateWriteRegsRequest(
@@ -4650,6 +5737,22 @@ Status RV3032::processPersistentJob(uint32_t& nowMs, bool& callbackUsed) {
     return static_cast<uint8_t>(_job.persistentAddress +
                                 _job.persistentIndex);
   };
+  const bool primaryCell = _job.activeKind == JobKind::ENSURE_PRIMARY_CELL;
+  // Primary-cell cleanup leaves the proven target active with auto-refresh
+  // restored, or holds the safe C0 with EERD set when persistence is unproven.
+  auto primaryActiveTarget = [&]() -> uint8_t {
+    return _job.primaryCellTrusted
+        ? _job.primaryCell.persistentTarget
+        : _job.persistentSafeC0;
+  };
+  auto primaryControl1Target = [&]() -> uint8_t {
+    const uint8_t original = static_cast<uint8_t>(
+        _job.persistentControl1 & cmd::CONTROL1_IMPLEMENTED_MASK);
+    if (!_job.primaryCellAccessVerified) return original;
+    return _job.primaryCellTrusted
+        ? static_cast<uint8_t>(original & ~cmd::CONTROL1_EERD_MASK)
+        : static_cast<uint8_t>(original | cmd::CONTROL1_EERD_MASK);
+  };
   auto nextByteOrCleanup = [&]() {
     ++_job.persistentIndex;
     _job.persistentWriteAttempted = false;
@@ -4674,6 +5777,14 @@ Status RV3032::processPersistentJob(uint32_t& nowMs, bool& callbackUsed) {
     // invent C0/Control 1 restore writes after the reserved interval begins.
     return finishOperation(cutoff);
   }
+  // A primary-cell cancel still proves a dispatched EERD write, because only
+  // a verified EERD lets cleanup hold safe C0 instead of restoring Control 1.
+  if (!cleanupState && _job.persistentCancelRequested &&
+      !(primaryCell && _job.persistentState == EepromState::VERIFY_EERD)) {
+    // cancelJob() already latched JOB_CANCELLED; skip the forward steps.
+    beginCleanup();
+    return inProgress;
+  }
 
   switch (_job.persistentState) {
     case EepromState::READ_CONTROL1: {
@@ -4727,6 +5838,7 @@ Status RV3032::processPersistentJob(uint32_t& nowMs, bool& callbackUsed) {
                                       "EERD enable verification failed"));
         return inProgress;
       }
+      if (primaryCell) _job.primaryCellAccessVerified = true;
       _job.persistentState = EepromState::WAIT_READY;
       _job.persistentReadyChecks = 0;
       _job.persistentPhaseDeadlineMs = nowMs + EEPROM_READY_TIMEOUT_MS;
@@ -4804,6 +5916,7 @@ Status RV3032::processPersistentJob(uint32_t& nowMs, bool& callbackUsed) {
         return inProgress;
       }
       _job.persistentSafeC0Verified = true;
+      if (primaryCell) _job.primaryCellSafeHeld = true;
       _job.persistentState = EepromState::WRITE_ADDR;
       return inProgress;
     }
@@ -4974,6 +6087,7 @@ Status RV3032::processPersistentJob(uint32_t& nowMs, bool& callbackUsed) {
                                       "Persistent two-read proof failed"));
         return inProgress;
       }
+      cachePersistentByte(currentAddress(), value);
       if (!_job.persistentWriteMode) {
         _job.persistentRead.data[_job.persistentIndex] = value;
         ++_job.persistentRead.length;
@@ -4983,6 +6097,35 @@ Status RV3032::processPersistentJob(uint32_t& nowMs, bool& callbackUsed) {
         nextByteOrCleanup();
         return inProgress;
       }
+      if (primaryCell) {
+        PrimaryCellConfigurationReport& report = _job.primaryCell;
+        if (!_job.persistentWriteAttempted) {
+          report.persistentBefore = value;
+          report.persistentBeforeValid = true;
+          report.persistentTarget = static_cast<uint8_t>(
+              (value & cmd::PMU_PRIMARY_PRESERVE_MASK) | cmd::PMU_BSM_LEVEL);
+          _job.userRamBuf[0] = report.persistentTarget;
+          if (value == report.persistentTarget) {
+            report.persistentAfter = value;
+            report.persistentAfterValid = true;
+            report.persistentTargetVerified = true;
+            _job.primaryCellTrusted = true;
+          }
+        } else {
+          report.persistentAfter = value;
+          report.persistentAfterValid = true;
+          if (value == report.persistentTarget) {
+            report.persistentTargetVerified = true;
+            // A possibly committed command error is reconciled only here.
+            if (_job.persistentOperationStatus.ok()) {
+              _job.primaryCellTrusted = true;
+              report.writeDurablyVerified = true;
+            }
+          } else if (!_job.primaryCellCommandStatus.ok()) {
+            _job.persistentOperationStatus = _job.primaryCellCommandStatus;
+          }
+        }
+      }
       const uint8_t desired = _job.userRamBuf[_job.persistentIndex];
       if (_job.persistentWriteAttempted && value != desired) {
         rememberFailure(Status::Error(
@@ -5067,6 +6210,9 @@ Status RV3032::processPersistentJob(uint32_t& nowMs, bool& callbackUsed) {
           cmd::REG_EE_COMMAND, &command, 1, nowMs, transferBoundary(true));
       callbackUsed = transfer.callbackInvoked;
       _job.persistentWriteAttempted = transfer.callbackInvoked;
+      if (transfer.callbackInvoked) {
+        dropPersistentByte(currentAddress());
+      }
       if (!transfer.callbackInvoked) {
         if (_job.persistentCleanupRequired) {
           rememberFailure(transfer.status);
@@ -5075,7 +6221,12 @@ Status RV3032::processPersistentJob(uint32_t& nowMs, bool& callbackUsed) {
         return finishOperation(transfer.status);
       }
       _job.persistentCleanupRequired = true;
-      rememberOperationFailure(transfer.status);
+      if (primaryCell) {
+        _job.primaryCell.writeCommandAttempted = true;
+        _job.primaryCellCommandStatus = transfer.status;
+      } else {
+        rememberOperationFailure(transfer.status);
+      }
       // Never resend this may-have-committed command. Later READ_ONE proof
       // determines durability regardless of the effective callback status.
       const uint32_t commandCompletedMs = nowMs;
@@ -5173,9 +6324,35 @@ Status RV3032::processPersistentJob(uint32_t& nowMs, bool& callbackUsed) {
     }
     case EepromState::RESTORE_ACTIVE:
       if (!_job.persistentActiveC0Valid) {
+        if (primaryCell && _job.primaryCellAccessVerified) {
+          // EERD is set but the prepare stage never proved safe C0. Read the
+          // mirror like the blocking cleanup does so the charger bits are
+          // cleared before Control 1 is touched.
+          Status st = readPersistent(cmd::REG_ACTIVE_PMU,
+                                     &_job.persistentActiveC0, 1);
+          if (!st.ok()) {
+            rememberCleanupFailure(st, false);
+            _job.persistentState = EepromState::RESTORE_CONTROL1;
+            return inProgress;
+          }
+          _job.persistentActiveC0Valid = true;
+          _job.persistentSafeC0 = static_cast<uint8_t>(
+              _job.persistentActiveC0 & cmd::PMU_PRIMARY_PRESERVE_MASK);
+          return inProgress;
+        }
         _job.persistentState = EepromState::RESTORE_CONTROL1;
         return inProgress;
       }
+      if (primaryCell) {
+        // A verified safe hold needs no second write, only fresh evidence.
+        if (_job.primaryCellTrusted || !_job.persistentSafeC0Verified) {
+          const uint8_t value = primaryActiveTarget();
+          Status st = writePersistent(cmd::REG_ACTIVE_PMU, &value, 1);
+          rememberCleanupFailure(st, true);
+        }
+        _job.persistentState = EepromState::VERIFY_ACTIVE;
+        return inProgress;
+      }
       {
         const bool restoreQueuedC0 =
             _job.activeKind == JobKind::NONE &&
@@ -5197,16 +6374,22 @@ Status RV3032::processPersistentJob(uint32_t& nowMs, bool& callbackUsed) {
           _job.activeKind == JobKind::NONE &&
           _job.persistentSafeC0Verified &&
           _job.persistentAddress == cmd::REG_ACTIVE_PMU;
-      const uint8_t expected = static_cast<uint8_t>(
-          (restoreQueuedC0 ? _job.userRamBuf[0]
-                           : _job.persistentActiveC0) &
-          cmd::PMU_IMPLEMENTED_MASK);
+      const uint8_t expected = primaryCell
+          ? primaryActiveTarget()
+          : static_cast<uint8_t>(
+                (restoreQueuedC0 ? _job.userRamBuf[0]
+                                 : _job.persistentActiveC0) &
+                cmd::PMU_IMPLEMENTED_MASK);
       if (!st.ok()) {
         rememberCleanupFailure(st, false);
       } else if ((value & cmd::PMU_IMPLEMENTED_MASK) != expected) {
         rememberCleanupFailure(Status::Error(
             Err::EEPROM_VERIFY_FAILED,
             "Active PMU cleanup verification failed"), false);
+      } else if (primaryCell) {
+        _job.primaryCell.activeAfter = value;
+        _job.primaryCell.activeTargetVerified = _job.primaryCellTrusted;
+        if (!_job.primaryCellTrusted) _job.primaryCellSafeHeld = true;
       }
       _job.persistentState = EepromState::RESTORE_CONTROL1;
       return inProgress;
@@ -5218,8 +6401,10 @@ Status RV3032::processPersistentJob(uint32_t& nowMs, bool& callbackUsed) {
             "Control 1 cleanup evidence unavailable"));
       }
       {
-        const uint8_t value = static_cast<uint8_t>(
-            _job.persistentControl1 & cmd::CONTROL1_IMPLEMENTED_MASK);
+        const uint8_t value = primaryCell
+            ? primaryControl1Target()
+            : static_cast<uint8_t>(
+                  _job.persistentControl1 & cmd::CONTROL1_IMPLEMENTED_MASK);
         Status st = writePersistent(cmd::REG_CONTROL1, &value, 1);
         rememberCleanupFailure(st, true);
       }
@@ -5228,17 +6413,27 @@ Status RV3032::processPersistentJob(uint32_t& nowMs, bool& callbackUsed) {
     case EepromState::VERIFY_CONTROL1: {
       uint8_t value = 0;
       Status st = readPersistent(cmd::REG_CONTROL1, &value, 1);
-      const uint8_t expected = static_cast<uint8_t>(
-          _job.persistentControl1 & cmd::CONTROL1_IMPLEMENTED_MASK);
+      const uint8_t expected = primaryCell
+          ? primaryControl1Target()
+          : static_cast<uint8_t>(
+                _job.persistentControl1 & cmd::CONTROL1_IMPLEMENTED_MASK);
       if (!st.ok()) {
         rememberCleanupFailure(st, false);
       } else if ((value & cmd::CONTROL1_IMPLEMENTED_MASK) != expected) {
         rememberCleanupFailure(Status::Error(
             Err::EEPROM_VERIFY_FAILED,
             "Control 1 cleanup verification failed"), false);
-      } else if (_job.persistentCleanupProofPossible) {
-        _job.persistentRead.cleanupVerified = true;
-        _job.userEepromWrite.cleanupVerified = true;
+      } else {
+        if (primaryCell) {
+          _job.primaryCell.control1After = value;
+          _job.primaryCell.autoRefreshHeldDisabledForSafety =
+              !_job.primaryCellTrusted && _job.primaryCellSafeHeld &&
+              (value & cmd::CONTROL1_EERD_MASK) != 0;
+        }
+        if (_job.persistentCleanupProofPossible) {
+          _job.persistentRead.cleanupVerified = true;
+          _job.userEepromWrite.cleanupVerified = true;
+        }
       }
       _job.persistentNotBeforeMs =
           nowMs + EEPROM_WRITE_SETTLE_MS;
@@ -5301,14 +6496,17 @@ Status RV3032::processEeprom(uint32_t now_ms, uint8_t maxInstructions, uint8_t&
   }
 
   uint32_t currentNowMs = now_ms;
+  _clockStampValid = false;
   while (instructionsUsed < maxInstructions) {
-    if (_config.nowMs != nullptr) {
+    if (_config.nowMs != nullptr && !_clockStampCurrent(currentNowMs)) {
       const uint32_t observedNowMs = _nowMs();
       if (static_cast<int32_t>(observedNowMs - currentNowMs) > 0) {
         currentNowMs = observedNowMs;
       }
+      _noteClockStamp(currentNowMs);
     }
     if (_eeprom.state == EepromState::IDLE) {
+      releaseWriteBehind(currentNowMs, false);
       uint8_t nextReg = 0;
       uint8_t nextValue = 0;
       if (!eepromQueuePop(nextReg, nextValue)) {
@@ -5320,7 +6518,7 @@ Status RV3032::processEeprom(uint32_t now_ms, uint8_t maxInstructions, uint8_t&
     }
 
     if (_job.state == JobState::IDLE) {
-      _job = JobOp{};
+      resetPersistentEngine();
       _job.state = JobState::PERSISTENT;
       _job.activeKind = JobKind::NONE; // queue owns the shared engine
       _job.persistentState = EepromState::READ_CONTROL1;
@@ -5360,7 +6558,7 @@ Status RV3032::processEeprom(uint32_t now_ms, uint8_t maxInstructions, uint8_t&
       // caller starved the reserved cleanup interval, the device access state
       // is unverified; never continue into another admitted queue item.
       _eeprom = EepromOp{};
-      _job = JobOp{};
+      resetPersistentEngine();
       return terminal;
     }
 
@@ -5393,7 +6591,7 @@ Status RV3032::processEeprom(uint32_t now_ms, uint8_t maxInstructions, uint8_t&
       latchItemEvidence();
       ++_eepromWriteFailures;
       _eeprom = EepromOp{};
-      _job = JobOp{};
+      resetPersistentEngine();
       return terminal;
     }
     if (st.inProgress()) {
@@ -5412,11 +6610,11 @@ Status RV3032::processEeprom(uint32_t now_ms, uint8_t maxInstructions, uint8_t&
       // entries and return the observable terminal error instead of issuing
       // more device commands.
       _eeprom = EepromOp{};
-      _job = JobOp{};
+      resetPersistentEngine();
       return eepromTerminalStatus();
     }
     _eeprom.state = EepromState::IDLE;
-    _job = JobOp{};
+    resetPersistentEngine();
     if (!st.ok()) {
       // Preserve ordinary remaining items, but expose this exact failure at
       // the item boundary instead of letting a later success hide it.
@@ -5477,6 +6675,65 @@ bool RV3032::eepromQueuePop(uint8_t& reg, uint8_t& value) {
   return true;
 }
 
+bool RV3032::queuePersistence(uint8_t reg, uint8_t value, uint32_t nowMs) {
+  if (_config.persistenceDebounceMs == 0 || reg < cmd::REG_ACTIVE_PMU ||
+      reg > cmd::REG_ACTIVE_TREFERENCE1) {
+    return eepromQueuePush(reg, value);
+  }
+  // Latest value wins; an unchanged value keeps its running window.
+  WriteBehindSlot& slot = _eeprom.writeBehind[reg - cmd::REG_ACTIVE_PMU];
+  if (slot.pending && slot.value == value) {
+    return true;
+  }
+  if (!slot.pending) {
+    ++_eeprom.writeBehindCount;
+  }
+  slot.value = value;
+  slot.changedMs = nowMs;
+  slot.pending = true;
+  return true;
+}
+
+uint8_t RV3032::persistenceCapacity() const {
+  // Staging never runs out: every persistable register owns a slot.
+  if (_config.persistenceDebounceMs != 0) {
+    return static_cast<uint8_t>(kWriteBehindSlots);
+  }
+  return static_cast<uint8_t>(kEepromQueueSize - _eeprom.queueCount);
+}
+
+void RV3032::releaseWriteBehind(uint32_t nowMs, bool force) {
+  for (uint8_t i = 0; i < kWriteBehindSlots && _eeprom.writeBehindCount > 0;
+       ++i) {
+    WriteBehindSlot& slot = _eeprom.writeBehind[i];
+    if (!slot.pending) continue;
+    if (!force &&
+        !hasDeadlinePassed(nowMs,
+                           slot.changedMs + _config.persistenceDebounceMs)) {
+      continue;
+    }
+    if (!eepromQueuePush(static_cast<uint8_t>(cmd::REG_ACTIVE_PMU + i),
+                         slot.value)) {
+      return;  // Queue full; stay staged until a later poll or flush.
+    }
+    slot.pending = false;
+    --_eeprom.writeBehindCount;
+  }
+}
+
+Status RV3032::flushPersistence() {
+  if (!_initialized) {
+    return Status::Error(Err::NOT_INITIALIZED, "Call begin() first");
+  }
+  releaseWriteBehind(0, true);
+  if (_eeprom.writeBehindCount > 0) {
+    return Status::Error(Err::QUEUE_FULL,
+                         "EEPROM queue lacks room for staged persistence",
+                         _eeprom.writeBehindCount);
+  }
+  return getEepromStatus();
+}
+
 Status RV3032::readEepromFlags(bool& busy, bool& failed) {
   // EEPROM busy and error flags are in Temperature LSBs register (0x0E).
   uint8_t tempLsb = 0;
@@ -5504,6 +6761,111 @@ StatusFlags RV3032::decodeStatusFlags(uint8_t raw) {
   return flags;
 }
 
+Status RV3032::decodeAlarmConfig(const uint8_t* buf, AlarmConfig& out) {
+  const uint8_t minReg = buf[0];
+  const uint8_t hourReg = buf[1];
+  const uint8_t dateReg = buf[2];
+  if ((hourReg & 0x40u) != 0 || (dateReg & 0x40u) != 0) {
+    return Status::Error(Err::INVALID_PARAM, "Alarm registers contain reserved bits");
+  }
+
+  out.matchMinute = ((minReg & 0x80) == 0);
+  out.matchHour = ((hourReg & 0x80) == 0);
+  out.matchDate = ((dateReg & 0x80) == 0);
+
+  const uint8_t minRaw = static_cast<uint8_t>(minReg & 0x7F);
+  const uint8_t hourRaw = static_cast<uint8_t>(hourReg & 0x7F);
+  const uint8_t dateRaw = static_cast<uint8_t>(dateReg & 0x7F);
+
+  auto decodeAlarmField = [&](uint8_t rawBcd, bool fieldEnabled,
+                              uint8_t minValue, uint8_t maxValue,
+                              uint8_t disabledFallback,
+                              bool allowEnabledZero,
+                              uint8_t& outValue) -> Status {
+    if (!isValidBcd(rawBcd)) {
+      if (fieldEnabled) {
+        return Status::Error(Err::INVALID_PARAM, "Alarm registers contain invalid BCD");
+      }
+      outValue = disabledFallback;
+      return Status::Ok();
+    }
+    const uint8_t value = bcdToBin(rawBcd);
+    if (value < minValue || value > maxValue) {
+      if (fieldEnabled && allowEnabledZero && value == 0) {
+        outValue = 0;
+        return Status::Ok();
+      }
+      if (fieldEnabled) {
+        return Status::Error(Err::INVALID_PARAM, "Alarm registers out of range");
+      }
+      outValue = disabledFallback;
+      return Status::Ok();
+    }
+    outValue = value;
+    return Status::Ok();
+  };
+
+  Status decode = decodeAlarmField(minRaw, out.matchMinute, 0, 59, 0, false, out.minute);
+  if (!decode.ok()) {
+    return decode;
+  }
+  decode = decodeAlarmField(hourRaw, out.matchHour, 0, 23, 0, false, out.hour);
+  if (!decode.ok()) {
+    return decode;
+  }
+  // RV-3032-C7 reset state uses AE_D=0 with Date Alarm=00h to keep the alarm
+  // function inactive. Report that documented hardware state instead of failing.
+  decode = decodeAlarmField(dateRaw, out.matchDate, 1, 31, 1, true, out.date);
+  if (!decode.ok()) {
+    return decode;
+  }
+
+  return Status::Ok();
+}
+
+Status RV3032::decodeTimer(const uint8_t* buf, uint16_t& ticks,
+                           TimerFrequency& freq, bool& enabled) {
+  const uint8_t low = buf[0];
+  const uint8_t high = buf[1];
+  const uint8_t control1 = buf[5];
+  if ((high & 0xF0u) != 0) {
+    return Status::Error(Err::INVALID_PARAM,
+                         "Timer high register contains reserved bits");
+  }
+
+  ticks = static_cast<uint16_t>((static_cast<uint16_t>(high & 0x0F) << 8) | low);
+  freq = static_cast<TimerFrequency>(control1 & cmd::CTRL1_TD_MASK);
+  enabled = ((control1 & (1u << cmd::CTRL1_TE_BIT)) != 0);
+  return Status::Ok();
+}
+
+void RV3032::decodeTelemetryFrame(const uint8_t* buf, TelemetryFrame& out) {
+  const auto at = [&](uint8_t reg) -> const uint8_t* {
+    return &buf[reg - cmd::REG_100TH_SECONDS];
+  };
+  TelemetryFrame frame{};
+  frame.timeValid = decodeCalendar(at(cmd::REG_SECONDS), frame.time);
+  const uint8_t hundredths = *at(cmd::REG_100TH_SECONDS);
+  frame.hundredthsValid = isValidBcd(hundredths);
+  if (frame.hundredthsValid) frame.hundredths = bcdToBin(hundredths);
+  AlarmConfig alarm{};
+  frame.alarmValid = decodeAlarmConfig(at(cmd::REG_ALARM_MINUTE), alarm).ok();
+  if (frame.alarmValid) frame.alarm = alarm;
+  const uint8_t timerHigh = *at(cmd::REG_TIMER_HIGH);
+  frame.timerValid = (timerHigh & 0xF0u) == 0;
+  if (frame.timerValid) {
+    frame.timerTicks = static_cast<uint16_t>(
+        (static_cast<uint16_t>(timerHigh) << 8) | *at(cmd::REG_TIMER_LOW));
+  }
+  frame.statusRaw = *at(cmd::REG_STATUS);
+  frame.statusFlags = decodeStatusFlags(frame.statusRaw);
+  frame.tempLsbRaw = *at(cmd::REG_TEMP_LSB);
+  frame.temperatureRaw = decodeTemperatureRaw(at(cmd::REG_TEMP_LSB));
+  frame.temperatureC = static_cast<float>(frame.temperatureRaw) / 16.0f;
+  frame.statusValid = true;
+  out = frame;
+}
+
 bool RV3032::decodeCalendar(const uint8_t* data, DateTime& out) {
   if (data == nullptr || (data[0] & 0x80u) != 0 ||
       (data[1] & 0x80u) != 0 || (data[2] & 0xC0u) != 0 ||
@@ -5534,12 +6896,9 @@ bool RV3032::decodeCalendar(const uint8_t* data, DateTime& out) {
 
 bool RV3032::acceptedVerifiedTime(const DateTime& requested,
                                   const DateTime& observed) {
-  uint32_t requestedUnix = 0;
-  uint32_t observedUnix = 0;
-  if (!dateTimeToUnix(requested, requestedUnix).ok() ||
-      !dateTimeToUnix(observed, observedUnix).ok()) {
-    return false;
-  }
+  // requested was validated at admission and observed by decodeCalendar().
+  const uint32_t requestedUnix = validDateTimeToUnix(requested);
+  const uint32_t observedUnix = validDateTimeToUnix(observed);
   if (observedUnix == requestedUnix) {
     return true;
   }
@@ -5674,6 +7033,7 @@ Status RV3032::readValidity(ValidityFlags& out) {
   }
   const uint8_t status = values[0];
   const uint8_t tempLsb = values[1];
+  notePowerStatus(status);
 
   out.voltageLow = (status & (1u << cmd::STATUS_VLF_BIT)) != 0;
   out.powerOnReset = (status & (1u << cmd::STATUS_PORF_BIT)) != 0;
@@ -5745,15 +7105,32 @@ Status RV3032::unixToDateTime(uint32_t timestamp, DateTime& out) {
   return Status::Ok();
 }
 
-Status RV3032::dateTimeToUnix(const DateTime& time, uint32_t& timestamp) {
-  if (!isValidDateTime(time)) {
-    return Status::Error(Err::INVALID_DATETIME, "Invalid date/time");
+Status RV3032::unixToDateTime(uint32_t timestamp, ValidDateTime& out) {
+  DateTime converted{};
+  const Status st = unixToDateTime(timestamp, converted);
+  if (st.ok()) {
+    out = ValidDateTime(converted);
   }
+  return st;
+}
+
+uint32_t RV3032::validDateTimeToUnix(const DateTime& time) {
   const uint32_t days = dateToDays(time.year, time.month, time.day);
-  const uint32_t converted = days * 86400UL
+  return days * 86400UL
       + static_cast<uint32_t>(time.hour) * 3600UL
       + static_cast<uint32_t>(time.minute) * 60UL
       + static_cast<uint32_t>(time.second);
+}
+
+uint32_t RV3032::dateTimeToUnix(const ValidDateTime& time) {
+  return validDateTimeToUnix(time.value());
+}
+
+Status RV3032::dateTimeToUnix(const DateTime& time, uint32_t& timestamp) {
+  if (!isValidDateTime(time)) {
+    return Status::Error(Err::INVALID_DATETIME, "Invalid date/time");
+  }
+  const uint32_t converted = validDateTimeToUnix(time);
   if (converted < kEpoch2000 || converted > kEndOf2099) {
     return Status::Error(Err::INVALID_DATETIME,
                          "Date/time outside Unix conversion range");
@@ -5762,4 +7139,164 @@ Status RV3032::dateTimeToUnix(const DateTime& time, uint32_t& timestamp) {
   return Status::Ok();
 }
 
+PackedDateTime RV3032::packValidDateTime(const DateTime& time) {
+  const uint32_t daySlot =
+      (static_cast<uint32_t>(time.year - 2000U) * 12U + (time.month - 1U)) *
+          31U +
+      (time.day - 1U);
+  PackedDateTime packed{};
+  packed.value = daySlot * 86400UL + static_cast<uint32_t>(time.hour) * 3600UL +
+                 static_cast<uint32_t>(time.minute) * 60UL + time.second;
+  return packed;
+}
+
+PackedDateTime RV3032::packDateTime(const ValidDateTime& time) {
+  return packValidDateTime(time.value());
+}
+
+Status RV3032::packDateTime(const DateTime& time, PackedDateTime& out) {
+  if (!isValidDateTime(time)) {
+    return Status::Error(Err::INVALID_DATETIME, "Invalid date/time");
+  }
+  out = packValidDateTime(time);
+  return Status::Ok();
+}
+
+Status RV3032::packCalendarBcd(const uint8_t (&calendar)[7],
+                               PackedDateTime& out) {
+  DateTime decoded{};
+  if (!decodeCalendar(calendar, decoded)) {
+    return Status::Error(Err::INVALID_DATETIME, "Invalid calendar encoding");
+  }
+  return packDateTime(decoded, out);
+}
+
+Status RV3032::unpackDateTime(PackedDateTime packed, DateTime& out) {
+  const uint32_t daySlot = packed.value / 86400UL;
+  const uint32_t secondOfDay = packed.value % 86400UL;
+  const uint32_t monthSlot = daySlot / 31U;
+  DateTime decoded{};
+  decoded.year = static_cast<uint16_t>(2000U + monthSlot / 12U);
+  decoded.month = static_cast<uint8_t>(monthSlot % 12U + 1U);
+  decoded.day = static_cast<uint8_t>(daySlot % 31U + 1U);
+  decoded.hour = static_cast<uint8_t>(secondOfDay / 3600UL);
+  decoded.minute = static_cast<uint8_t>((secondOfDay / 60UL) % 60UL);
+  decoded.second = static_cast<uint8_t>(secondOfDay % 60UL);
+  if (!isValidDateTime(decoded)) {
+    return Status::Error(Err::INVALID_DATETIME, "Invalid packed date/time");
+  }
+  decoded.weekday =
+      weekdayFromValidDate(decoded.year, decoded.month, decoded.day);
+  out = decoded;
+  return Status::Ok();
+}
+
+Status RV3032::packedToUnix(PackedDateTime packed, uint32_t& timestamp) {
+  DateTime decoded{};
+  Status st = unpackDateTime(packed, decoded);
+  if (!st.ok()) {
+    return st;
+  }
+  return dateTimeToUnix(decoded, timestamp);
+}
+
+namespace {
+
+bool isUsableTimeZone(const TimeZone& zone) {
+  return zone.offsetsMinutes != nullptr &&
+         (zone.count == 0 || zone.transitionsUtc != nullptr);
+}
+
+/// Number of transitions at or before timestamp, i.e. the offset index.
+uint16_t timeZoneIndexAt(const TimeZone& zone, uint32_t timestamp) {
+  uint16_t low = 0;
+  uint16_t high = zone.count;
+  while (low < high) {
+    const uint16_t mid = static_cast<uint16_t>(low + (high - low) / 2U);
+    if (zone.transitionsUtc[mid] <= timestamp) {
+      low = static_cast<uint16_t>(mid + 1U);
+    } else {
+      high = mid;
+    }
+  }
+  return low;
+}
+
+}  // namespace
+
+Status RV3032::utcOffsetMinutes(const TimeZone& zone, uint32_t timestamp,
+                                int16_t& offsetMinutes) {
+  if (!isUsableTimeZone(zone)) {
+    return Status::Error(Err::INVALID_PARAM, "Time zone table is malformed");
+  }
+  if (timestamp < kEpoch2000 || timestamp > kEndOf2099) {
+    return Status::Error(Err::INVALID_DATETIME,
+                         "Unix timestamp outside 2000..2099");
+  }
+  offsetMinutes = zone.offsetsMinutes[timeZoneIndexAt(zone, timestamp)];
+  return Status::Ok();
+}
+
+Status RV3032::utcToLocal(const TimeZone& zone, const DateTime& utc,
+                          DateTime& local) {
+  uint32_t timestamp = 0;
+  Status st = dateTimeToUnix(utc, timestamp);
+  if (!st.ok()) {
+    return st;
+  }
+  int16_t offsetMinutes = 0;
+  st = utcOffsetMinutes(zone, timestamp, offsetMinutes);
+  if (!st.ok()) {
+    return st;
+  }
+  const int64_t shifted = static_cast<int64_t>(timestamp) +
+                          static_cast<int64_t>(offsetMinutes) * 60;
+  if (shifted < kEpoch2000 || shifted > kEndOf2099) {
+    return Status::Error(Err::INVALID_DATETIME,
+                         "Local time outside 2000..2099");
+  }
+  return unixToDateTime(static_cast<uint32_t>(shifted), local);
+}
+
+Status RV3032::localToUtc(const TimeZone& zone, const DateTime& local,
+                          DateTime& utc, LocalTimeFold fold) {
+  if (!isUsableTimeZone(zone)) {
+    return Status::Error(Err::INVALID_PARAM, "Time zone table is malformed");
+  }
+  uint32_t localSeconds = 0;
+  Status st = dateTimeToUnix(local, localSeconds);
+  if (!st.ok()) {
+    return st;
+  }
+
+  // Transitions are generated at least two days apart and offsets are below
+  // one day, so only the offsets around localSeconds-as-UTC can match.
+  const uint16_t index = timeZoneIndexAt(zone, localSeconds);
+  const uint16_t first = index > 0 ? static_cast<uint16_t>(index - 1U) : 0;
+  const uint16_t last = index < zone.count ? static_cast<uint16_t>(index + 1U)
+                                           : zone.count;
+  int64_t earlier = INT64_MAX;
+  int64_t later = INT64_MIN;
+  for (uint16_t i = first; i <= last; ++i) {
+    const int64_t candidate = static_cast<int64_t>(localSeconds) -
+        static_cast<int64_t>(zone.offsetsMinutes[i]) * 60;
+    if (candidate < kEpoch2000 || candidate > kEndOf2099) {
+      continue;
+    }
+    const uint16_t at = timeZoneIndexAt(zone, static_cast<uint32_t>(candidate));
+    if (zone.offsetsMinutes[at] != zone.offsetsMinutes[i]) {
+      continue;
+    }
+    earlier = candidate < earlier ? candidate : earlier;
+    later = candidate > later ? candidate : later;
+  }
+  if (later == INT64_MIN) {
+    return Status::Error(Err::INVALID_DATETIME,
+                         "Local time skipped by transition or out of range");
+  }
+  return unixToDateTime(
+      static_cast<uint32_t>(fold == LocalTimeFold::LATER ? later : earlier),
+      utc);
+}
+
 }  // namespace RV3032
@@ -0,0 +1,344 @@
+/**
+ * @file TelemetryCodec.cpp
+ * @brief Delta-compressed telemetry block encoder and decoder
+ */
+
+#include "RV3032/TelemetryCodec.h"
+
+#include <cstring>
+
+namespace RV3032 {
+
+namespace {
+
+constexpr uint32_t kEpoch2000 = 946684800UL;  // 2000-01-01 00:00:00 UTC
+constexpr uint32_t kEndOf2099 = 4102444799UL; // 2099-12-31 23:59:59 UTC
+constexpr int16_t kTemperatureMin = -2048;
+constexpr int16_t kTemperatureMax = 2047;
+// zigzag(+4095): the largest temperature step between two 12-bit readings.
+constexpr uint64_t kMaxTemperatureZigzag =
+    2U * static_cast<uint64_t>(kTemperatureMax - kTemperatureMin);
+constexpr uint8_t kStatusChanged = 0x02;
+constexpr uint8_t kTemperatureChanged = 0x01;
+// One entry: 10-byte time varint, Status byte, 3-byte temperature varint.
+constexpr size_t kMaxEntrySize = 14;
+constexpr size_t kMaxVarintBytes = 10;
+
+bool validRecord(const TelemetryRecord& record) {
+  return record.timestamp >= kEpoch2000 && record.timestamp <= kEndOf2099 &&
+         record.hundredths <= 99 && record.temperatureRaw >= kTemperatureMin &&
+         record.temperatureRaw <= kTemperatureMax;
+}
+
+uint64_t centisOf(const TelemetryRecord& record) {
+  return static_cast<uint64_t>(record.timestamp - kEpoch2000) * 100U +
+         record.hundredths;
+}
+
+uint64_t zigzag(int64_t value) {
+  return (static_cast<uint64_t>(value) << 1) ^
+         static_cast<uint64_t>(value >> 63);
+}
+
+int64_t unzigzag(uint64_t value) {
+  return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1U);
+}
+
+size_t putVarint(uint8_t* out, uint64_t value) {
+  size_t n = 0;
+  while (value >= 0x80U) {
+    out[n++] = static_cast<uint8_t>(value | 0x80U);
+    value >>= 7;
+  }
+  out[n++] = static_cast<uint8_t>(value);
+  return n;
+}
+
+bool getVarint(const uint8_t* in, size_t end, size_t& offset, uint64_t& value) {
+  uint64_t result = 0;
+  for (size_t i = 0; i < kMaxVarintBytes; ++i) {
+    if (offset >= end) {
+      return false;
+    }
+    const uint8_t byte = in[offset++];
+    result |= static_cast<uint64_t>(byte & 0x7FU) << (7U * i);
+    if ((byte & 0x80U) == 0) {
+      value = result;
+      return true;
+    }
+  }
+  return false;
+}
+
+void putLe16(uint8_t* out, uint16_t value) {
+  out[0] = static_cast<uint8_t>(value);
+  out[1] = static_cast<uint8_t>(value >> 8);
+}
+
+uint16_t getLe16(const uint8_t* in) {
+  return static_cast<uint16_t>(in[0] | (in[1] << 8));
+}
+
+void putLe32(uint8_t* out, uint32_t value) {
+  putLe16(out, static_cast<uint16_t>(value));
+  putLe16(out + 2, static_cast<uint16_t>(value >> 16));
+}
+
+uint32_t getLe32(const uint8_t* in) {
+  return static_cast<uint32_t>(getLe16(in)) |
+         (static_cast<uint32_t>(getLe16(in + 2)) << 16);
+}
+
+bool readFirstRecord(const uint8_t* block, TelemetryRecord& out) {
+  TelemetryRecord first{};
+  first.timestamp = getLe32(block + 8);
+  first.hundredths = block[12];
+  first.statusRaw = block[13];
+  first.temperatureRaw = static_cast<int16_t>(getLe16(block + 14));
+  if (!validRecord(first)) {
+    return false;
+  }
+  out = first;
+  return true;
+}
+
+}  // namespace
+
+Status makeTelemetryRecord(const TelemetryFrame& frame, TelemetryRecord& out) {
+  uint32_t timestamp = 0;
+  if (!frame.timeValid || !frame.hundredthsValid ||
+      !RV3032::dateTimeToUnix(frame.time, timestamp).ok()) {
+    return Status::Error(Err::INVALID_DATETIME, "Telemetry time is not valid");
+  }
+  out.timestamp = timestamp;
+  out.hundredths = frame.hundredths;
+  out.statusRaw = frame.statusRaw;
+  out.temperatureRaw = frame.temperatureRaw;
+  return Status::Ok();
+}
+
+Status makeTelemetryRecord(const TimeSnapshot& snapshot, TelemetryRecord& out) {
+  uint32_t timestamp = 0;
+  if (!snapshot.timeValid ||
+      !RV3032::dateTimeToUnix(snapshot.time, timestamp).ok()) {
+    return Status::Error(Err::INVALID_DATETIME, "Snapshot time is not valid");
+  }
+  out = TelemetryRecord{};
+  out.timestamp = timestamp;
+  out.statusRaw = snapshot.statusRaw;
+  return Status::Ok();
+}
+
+// ===== Encoder =====
+
+Status TelemetryBlockEncoder::begin(uint8_t* block, size_t size) {
+  if (block == nullptr || size < TELEMETRY_BLOCK_MIN_SIZE ||
+      size > TELEMETRY_BLOCK_MAX_SIZE) {
+    return Status::Error(Err::INVALID_PARAM, "Invalid telemetry block buffer");
+  }
+  *this = TelemetryBlockEncoder{};
+  memset(block, 0xFF, size);
+  block[0] = 'R';
+  block[1] = 'T';
+  block[2] = TELEMETRY_BLOCK_VERSION;
+  block[3] = 0;
+  putLe16(block + 4, 0);
+  putLe16(block + 6, static_cast<uint16_t>(TELEMETRY_BLOCK_HEADER_SIZE));
+  _block = block;
+  _size = size;
+  _used = TELEMETRY_BLOCK_HEADER_SIZE;
+  return Status::Ok();
+}
+
+Status TelemetryBlockEncoder::append(const TelemetryRecord& record) {
+  if (_block == nullptr) {
+    return Status::Error(Err::INVALID_PARAM, "Call begin() first");
+  }
+  if (!validRecord(record)) {
+    return Status::Error(Err::INVALID_PARAM, "Telemetry record out of range");
+  }
+  if (_count == UINT16_MAX) {
+    return Status::Error(Err::QUEUE_FULL, "Telemetry block is full");
+  }
+  const uint64_t centis = centisOf(record);
+  if (_count == 0) {
+    putLe32(_block + 8, record.timestamp);
+    _block[12] = record.hundredths;
+    _block[13] = record.statusRaw;
+    putLe16(_block + 14, static_cast<uint16_t>(record.temperatureRaw));
+  } else {
+    const int64_t delta = static_cast<int64_t>(centis - _previousCentis);
+    uint8_t flags = 0;
+    if (record.statusRaw != _previousStatus) {
+      flags |= kStatusChanged;
+    }
+    if (record.temperatureRaw != _previousTemperature) {
+      flags |= kTemperatureChanged;
+    }
+    uint8_t entry[kMaxEntrySize];
+    size_t n = putVarint(entry, (zigzag(delta - _previousDelta) << 2) | flags);
+    if ((flags & kStatusChanged) != 0) {
+      entry[n++] = record.statusRaw;
+    }
+    if ((flags & kTemperatureChanged) != 0) {
+      n += putVarint(entry + n, zigzag(static_cast<int64_t>(
+                                    record.temperatureRaw) -
+                                    _previousTemperature));
+    }
+    if (n > _size - _used) {
+      return Status::Error(Err::QUEUE_FULL, "Telemetry block is full");
+    }
+    memcpy(_block + _used, entry, n);
+    _used += n;
+    _previousDelta = delta;
+  }
+  _previousCentis = centis;
+  _previousStatus = record.statusRaw;
+  _previousTemperature = record.temperatureRaw;
+  ++_count;
+  putLe16(_block + 4, _count);
+  putLe16(_block + 6, static_cast<uint16_t>(_used));
+  return Status::Ok();
+}
+
+// ===== Decoder =====
+
+Status readTelemetryBlockInfo(const uint8_t* block, size_t size,
+                              TelemetryBlockInfo& out) {
+  if (block == nullptr || size < TELEMETRY_BLOCK_HEADER_SIZE ||
+      block[0] != 'R' || block[1] != 'T' ||
+      block[2] != TELEMETRY_BLOCK_VERSION || block[3] != 0) {
+    return Status::Error(Err::INVALID_PARAM, "Malformed telemetry block");
+  }
+  TelemetryBlockInfo info{};
+  info.recordCount = getLe16(block + 4);
+  info.usedBytes = getLe16(block + 6);
+  info.firstTimestamp = getLe32(block + 8);
+  TelemetryRecord first{};
+  if (info.usedBytes < TELEMETRY_BLOCK_HEADER_SIZE || info.usedBytes > size ||
+      (info.recordCount == 0 &&
+       info.usedBytes != TELEMETRY_BLOCK_HEADER_SIZE) ||
+      (info.recordCount > 0 && !readFirstRecord(block, first))) {
+    return Status::Error(Err::INVALID_PARAM, "Malformed telemetry block");
+  }
+  out = info;
+  return Status::Ok();
+}
+
+Status TelemetryBlockDecoder::begin(const uint8_t* block, size_t size) {
+  TelemetryBlockInfo info{};
+  Status st = readTelemetryBlockInfo(block, size, info);
+  if (!st.ok()) {
+    return st;
+  }
+  *this = TelemetryBlockDecoder{};
+  _block = block;
+  _used = info.usedBytes;
+  _offset = TELEMETRY_BLOCK_HEADER_SIZE;
+  _count = info.recordCount;
+  return Status::Ok();
+}
+
+Status TelemetryBlockDecoder::next(TelemetryRecord& out) {
+  if (_block == nullptr || _index >= _count) {
+    return Status::Error(Err::INVALID_PARAM, "No telemetry record remains");
+  }
+  TelemetryRecord record{};
+  uint64_t centis = 0;
+  int64_t delta = _previousDelta;
+  size_t offset = _offset;
+  if (_index == 0) {
+    (void)readFirstRecord(_block, record);
+    centis = centisOf(record);
+  } else {
+    uint64_t head = 0;
+    if (!getVarint(_block, _used, offset, head)) {
+      return Status::Error(Err::INVALID_PARAM, "Malformed telemetry entry");
+    }
+    delta = _previousDelta + unzigzag(head >> 2);
+    centis = _previousCentis + static_cast<uint64_t>(delta);
+    record.statusRaw = _previousStatus;
+    record.temperatureRaw = _previousTemperature;
+    if ((head & kStatusChanged) != 0) {
+      if (offset >= _used) {
+        return Status::Error(Err::INVALID_PARAM, "Malformed telemetry entry");
+      }
+      record.statusRaw = _block[offset++];
+    }
+    if ((head & kTemperatureChanged) != 0) {
+      uint64_t encoded = 0;
+      // Bound the delta before unzigzag() so the sum cannot overflow.
+      if (!getVarint(_block, _used, offset, encoded) ||
+          encoded > kMaxTemperatureZigzag) {
+        return Status::Error(Err::INVALID_PARAM, "Malformed telemetry entry");
+      }
+      const int64_t temperature = _previousTemperature + unzigzag(encoded);
+      if (temperature < kTemperatureMin || temperature > kTemperatureMax) {
+        return Status::Error(Err::INVALID_PARAM, "Malformed telemetry entry");
+      }
+      record.temperatureRaw = static_cast<int16_t>(temperature);
+    }
+    const uint64_t span =
+        static_cast<uint64_t>(kEndOf2099 - kEpoch2000) * 100U + 99U;
+    if (centis > span) {
+      return Status::Error(Err::INVALID_PARAM, "Malformed telemetry entry");
+    }
+    record.timestamp = kEpoch2000 + static_cast<uint32_t>(centis / 100U);
+    record.hundredths = static_cast<uint8_t>(centis % 100U);
+  }
+  if (_index + 1U == _count && offset != _used) {
+    return Status::Error(Err::INVALID_PARAM, "Telemetry block has trailing bytes");
+  }
+  _offset = offset;
+  _previousCentis = centis;
+  _previousDelta = delta;
+  _previousStatus = record.statusRaw;
+  _previousTemperature = record.temperatureRaw;
+  ++_index;
+  out = record;
+  return Status::Ok();
+}
+
+Status decodeTelemetryBlock(const uint8_t* block, size_t size,
+                            TelemetryRecord* out, size_t capacity,
+                            size_t& decoded) {
+  TelemetryBlockDecoder decoder;
+  Status st = decoder.begin(block, size);
+  if (!st.ok()) {
+    return st;
+  }
+  if (out == nullptr ? decoder.remaining() != 0
+                     : capacity < decoder.remaining()) {
+    return Status::Error(Err::INVALID_PARAM, "Telemetry output too small");
+  }
+  size_t count = 0;
+  while (decoder.remaining() > 0) {
+    st = decoder.next(out[count]);
+    if (!st.ok()) {
+      return st;
+    }
+    ++count;
+  }
+  decoded = count;
+  return Status::Ok();
+}
+
+size_t findTelemetryBlock(const uint32_t* firstTimestamps, size_t blockCount,
+                          uint32_t timestamp) {
+  if (firstTimestamps == nullptr || blockCount == 0) {
+    return 0;
+  }
+  size_t low = 0;
+  size_t high = blockCount;
+  while (low < high) {
+    const size_t mid = low + (high - low) / 2U;
+    if (firstTimestamps[mid] <= timestamp) {
+      low = mid + 1U;
+    } else {
+      high = mid;
+    }
+  }
+  return low > 0 ? low - 1U : 0;
+}
+
+}  // namespace RV3032
@@ -0,0 +1,98 @@
+// Host benchmark for the persistent EEPROM queue.
+//
+// Times draining queued offset writes through pollEeprom() against the native
+// fake, so only driver CPU cost is measured. Not part of the unit-test suite.
+//
+// Build and run from the repository root:
+//
+//   g++ -std=c++17 -O2 -I. -Iinclude -Itest/stubs -Itest/test_native
+//       -DARDUINO=100 test/bench_native/bench_eeprom_queue.cpp
+//       src/RV3032.cpp -o /tmp/bench_eeprom_queue
+//   /tmp/bench_eeprom_queue
+//
+// (The g++ command is one line; it is wrapped here for width.)
+//
+// To compare two revisions, check the older one out into a worktree
+// (`git worktree add /tmp/rv3032-before <rev>`), copy this file and
+// test/test_native/FakeRv3032.h over, build it there with the same command,
+// and run both binaries on an idle machine.
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include <chrono>
+
+#include "FakeRv3032.h"
+#include "RV3032/RV3032.h"
+
+using test_rv3032::FakeRv3032;
+
+namespace {
+
+constexpr uint32_t ROUNDS = 20000;
+constexpr uint8_t ITEMS_PER_ROUND = 8;
+
+bool drainEeprom(RV3032::RV3032& rtc, FakeRv3032& fake) {
+  for (uint16_t i = 0; i < 3000; ++i) {
+    uint8_t used = 0;
+    const RV3032::Status st = rtc.pollEeprom(fake.nowMs, 4, used);
+    if (!st.inProgress()) return st.ok();
+    ++fake.nowMs;
+  }
+  return false;
+}
+
+bool finishJob(RV3032::RV3032& rtc, FakeRv3032& fake) {
+  for (uint16_t i = 0; i < 3000; ++i) {
+    uint8_t used = 0;
+    const RV3032::Status st = rtc.pollJob(fake.nowMs, 1, used);
+    if (!st.inProgress()) return st.ok();
+    ++fake.nowMs;
+  }
+  return false;
+}
+
+}  // namespace
+
+int main() {
+  FakeRv3032 fake;
+  RV3032::RV3032 rtc;
+  if (!rtc.begin(fake.config(true)).ok()) {
+    fprintf(stderr, "begin failed\n");
+    return 1;
+  }
+
+  uint64_t drainNs = 0;
+  for (uint32_t round = 0; round < ROUNDS; ++round) {
+    // Alternate the sign so every round queues values the EEPROM lacks.
+    const float sign = (round & 1U) != 0U ? -1.0f : 1.0f;
+    for (uint8_t i = 1; i <= ITEMS_PER_ROUND; ++i) {
+      if (!rtc.setOffsetPpm(sign * static_cast<float>(i) * 0.2384f)
+               .inProgress() ||
+          !finishJob(rtc, fake)) {
+        fprintf(stderr, "queueing failed in round %lu\n",
+                static_cast<unsigned long>(round));
+        return 1;
+      }
+    }
+    fake.logCount = 0;
+    fake.waitLogCount = 0;
+    const auto start = std::chrono::steady_clock::now();
+    const bool drained = drainEeprom(rtc, fake);
+    const auto stop = std::chrono::steady_clock::now();
+    if (!drained || rtc.eepromQueueDepth() != 0) {
+      fprintf(stderr, "drain failed in round %lu\n",
+              static_cast<unsigned long>(round));
+      return 1;
+    }
+    drainNs += static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start)
+            .count());
+  }
+
+  const uint64_t items = static_cast<uint64_t>(ROUNDS) * ITEMS_PER_ROUND;
+  printf("EEPROM queue: %llu items, %.1f ns per drained item\n",
+         static_cast<unsigned long long>(items),
+         static_cast<double>(drainNs) / static_cast<double>(items));
+  return 0;
+}
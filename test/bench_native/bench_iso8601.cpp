@@ -0,0 +1,134 @@
+// Host benchmark for the ISO-8601 formatter and parser.
+//
+// Times formatIso8601() and parseIso8601() against snprintf() and sscanf()
+// producing and reading the same text, so only CPU cost is measured. Not part
+// of the unit-test suite.
+//
+// Build and run from the repository root:
+//
+//   g++ -std=c++17 -O2 -I. -Iinclude -Itest/stubs -Itest/test_native
+//       -DARDUINO=100 test/bench_native/bench_iso8601.cpp
+//       src/RV3032.cpp -o /tmp/bench_iso8601
+//   /tmp/bench_iso8601
+//
+// (The g++ command is one line; it is wrapped here for width.)
+//
+// To compare two revisions, check the older one out into a worktree
+// (`git worktree add /tmp/rv3032-before <rev>`), copy this file over, build
+// it there with the same command, and run both binaries on an idle machine.
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include <chrono>
+
+#include "RV3032/RV3032.h"
+
+namespace {
+
+constexpr uint32_t ITERATIONS = 2000000;
+constexpr uint32_t SAMPLES = 64;
+
+RV3032::DateTime sampleTimes[SAMPLES];
+char sampleText[SAMPLES][RV3032::RV3032::ISO8601_BUFFER_SIZE];
+
+// Spread fields across the valid range so no branch is always taken.
+void buildSamples() {
+  for (uint32_t i = 0; i < SAMPLES; ++i) {
+    RV3032::DateTime& time = sampleTimes[i];
+    time.year = static_cast<uint16_t>(2000U + (i * 37U) % 100U);
+    time.month = static_cast<uint8_t>(1U + (i * 5U) % 12U);
+    time.day = static_cast<uint8_t>(1U + (i * 11U) % 28U);
+    time.hour = static_cast<uint8_t>((i * 7U) % 24U);
+    time.minute = static_cast<uint8_t>((i * 13U) % 60U);
+    time.second = static_cast<uint8_t>((i * 17U) % 60U);
+    (void)RV3032::RV3032::formatIso8601(
+        time, static_cast<uint8_t>(i % 100U), sampleText[i]);
+  }
+}
+
+double nsPerCall(std::chrono::steady_clock::time_point start,
+                 std::chrono::steady_clock::time_point stop) {
+  return static_cast<double>(
+             std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start)
+                 .count()) /
+         static_cast<double>(ITERATIONS);
+}
+
+}  // namespace
+
+int main() {
+  buildSamples();
+  char out[RV3032::RV3032::ISO8601_BUFFER_SIZE] = {};
+  // Folded into the exit path so the optimizer keeps every call.
+  uint32_t checksum = 0;
+
+  auto start = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < ITERATIONS; ++i) {
+    const uint32_t k = i % SAMPLES;
+    if (!RV3032::RV3032::formatIso8601(
+             sampleTimes[k], static_cast<uint8_t>(k), out).ok()) {
+      fprintf(stderr, "formatIso8601 failed at %lu\n",
+              static_cast<unsigned long>(i));
+      return 1;
+    }
+    checksum += static_cast<uint8_t>(out[20]);
+  }
+  auto stop = std::chrono::steady_clock::now();
+  const double formatNs = nsPerCall(start, stop);
+
+  // Sized for the widest uint8_t fields so -Wformat-truncation stays quiet.
+  char printed[32] = {};
+  start = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < ITERATIONS; ++i) {
+    const RV3032::DateTime& time = sampleTimes[i % SAMPLES];
+    snprintf(printed, sizeof(printed),
+             "%04u-%02u-%02uT%02u:%02u:%02u.%02uZ",
+             static_cast<unsigned>(time.year),
+             static_cast<unsigned>(time.month),
+             static_cast<unsigned>(time.day),
+             static_cast<unsigned>(time.hour),
+             static_cast<unsigned>(time.minute),
+             static_cast<unsigned>(time.second),
+             static_cast<unsigned>(i % SAMPLES));
+    checksum += static_cast<uint8_t>(printed[20]);
+  }
+  stop = std::chrono::steady_clock::now();
+  const double snprintfNs = nsPerCall(start, stop);
+
+  start = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < ITERATIONS; ++i) {
+    RV3032::DateTime parsed{};
+    uint8_t hundredths = 0;
+    if (!RV3032::RV3032::parseIso8601(sampleText[i % SAMPLES], parsed,
+                                      &hundredths).ok()) {
+      fprintf(stderr, "parseIso8601 failed at %lu\n",
+              static_cast<unsigned long>(i));
+      return 1;
+    }
+    checksum += parsed.second + hundredths;
+  }
+  stop = std::chrono::steady_clock::now();
+  const double parseNs = nsPerCall(start, stop);
+
+  start = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < ITERATIONS; ++i) {
+    unsigned year = 0, month = 0, day = 0, hour = 0, minute = 0, second = 0;
+    unsigned hundredths = 0;
+    if (sscanf(sampleText[i % SAMPLES], "%4u-%2u-%2uT%2u:%2u:%2u.%2uZ", &year,
+               &month, &day, &hour, &minute, &second, &hundredths) != 7) {
+      fprintf(stderr, "sscanf failed at %lu\n",
+              static_cast<unsigned long>(i));
+      return 1;
+    }
+    checksum += second + hundredths;
+  }
+  stop = std::chrono::steady_clock::now();
+  const double sscanfNs = nsPerCall(start, stop);
+
+  printf("ISO-8601 format: %.1f ns per call, snprintf %.1f ns\n", formatNs,
+         snprintfNs);
+  printf("ISO-8601 parse:  %.1f ns per call, sscanf %.1f ns\n", parseNs,
+         sscanfNs);
+  return checksum == 0 ? 1 : 0;
+}
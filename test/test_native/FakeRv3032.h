@@ -76,6 +76,27 @@ struct FakeRv3032 {
   uint8_t pendingAddress = 0;
   uint8_t pendingData = 0;
 
+  // Virtual-time device model. Device time moves only through
+  // advanceDeviceTime(), so fixtures that never call it keep their static
+  // register contents. Points are in device milliseconds.
+  struct TemperaturePoint {
+    uint64_t atMs = 0;
+    int16_t sixteenths = 0;
+  };
+  static constexpr size_t TEMPERATURE_POINT_CAPACITY = 8;
+  TemperaturePoint temperatureTrajectory[TEMPERATURE_POINT_CAPACITY] = {};
+  size_t temperaturePointCount = 0;
+  uint32_t eviPeriodMs = 0;
+  uint64_t deviceElapsedMs = 0;
+  uint16_t subsecondMs = 0;
+  uint16_t timerCounter = 0;
+  bool aboveHighThreshold = false;
+  bool belowLowThreshold = false;
+  uint32_t timerEvents = 0;
+  uint32_t alarmEvents = 0;
+  uint32_t updateEvents = 0;
+  uint32_t eviEvents = 0;
+
   FakeRv3032() {
     // The fixture starts with the project's primary-cell LSM policy, not the
     // factory-delivery C0 value. NCLKE, C2, and C3 remain at their vendor
@@ -146,6 +167,281 @@ struct FakeRv3032 {
     return static_cast<uint8_t>(((value / 10U) << 4) | (value % 10U));
   }
 
+  static uint8_t fromBcd(uint8_t value) {
+    return static_cast<uint8_t>((value >> 4) * 10U + (value & 0x0Fu));
+  }
+
+  // Advance device time and nowMs together. Work is per minute boundary and
+  // per EVI event, never per tick, so days of device time cost well under a
+  // millisecond of host time.
+  void advanceDeviceTime(uint32_t ms) {
+    while (ms > 0) {
+      uint32_t step = ms;
+      if (eviPeriodMs != 0) {
+        const uint32_t toEvent = static_cast<uint32_t>(
+            eviPeriodMs - deviceElapsedMs % eviPeriodMs);
+        if (toEvent < step) step = toEvent;
+      }
+      advanceClock(step);
+      nowMs += step;
+      ms -= step;
+      if (eviPeriodMs != 0 && deviceElapsedMs % eviPeriodMs == 0) {
+        triggerEvi();
+      }
+    }
+    completeCommand();
+  }
+
+  // Debounced EVI edge: timestamp per the EVI overwrite bit, then EVF.
+  void triggerEvi() {
+    ++eviEvents;
+    captureTimestamp(RV3032::cmd::REG_TS_EVI_COUNT,
+                     RV3032::cmd::TS_EVI_OVERWRITE_BIT, true);
+    raiseFlag(RV3032::cmd::STATUS_EVF_BIT, RV3032::cmd::REG_CONTROL2,
+              RV3032::cmd::CTRL2_EIE_BIT);
+  }
+
+  // Main supply lost: BSF is set only when C0 enables switchover.
+  void switchToBackup() {
+    const uint8_t bsm = static_cast<uint8_t>(
+        activeConfig[0] & RV3032::cmd::PMU_BSM_MASK);
+    if (bsm != RV3032::cmd::PMU_BSM_LEVEL &&
+        bsm != RV3032::cmd::PMU_BSM_DIRECT) {
+      return;
+    }
+    direct[RV3032::cmd::REG_TEMP_LSB] |= RV3032::cmd::TEMP_BSF_MASK;
+    if ((direct[RV3032::cmd::REG_CONTROL3] &
+         (1u << RV3032::cmd::CTRL3_BSIE_BIT)) != 0) {
+      intAsserted = true;
+    }
+  }
+
+  void addTemperaturePoint(uint64_t atMs, int16_t sixteenths) {
+    if (temperaturePointCount < TEMPERATURE_POINT_CAPACITY) {
+      temperatureTrajectory[temperaturePointCount].atMs = atMs;
+      temperatureTrajectory[temperaturePointCount].sixteenths = sixteenths;
+      ++temperaturePointCount;
+    }
+  }
+
+  void raiseFlag(uint8_t statusBit, uint8_t enableReg, uint8_t enableBit) {
+    direct[RV3032::cmd::REG_STATUS] = static_cast<uint8_t>(
+        direct[RV3032::cmd::REG_STATUS] | (1u << statusBit));
+    if ((direct[enableReg] & (1u << enableBit)) != 0) {
+      intAsserted = true;
+    }
+  }
+
+  // Count saturates; the time is kept from the first event unless the
+  // source's overwrite bit asks for the latest one.
+  void captureTimestamp(uint8_t countReg, uint8_t overwriteBit,
+                        bool withHundredths) {
+    uint8_t* block = &direct[countReg];
+    const bool first = block[0] == 0;
+    if (block[0] < 0xFF) ++block[0];
+    if (!first && (direct[RV3032::cmd::REG_TS_CONTROL] &
+                   (1u << overwriteBit)) == 0) {
+      return;
+    }
+    uint8_t* field = &block[1];
+    if (withHundredths) *field++ = direct[RV3032::cmd::REG_100TH_SECONDS];
+    memcpy(field, &direct[RV3032::cmd::REG_SECONDS], 3);
+    memcpy(field + 3, &direct[RV3032::cmd::REG_DATE], 3);
+  }
+
+  void advanceClock(uint32_t ms) {
+    const uint64_t from = deviceElapsedMs;
+    if ((direct[RV3032::cmd::REG_CONTROL2] &
+         (1u << RV3032::cmd::CTRL2_STOP_BIT)) != 0) {
+      deviceElapsedMs = from + ms;
+      sampleTemperature();
+      return;
+    }
+    advanceTimer(from, from + ms);
+    uint64_t pending = static_cast<uint64_t>(subsecondMs) + ms;
+    uint64_t secondStart = from - subsecondMs;
+    while (pending >= 1000U) {
+      const uint32_t consumed = advanceSeconds(pending / 1000U);
+      pending -= consumed * 1000ULL;
+      secondStart += consumed * 1000ULL;
+      deviceElapsedMs = secondStart;
+      sampleTemperature();
+    }
+    subsecondMs = static_cast<uint16_t>(pending);
+    direct[RV3032::cmd::REG_100TH_SECONDS] =
+        bcd(static_cast<uint8_t>(subsecondMs / 10U));
+    deviceElapsedMs = from + ms;
+    sampleTemperature();
+  }
+
+  // The timer clock is free-running from device time, so the first period
+  // after TE may be up to one tick short, as on silicon.
+  void advanceTimer(uint64_t fromMs, uint64_t toMs) {
+    if ((direct[RV3032::cmd::REG_CONTROL1] &
+         (1u << RV3032::cmd::CTRL1_TE_BIT)) == 0) {
+      return;
+    }
+    const uint16_t preset = static_cast<uint16_t>(
+        direct[RV3032::cmd::REG_TIMER_LOW] |
+        ((direct[RV3032::cmd::REG_TIMER_HIGH] & 0x0Fu) << 8));
+    if (preset == 0) return;
+    uint64_t ticks = 0;
+    switch (direct[RV3032::cmd::REG_CONTROL1] & RV3032::cmd::CTRL1_TD_MASK) {
+      case 0: ticks = toMs * 4096U / 1000U - fromMs * 4096U / 1000U; break;
+      case 1: ticks = toMs * 64U / 1000U - fromMs * 64U / 1000U; break;
+      case 2: ticks = toMs / 1000U - fromMs / 1000U; break;
+      default: ticks = toMs / 60000U - fromMs / 60000U; break;
+    }
+    if (timerCounter == 0 || timerCounter > preset) timerCounter = preset;
+    if (ticks < timerCounter) {
+      timerCounter = static_cast<uint16_t>(timerCounter - ticks);
+      return;
+    }
+    ticks -= timerCounter;
+    timerEvents += static_cast<uint32_t>(1U + ticks / preset);
+    timerCounter = static_cast<uint16_t>(preset - ticks % preset);
+    raiseFlag(RV3032::cmd::STATUS_TF_BIT, RV3032::cmd::REG_CONTROL2,
+              RV3032::cmd::CTRL2_TIE_BIT);
+  }
+
+  // Consumes at most the rest of the current minute and returns the seconds
+  // used. USEL selects second or minute update events.
+  uint32_t advanceSeconds(uint64_t seconds) {
+    const uint8_t second = fromBcd(static_cast<uint8_t>(
+        direct[RV3032::cmd::REG_SECONDS] & 0x7Fu));
+    const uint32_t toMinute = second < 60U ? 60U - second : 1U;
+    const bool minuteUpdates = (direct[RV3032::cmd::REG_CONTROL1] &
+                                (1u << RV3032::cmd::CTRL1_USEL_BIT)) != 0;
+    if (seconds < toMinute) {
+      direct[RV3032::cmd::REG_SECONDS] =
+          bcd(static_cast<uint8_t>(second + seconds));
+      if (!minuteUpdates) raiseUpdate(static_cast<uint32_t>(seconds));
+      return static_cast<uint32_t>(seconds);
+    }
+    direct[RV3032::cmd::REG_SECONDS] = 0;
+    rollMinute();
+    raiseUpdate(minuteUpdates ? 1U : toMinute);
+    checkAlarm();
+    return toMinute;
+  }
+
+  void raiseUpdate(uint32_t events) {
+    updateEvents += events;
+    raiseFlag(RV3032::cmd::STATUS_UF_BIT, RV3032::cmd::REG_CONTROL2,
+              RV3032::cmd::CTRL2_UIE_BIT);
+  }
+
+  static uint8_t daysInMonth(uint8_t month, uint8_t yearInCentury) {
+    static const uint8_t kDays[12] = {31, 28, 31, 30, 31, 30,
+                                      31, 31, 30, 31, 30, 31};
+    if (month < 1 || month > 12) return 31;
+    // 2000..2099: every year divisible by four is a leap year.
+    return month == 2 && yearInCentury % 4U == 0 ? 29 : kDays[month - 1];
+  }
+
+  void rollMinute() {
+    uint8_t minute = fromBcd(direct[RV3032::cmd::REG_MINUTES]);
+    if (++minute < 60U) {
+      direct[RV3032::cmd::REG_MINUTES] = bcd(minute);
+      return;
+    }
+    direct[RV3032::cmd::REG_MINUTES] = 0;
+    uint8_t hour = fromBcd(direct[RV3032::cmd::REG_HOURS]);
+    if (++hour < 24U) {
+      direct[RV3032::cmd::REG_HOURS] = bcd(hour);
+      return;
+    }
+    direct[RV3032::cmd::REG_HOURS] = 0;
+    direct[RV3032::cmd::REG_WEEKDAY] = static_cast<uint8_t>(
+        ((direct[RV3032::cmd::REG_WEEKDAY] & 0x07u) + 1U) % 7U);
+    uint8_t year = fromBcd(direct[RV3032::cmd::REG_YEAR]);
+    uint8_t month = fromBcd(direct[RV3032::cmd::REG_MONTH]);
+    uint8_t day = fromBcd(direct[RV3032::cmd::REG_DATE]);
+    if (++day <= daysInMonth(month, year)) {
+      direct[RV3032::cmd::REG_DATE] = bcd(day);
+      return;
+    }
+    direct[RV3032::cmd::REG_DATE] = bcd(1);
+    if (++month <= 12U) {
+      direct[RV3032::cmd::REG_MONTH] = bcd(month);
+      return;
+    }
+    direct[RV3032::cmd::REG_MONTH] = bcd(1);
+    direct[RV3032::cmd::REG_YEAR] =
+        bcd(static_cast<uint8_t>((year + 1U) % 100U));
+  }
+
+  // AE_x=0 enables a field. With every AE set the match is vacuous and AF
+  // sets each minute; Date Alarm 00 with AE_D=0 never matches.
+  void checkAlarm() {
+    const uint8_t minute = direct[RV3032::cmd::REG_ALARM_MINUTE];
+    const uint8_t hour = direct[RV3032::cmd::REG_ALARM_HOUR];
+    const uint8_t date = direct[RV3032::cmd::REG_ALARM_DATE];
+    if (((minute & 0x80u) == 0 &&
+         (minute & 0x7Fu) != direct[RV3032::cmd::REG_MINUTES]) ||
+        ((hour & 0x80u) == 0 &&
+         (hour & 0x3Fu) != direct[RV3032::cmd::REG_HOURS]) ||
+        ((date & 0x80u) == 0 &&
+         (date & 0x3Fu) != direct[RV3032::cmd::REG_DATE])) {
+      return;
+    }
+    ++alarmEvents;
+    raiseFlag(RV3032::cmd::STATUS_AF_BIT, RV3032::cmd::REG_CONTROL2,
+              RV3032::cmd::CTRL2_AIE_BIT);
+  }
+
+  // Piecewise-linear trajectory, held flat before the first and after the
+  // last point. Threshold flags are edge-triggered with timestamps.
+  void sampleTemperature() {
+    if (temperaturePointCount == 0) return;
+    const TemperaturePoint* points = temperatureTrajectory;
+    int32_t value = points[temperaturePointCount - 1].sixteenths;
+    if (deviceElapsedMs <= points[0].atMs) {
+      value = points[0].sixteenths;
+    } else {
+      for (size_t i = 1; i < temperaturePointCount; ++i) {
+        if (deviceElapsedMs < points[i].atMs) {
+          const int64_t span = static_cast<int64_t>(
+              points[i].atMs - points[i - 1].atMs);
+          const int64_t into = static_cast<int64_t>(
+              deviceElapsedMs - points[i - 1].atMs);
+          value = points[i - 1].sixteenths + static_cast<int32_t>(
+              (points[i].sixteenths - points[i - 1].sixteenths) * into /
+              span);
+          break;
+        }
+      }
+    }
+    const uint16_t bits = static_cast<uint16_t>(value) & 0x0FFFu;
+    direct[RV3032::cmd::REG_TEMP_MSB] = static_cast<uint8_t>(bits >> 4);
+    direct[RV3032::cmd::REG_TEMP_LSB] = static_cast<uint8_t>(
+        ((bits & 0x0Fu) << 4) | (direct[RV3032::cmd::REG_TEMP_LSB] & 0x0Fu));
+
+    const uint8_t control3 = direct[RV3032::cmd::REG_CONTROL3];
+    const int32_t high =
+        static_cast<int8_t>(direct[RV3032::cmd::REG_THIGH_THRESHOLD]) * 16;
+    const int32_t low =
+        static_cast<int8_t>(direct[RV3032::cmd::REG_TLOW_THRESHOLD]) * 16;
+    const bool above = (control3 & (1u << RV3032::cmd::CTRL3_THE_BIT)) != 0 &&
+                       value > high;
+    const bool below = (control3 & (1u << RV3032::cmd::CTRL3_TLE_BIT)) != 0 &&
+                       value < low;
+    if (above && !aboveHighThreshold) {
+      captureTimestamp(RV3032::cmd::REG_TS_THIGH_COUNT,
+                       RV3032::cmd::TS_THIGH_OVERWRITE_BIT, false);
+      raiseFlag(RV3032::cmd::STATUS_THF_BIT, RV3032::cmd::REG_CONTROL3,
+                RV3032::cmd::CTRL3_THIE_BIT);
+    }
+    if (below && !belowLowThreshold) {
+      captureTimestamp(RV3032::cmd::REG_TS_TLOW_COUNT,
+                       RV3032::cmd::TS_TLOW_OVERWRITE_BIT, false);
+      raiseFlag(RV3032::cmd::STATUS_TLF_BIT, RV3032::cmd::REG_CONTROL3,
+                RV3032::cmd::CTRL3_TLIE_BIT);
+    }
+    aboveHighThreshold = above;
+    belowLowThreshold = below;
+  }
+
   void completeCommand() {
     if (static_cast<int32_t>(nowMs - busyUntil) < 0) {
       return;
@@ -223,8 +519,14 @@ struct FakeRv3032 {
       return;
     }
     if (reg == RV3032::cmd::REG_CONTROL1) {
+      const bool timerWasEnabled =
+          (direct[reg] & (1u << RV3032::cmd::CTRL1_TE_BIT)) != 0;
       direct[reg] = static_cast<uint8_t>(value &
           RV3032::cmd::CONTROL1_IMPLEMENTED_MASK);
+      if (!timerWasEnabled &&
+          (direct[reg] & (1u << RV3032::cmd::CTRL1_TE_BIT)) != 0) {
+        timerCounter = 0;  // reloaded from the preset on the next tick batch
+      }
       return;
     }
     if (reg == RV3032::cmd::REG_CONTROL2) {
@@ -235,6 +537,7 @@ struct FakeRv3032 {
       }
       if ((direct[reg] & (1u << RV3032::cmd::CTRL2_STOP_BIT)) != 0) {
         direct[RV3032::cmd::REG_100TH_SECONDS] = 0;
+        subsecondMs = 0;
       }
       return;
     }
@@ -325,6 +628,7 @@ struct FakeRv3032 {
     if (reg < sizeof(direct)) {
       if (reg == RV3032::cmd::REG_SECONDS) {
         direct[RV3032::cmd::REG_100TH_SECONDS] = 0;
+        subsecondMs = 0;
       }
       direct[reg] = value;
       return;
@@ -1,4 +1,5 @@
 #include <stdint.h>
+#include <cmath>
 #include <cstring>
 #include <type_traits>
 
@@ -9,6 +10,9 @@
 #include "examples/common/CommandHandler.h"
 #include "FakeRv3032.h"
 #include "RV3032/RV3032.h"
+#include "RV3032/RegisterMap.h"
+#include "RV3032/TelemetryCodec.h"
+#include "RV3032/TimeZones.h"
 #include "examples/01_basic_bringup_cli/main.cpp"
 
 using test_rv3032::FakeRv3032;
@@ -851,6 +855,728 @@ void test_status_first_snapshot_job_and_result_contract() {
   TEST_ASSERT_EQUAL_HEX8(0x96, wrongKind.statusRaw);
 }
 
+void test_job_result_views_borrow_results_until_next_admission() {
+  using JobKind = RV3032::RV3032::JobKind;
+  FakeRv3032 fake;
+  fake.setCalendar(2026, 7, 13, 1, 2, 3, 6);
+  fake.direct[RV3032::cmd::REG_STATUS] = 0;
+  RV3032::RV3032 rtc;
+  TEST_ASSERT_TRUE(rtc.begin(fake.config()).ok());
+
+  RV3032::JobResultView<RV3032::TimeSnapshot> snapshot;
+  TEST_ASSERT_EQUAL_UINT8(
+      static_cast<uint8_t>(RV3032::Err::JOB_RESULT_UNAVAILABLE),
+      static_cast<uint8_t>(rtc.viewJobResult(snapshot).code));
+  TEST_ASSERT_NULL(snapshot.report);
+
+  const uint32_t beforeAdmission = rtc.jobGeneration();
+  TEST_ASSERT_TRUE(rtc.startReadTimeSnapshotJob(fake.nowMs).inProgress());
+  TEST_ASSERT_EQUAL_UINT32(beforeAdmission + 1U, rtc.jobGeneration());
+  TEST_ASSERT_FALSE(rtc.jobResultReady(JobKind::READ_TIME_SNAPSHOT));
+  TEST_ASSERT_TRUE(rtc.viewJobResult(snapshot).inProgress());
+  TEST_ASSERT_TRUE(pollJobToCompletion(rtc, fake).ok());
+  TEST_ASSERT_TRUE(rtc.jobResultReady(JobKind::READ_TIME_SNAPSHOT));
+  TEST_ASSERT_FALSE(rtc.jobResultReady(JobKind::NONE));
+  TEST_ASSERT_FALSE(rtc.jobResultReady(JobKind::SET_TIMER));
+
+  // Polling readiness and viewing touch neither the bus nor a copy.
+  const uint32_t callbacks = fake.callbackCount;
+  TEST_ASSERT_TRUE(rtc.viewJobResult(snapshot).ok());
+  TEST_ASSERT_NOT_NULL(snapshot.report);
+  TEST_ASSERT_EQUAL_UINT32(rtc.jobGeneration(), snapshot.generation);
+  RV3032::TimeSnapshot copied{};
+  TEST_ASSERT_TRUE(rtc.getReadTimeSnapshotJobResult(copied).ok());
+  TEST_ASSERT_TRUE(snapshot.report->timeValid);
+  assertDateTimeEquals(copied.time, snapshot.report->time);
+  TEST_ASSERT_EQUAL_UINT32(callbacks, fake.callbackCount);
+
+  // A different job type invalidates the view and reports unavailable.
+  TEST_ASSERT_TRUE(rtc.startSetTimerJob(
+      1, RV3032::TimerFrequency::Hz1, false).inProgress());
+  TEST_ASSERT_NOT_EQUAL(snapshot.generation, rtc.jobGeneration());
+  TEST_ASSERT_TRUE(pollJobToCompletion(rtc, fake).ok());
+  TEST_ASSERT_TRUE(rtc.jobResultReady(JobKind::SET_TIMER));
+  const RV3032::JobResultView<RV3032::TimeSnapshot> stale = snapshot;
+  TEST_ASSERT_EQUAL_UINT8(
+      static_cast<uint8_t>(RV3032::Err::JOB_RESULT_UNAVAILABLE),
+      static_cast<uint8_t>(rtc.viewJobResult(snapshot).code));
+  TEST_ASSERT_EQUAL_PTR(stale.report, snapshot.report);
+  TEST_ASSERT_EQUAL_UINT32(stale.generation, snapshot.generation);
+
+  RV3032::JobResultView<RV3032::ConfigurationJobReport> timer;
+  TEST_ASSERT_TRUE(rtc.viewJobResult(timer).ok());
+  RV3032::ConfigurationJobReport copiedTimer{};
+  TEST_ASSERT_TRUE(rtc.getSetTimerJobResult(copiedTimer).ok());
+  TEST_ASSERT_EQUAL(copiedTimer.mutationAttempted,
+                    timer.report->mutationAttempted);
+  TEST_ASSERT_EQUAL_UINT32(rtc.jobGeneration(), timer.generation);
+}
+
+void test_eeprom_queue_item_bumps_job_generation() {
+  using JobKind = RV3032::RV3032::JobKind;
+  FakeRv3032 fake;
+  RV3032::RV3032 rtc;
+  TEST_ASSERT_TRUE(rtc.begin(fake.config(true)).ok());
+  TEST_ASSERT_TRUE(rtc.setOffsetPpm(0.2384f).inProgress());
+  TEST_ASSERT_TRUE(pollJobToCompletion(rtc, fake, 1).ok());
+  TEST_ASSERT_EQUAL_UINT8(1, rtc.eepromQueueDepth());
+
+  const uint8_t kindCount =
+      static_cast<uint8_t>(JobKind::READ_TELEMETRY_FRAME) + 1U;
+  TEST_ASSERT_TRUE(rtc.jobResultReady(JobKind::REGISTER_UPDATE));
+
+  // Starting the queued EEPROM item takes the job slot like an admission.
+  const uint32_t generation = rtc.jobGeneration();
+  uint8_t used = 0;
+  TEST_ASSERT_TRUE(rtc.pollEeprom(fake.nowMs, 1, used).inProgress());
+  TEST_ASSERT_EQUAL_UINT8(1, used);
+  TEST_ASSERT_NOT_EQUAL(generation, rtc.jobGeneration());
+  TEST_ASSERT_TRUE(pollEepromToCompletion(rtc, fake, 4).ok());
+  TEST_ASSERT_EQUAL_UINT8(0, rtc.eepromQueueDepth());
+  for (uint8_t kind = 0; kind < kindCount; ++kind) {
+    TEST_ASSERT_FALSE(rtc.jobResultReady(static_cast<JobKind>(kind)));
+  }
+}
+
+void test_plan_job_matches_fake_success_paths() {
+  using Rtc = RV3032::RV3032;
+  using JobKind = Rtc::JobKind;
+  struct Case {
+    Rtc::JobRequest request;
+    uint8_t initialPmu;
+    RV3032::Status (*start)(Rtc&, FakeRv3032&);
+  };
+  auto request = [](JobKind kind, uint8_t length = 0, uint8_t changed = 0) {
+    Rtc::JobRequest r;
+    r.kind = kind;
+    r.length = length;
+    r.changedBytes = changed;
+    return r;
+  };
+  Rtc::JobRequest backupLevel = request(JobKind::SET_BACKUP_SWITCH_MODE);
+  backupLevel.backupMode = RV3032::BackupSwitchMode::Level;
+  Rtc::JobRequest backupDirect = backupLevel;
+  backupDirect.backupMode = RV3032::BackupSwitchMode::Direct;
+  backupDirect.backupCurrentMode = RV3032::BackupSwitchMode::Direct;
+  Rtc::JobRequest primaryCell = request(JobKind::ENSURE_PRIMARY_CELL, 0, 1);
+  primaryCell.activePmuSafe = true;
+  Rtc::JobRequest wakeAck = request(JobKind::READ_WAKE_REASON);
+  wakeAck.acknowledgeWake = true;
+  Rtc::JobRequest cachedSnapshot = request(JobKind::READ_TIME_SNAPSHOT);
+  cachedSnapshot.validityCached = true;
+
+  const Case cases[] = {
+      {request(JobKind::SET_TIMER), 0, [](Rtc& r, FakeRv3032&) {
+         return r.startSetTimerJob(100, RV3032::TimerFrequency::Hz1, true);
+       }},
+      {request(JobKind::SET_PERIODIC_UPDATE), 0, [](Rtc& r, FakeRv3032&) {
+         return r.setPeriodicUpdate(
+             RV3032::PeriodicUpdateFrequency::MINUTE, true);
+       }},
+      {request(JobKind::SET_CLKOUT_CONFIG), 0, [](Rtc& r, FakeRv3032&) {
+         RV3032::ClkoutConfig config{};
+         config.xtalFrequency = RV3032::ClkoutFrequency::Hz1024;
+         return r.setClkoutConfig(config);
+       }},
+      {request(JobKind::REGISTER_UPDATE), 0, [](Rtc& r, FakeRv3032&) {
+         return r.startRegisterUpdateJob(
+             RV3032::cmd::REG_USER_RAM_START, 0xF0, 0x05);
+       }},
+      {request(JobKind::TEMP_LSB_FLAG_CLEAR), 0, [](Rtc& r, FakeRv3032& f) {
+         f.direct[RV3032::cmd::REG_TEMP_LSB] = RV3032::cmd::TEMP_CLKF_MASK;
+         return r.clearClockOutputFlag();
+       }},
+      {request(JobKind::READ_COHERENT_TEMPERATURE), 0,
+       [](Rtc& r, FakeRv3032& f) {
+         return r.startReadCoherentTemperatureJob(f.nowMs);
+       }},
+      {request(JobKind::READ_TELEMETRY_FRAME), 0, [](Rtc& r, FakeRv3032& f) {
+         return r.startReadTelemetryFrameJob(f.nowMs);
+       }},
+      {cachedSnapshot, 0, [](Rtc& r, FakeRv3032& f) {
+         return r.startReadTimeSnapshotJob(f.nowMs);
+       }},
+      {request(JobKind::SET_TEMPERATURE_EVENT_CONFIG), 0,
+       [](Rtc& r, FakeRv3032&) {
+         RV3032::TemperatureEventConfig config{};
+         config.highThresholdC = 50;
+         config.highEventEnabled = true;
+         return r.setTemperatureEventConfig(config);
+       }},
+      {backupLevel, 0, [](Rtc& r, FakeRv3032& f) {
+         return r.startSetBackupSwitchModeJob(
+             RV3032::BackupSwitchMode::Level, f.nowMs);
+       }},
+      {backupDirect, RV3032::cmd::PMU_BSM_DIRECT, [](Rtc& r, FakeRv3032& f) {
+         return r.startSetBackupSwitchModeJob(
+             RV3032::BackupSwitchMode::Direct, f.nowMs);
+       }},
+      {request(JobKind::WRITE_USER_RAM, 16), 0, [](Rtc& r, FakeRv3032&) {
+         const uint8_t bytes[16] = {1, 2, 3};
+         return r.startWriteUserRamJob(0, bytes, sizeof(bytes));
+       }},
+      {request(JobKind::READ_TIME_SNAPSHOT), 0, [](Rtc& r, FakeRv3032& f) {
+         return r.startReadTimeSnapshotJob(f.nowMs);
+       }},
+      {wakeAck, 0, [](Rtc& r, FakeRv3032& f) {
+         return r.startReadWakeReasonJob(true, f.nowMs);
+       }},
+      {request(JobKind::SET_TIME_VERIFIED), 0, [](Rtc& r, FakeRv3032& f) {
+         return r.startSetTimeAndClearInvalidFlagsVerifiedJob(
+             RV3032::DateTime{2026, 1, 2, 3, 4, 5, 5}, f.nowMs);
+       }},
+      {request(JobKind::PERSISTENT_READ, 2), 0, [](Rtc& r, FakeRv3032& f) {
+         return r.startReadUserEepromJob(0, 2, f.nowMs);
+       }},
+      {request(JobKind::USER_EEPROM_WRITE, 2, 1), 0,
+       [](Rtc& r, FakeRv3032& f) {
+         const uint8_t bytes[2] = {0, 7};
+         return r.startWriteUserEepromJob(0, bytes, 2, f.nowMs);
+       }},
+      {primaryCell, 0,
+       [](Rtc& r, FakeRv3032& f) {
+         return r.startEnsurePrimaryCellConfigurationJob(f.nowMs);
+       }},
+  };
+
+  uint32_t coveredKinds = 0;
+  for (const Case& c : cases) {
+    coveredKinds |= 1UL << static_cast<uint8_t>(c.request.kind);
+    Rtc::JobPlan plan;
+    TEST_ASSERT_TRUE(Rtc::planJob(c.request, plan).ok());
+    FakeRv3032 fake;
+    fake.setCalendar(2026, 7, 13, 1, 2, 3, 1);
+    fake.direct[RV3032::cmd::REG_STATUS] = 0;
+    if (c.request.kind == JobKind::SET_BACKUP_SWITCH_MODE) {
+      fake.activeConfig[0] = c.initialPmu;
+    } else if (c.request.kind == JobKind::ENSURE_PRIMARY_CELL) {
+      fake.persistent[0] = c.initialPmu;
+      fake.activeConfig[0] = c.initialPmu;
+    }
+    RV3032::Config config = fake.config(true);
+    if (c.request.validityCached) {
+      config.snapshotValidityMaxAgeMs = 1000;
+    }
+    Rtc rtc;
+    TEST_ASSERT_TRUE(rtc.begin(config).ok());
+    if (c.request.validityCached) {
+      // Prove validity first so the measured snapshot is a cache hit.
+      TEST_ASSERT_TRUE(rtc.startReadTimeSnapshotJob(fake.nowMs).inProgress());
+      TEST_ASSERT_TRUE(pollJobToCompletion(rtc, fake).ok());
+    }
+    const uint32_t callbacks = fake.callbackCount;
+    const uint32_t startMs = fake.nowMs;
+    RV3032::Status st = c.start(rtc, fake);
+    // Poll with a generous budget and let time pass only while the job
+    // waits, so elapsed time is the settle time the job actually needed.
+    for (uint16_t i = 0; i < 2000 && st.inProgress(); ++i) {
+      uint8_t used = 0;
+      st = rtc.pollJob(fake.nowMs, 255, used);
+      if (st.inProgress() && used == 0) ++fake.nowMs;
+    }
+    TEST_ASSERT_TRUE(st.ok());
+    const uint32_t used = fake.callbackCount - callbacks;
+    TEST_ASSERT_EQUAL_UINT32(plan.successCallbacks, used);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(plan.worstCaseCallbacks, used);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(plan.minimumDurationMs,
+                                        fake.nowMs - startMs);
+  }
+
+  // Every kind after NONE is checked against a real run.
+  const uint8_t kindCount =
+      static_cast<uint8_t>(JobKind::READ_TELEMETRY_FRAME) + 1U;
+  TEST_ASSERT_EQUAL_HEX32(((1UL << kindCount) - 1U) & ~1UL, coveredKinds);
+
+  Rtc::JobPlan plan;
+  plan.successCallbacks = 99;
+  TEST_ASSERT_EQUAL_UINT8(
+      static_cast<uint8_t>(RV3032::Err::INVALID_PARAM),
+      static_cast<uint8_t>(Rtc::planJob(request(JobKind::NONE), plan).code));
+  TEST_ASSERT_EQUAL_UINT8(
+      static_cast<uint8_t>(RV3032::Err::INVALID_PARAM),
+      static_cast<uint8_t>(
+          Rtc::planJob(request(JobKind::PERSISTENT_READ), plan).code));
+  TEST_ASSERT_EQUAL_UINT8(
+      static_cast<uint8_t>(RV3032::Err::INVALID_PARAM),
+      static_cast<uint8_t>(Rtc::planJob(
+          request(JobKind::USER_EEPROM_WRITE, 2, 3), plan).code));
+  TEST_ASSERT_EQUAL_UINT32(99, plan.successCallbacks);
+
+  // Planning needs no begin() and worst cases cover the success path.
+  TEST_ASSERT_TRUE(
+      Rtc::planJob(request(JobKind::USER_EEPROM_WRITE, 1, 1), plan).ok());
+  TEST_ASSERT_EQUAL_UINT32(46, plan.successCallbacks);
+  TEST_ASSERT_EQUAL_UINT32(24, plan.minimumDurationMs);
+  TEST_ASSERT_TRUE(plan.worstCaseCallbacks > plan.successCallbacks);
+}
+
+struct BoundRun {
+  RV3032::Status status;
+  uint32_t callbacks;
+  uint32_t nowCalls;
+  uint32_t idlePolls;
+};
+
+enum class BoundFault : uint8_t {
+  NONE,
+  FAIL_CALLBACK,
+  IGNORE_WRITE,
+  STUCK_BUSY,
+  STUCK_BUSY_THEN_FAIL
+};
+
+using BoundStart = RV3032::Status (*)(RV3032::RV3032&, FakeRv3032&);
+
+BoundRun runJobUnderFault(BoundStart start, BoundFault fault,
+                          uint32_t ordinal, uint8_t budget, bool reuse) {
+  FakeRv3032 fake;
+  fake.setCalendar(2026, 7, 13, 1, 2, 3, 1);
+  fake.direct[RV3032::cmd::REG_STATUS] = 0;
+  RV3032::RV3032 rtc;
+  RV3032::Config config = fake.config(true);
+  config.reuseTransferTimestamps = reuse;
+  TEST_ASSERT_TRUE(rtc.begin(config).ok());
+  switch (fault) {
+    case BoundFault::FAIL_CALLBACK:
+      fake.failOrdinal = ordinal;
+      break;
+    case BoundFault::IGNORE_WRITE:
+      fake.ignoreWriteOrdinal = ordinal;
+      break;
+    case BoundFault::STUCK_BUSY_THEN_FAIL:
+      fake.failOrdinal = ordinal + 1U;
+      // fall through
+    case BoundFault::STUCK_BUSY:
+      fake.forceBusyAfterCallbackOrdinal = ordinal;
+      fake.forcedBusyDurationMs = 5000;
+      break;
+    case BoundFault::NONE:
+      break;
+  }
+  const uint32_t perCallback = reuse ? RV3032::POLL_NOW_MS_CALLS_PER_CALLBACK_REUSED
+                                     : RV3032::POLL_NOW_MS_CALLS_PER_CALLBACK;
+  BoundRun run{start(rtc, fake), 0, fake.nowCallCount, 0};
+  for (uint32_t i = 0; i < 100000 && run.status.inProgress(); ++i) {
+    uint8_t used = 0;
+    const uint32_t before = fake.nowCallCount;
+    run.status = rtc.pollJob(fake.nowMs, budget, used);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(
+        RV3032::POLL_NOW_MS_CALLS_BASE + perCallback * used,
+        fake.nowCallCount - before);
+    if (used == 0) ++run.idlePolls;
+    if (run.status.inProgress() && used == 0) ++fake.nowMs;
+  }
+  TEST_ASSERT_FALSE(run.status.inProgress());
+  run.callbacks = fake.callbackCount;
+  run.nowCalls = fake.nowCallCount;
+  return run;
+}
+
+void test_published_job_bounds_hold_under_fault_injection() {
+  using Rtc = RV3032::RV3032;
+  using JobKind = Rtc::JobKind;
+  struct Entry {
+    JobKind kind;
+    BoundStart start;
+  };
+  static const uint8_t bytes[16] = {1, 2, 3, 4, 5, 6, 7, 8,
+                                    9, 10, 11, 12, 13, 14, 15, 16};
+  // Each entry point drives its kind's most expensive success path.
+  const Entry entries[] = {
+      {JobKind::SET_TIMER, [](Rtc& r, FakeRv3032&) {
+         return r.startSetTimerJob(100, RV3032::TimerFrequency::Hz1, true);
+       }},
+      {JobKind::SET_PERIODIC_UPDATE, [](Rtc& r, FakeRv3032&) {
+         return r.setPeriodicUpdate(
+             RV3032::PeriodicUpdateFrequency::MINUTE, true);
+       }},
+      {JobKind::SET_BACKUP_SWITCH_MODE, [](Rtc& r, FakeRv3032& f) {
+         f.activeConfig[0] = 0;
+         return r.startSetBackupSwitchModeJob(
+             RV3032::BackupSwitchMode::Level, f.nowMs);
+       }},
+      {JobKind::SET_CLKOUT_CONFIG, [](Rtc& r, FakeRv3032&) {
+         RV3032::ClkoutConfig config{};
+         config.xtalFrequency = RV3032::ClkoutFrequency::Hz1024;
+         return r.setClkoutConfig(config);
+       }},
+      {JobKind::SET_TEMPERATURE_EVENT_CONFIG, [](Rtc& r, FakeRv3032&) {
+         RV3032::TemperatureEventConfig config{};
+         config.highThresholdC = 50;
+         config.highEventEnabled = true;
+         return r.setTemperatureEventConfig(config);
+       }},
+      {JobKind::REGISTER_UPDATE, [](Rtc& r, FakeRv3032& f) {
+         f.direct[RV3032::cmd::REG_TS_CONTROL] =
+             1u << RV3032::cmd::TS_EVI_RESET_BIT;
+         return r.resetTimestamp(RV3032::TimestampSource::Evi);
+       }},
+      {JobKind::TEMP_LSB_FLAG_CLEAR, [](Rtc& r, FakeRv3032& f) {
+         f.direct[RV3032::cmd::REG_TEMP_LSB] = RV3032::cmd::TEMP_CLKF_MASK;
+         return r.clearClockOutputFlag();
+       }},
+      {JobKind::WRITE_USER_RAM, [](Rtc& r, FakeRv3032&) {
+         return r.startWriteUserRamJob(0, bytes, sizeof(bytes));
+       }},
+      {JobKind::READ_COHERENT_TEMPERATURE, [](Rtc& r, FakeRv3032& f) {
+         return r.startReadCoherentTemperatureJob(f.nowMs);
+       }},
+      {JobKind::READ_TIME_SNAPSHOT, [](Rtc& r, FakeRv3032& f) {
+         return r.startReadTimeSnapshotJob(f.nowMs);
+       }},
+      {JobKind::READ_WAKE_REASON, [](Rtc& r, FakeRv3032& f) {
+         f.direct[RV3032::cmd::REG_STATUS] = 1u << RV3032::cmd::STATUS_AF_BIT;
+         f.direct[RV3032::cmd::REG_TEMP_LSB] = RV3032::cmd::TEMP_CLKF_MASK;
+         return r.startReadWakeReasonJob(true, f.nowMs);
+       }},
+      {JobKind::SET_TIME_VERIFIED, [](Rtc& r, FakeRv3032& f) {
+         return r.startSetTimeAndClearInvalidFlagsVerifiedJob(
+             RV3032::DateTime{2026, 1, 2, 3, 4, 5, 5}, f.nowMs);
+       }},
+      {JobKind::PERSISTENT_READ, [](Rtc& r, FakeRv3032& f) {
+         return r.startReadUserEepromJob(0, sizeof(bytes), f.nowMs);
+       }},
+      {JobKind::USER_EEPROM_WRITE, [](Rtc& r, FakeRv3032& f) {
+         return r.startWriteUserEepromJob(0, bytes, sizeof(bytes), f.nowMs);
+       }},
+      {JobKind::ENSURE_PRIMARY_CELL, [](Rtc& r, FakeRv3032& f) {
+         f.persistent[0] = 0;
+         return r.startEnsurePrimaryCellConfigurationJob(f.nowMs);
+       }},
+      {JobKind::READ_TELEMETRY_FRAME, [](Rtc& r, FakeRv3032& f) {
+         return r.startReadTelemetryFrameJob(f.nowMs);
+       }},
+  };
+  TEST_ASSERT_EQUAL_UINT32(
+      sizeof(RV3032::JOB_CALLBACK_BOUNDS) /
+          sizeof(RV3032::JOB_CALLBACK_BOUNDS[0]) - 1U,
+      sizeof(entries) / sizeof(entries[0]));
+
+  const BoundFault faults[] = {
+      BoundFault::FAIL_CALLBACK, BoundFault::IGNORE_WRITE,
+      BoundFault::STUCK_BUSY, BoundFault::STUCK_BUSY_THEN_FAIL};
+  for (const Entry& entry : entries) {
+    const RV3032::JobCallbackBound& bound = RV3032::jobCallbackBound(entry.kind);
+    TEST_ASSERT_EQUAL_UINT8(static_cast<uint8_t>(entry.kind),
+                            static_cast<uint8_t>(bound.kind));
+    const BoundRun success =
+        runJobUnderFault(entry.start, BoundFault::NONE, 0, 1, false);
+    TEST_ASSERT_TRUE(success.status.ok());
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(bound.successCallbacks, success.callbacks);
+
+    const uint8_t budgets[] = {1, 255};
+    const bool reuseModes[] = {false, true};
+    for (uint8_t budget : budgets) {
+      for (bool reuse : reuseModes) {
+        for (BoundFault fault : faults) {
+          for (uint32_t ordinal = 1; ordinal <= success.callbacks + 1U;
+               ++ordinal) {
+            const BoundRun run =
+                runJobUnderFault(entry.start, fault, ordinal, budget, reuse);
+            TEST_ASSERT_LESS_OR_EQUAL_UINT32(bound.worstCaseCallbacks,
+                                             run.callbacks);
+            TEST_ASSERT_LESS_OR_EQUAL_UINT32(
+                bound.worstCaseNowMsCalls +
+                    RV3032::POLL_NOW_MS_CALLS_BASE * run.idlePolls,
+                run.nowCalls);
+          }
+        }
+      }
+    }
+  }
+
+  // The persistent caps compose from the engine's per-phase check caps.
+  TEST_ASSERT_EQUAL_UINT32(262U + 76U + 183U + 260U,
+                           RV3032::persistentWorstCaseCallbacks(1, 1));
+}
+
+void test_published_blocking_call_bounds_hold_under_fault_injection() {
+  FakeRv3032 idle;
+  RV3032::RV3032 rtc;
+  TEST_ASSERT_TRUE(rtc.begin(idle.config()).ok());
+  TEST_ASSERT_EQUAL_UINT32(RV3032::BEGIN_CALL_BOUND.worstCaseCallbacks,
+                           idle.callbackCount);
+  TEST_ASSERT_EQUAL_UINT32(RV3032::BEGIN_CALL_BOUND.worstCaseNowMsCalls,
+                           idle.nowCallCount);
+  for (uint32_t fail = 0; fail <= 1; ++fail) {
+    idle.failOrdinal = fail == 0 ? 0 : idle.callbackCount + 1U;
+    const uint32_t callbacks = idle.callbackCount;
+    const uint32_t nowCalls = idle.nowCallCount;
+    (void)rtc.recover();
+    TEST_ASSERT_EQUAL_UINT32(RV3032::RECOVER_CALL_BOUND.worstCaseCallbacks,
+                             idle.callbackCount - callbacks);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(
+        RV3032::RECOVER_CALL_BOUND.worstCaseNowMsCalls,
+        idle.nowCallCount - nowCalls);
+  }
+
+  // The blocking primary-cell ensure: safe C0 write plus a staged WRITE_ONE.
+  const RV3032::CallBound& ensure = RV3032::PRIMARY_CELL_ENSURE_CALL_BOUND;
+  auto runEnsure = [](BoundFault fault, uint32_t ordinal, uint32_t& callbacks,
+                      uint32_t& nowCalls) {
+    FakeRv3032 fake;
+    fake.persistent[0] = 0;
+    fake.activeConfig[0] = RV3032::cmd::PMU_BSM_LEVEL;
+    RV3032::RV3032 driver;
+    TEST_ASSERT_TRUE(driver.begin(fake.config(true)).ok());
+    switch (fault) {
+      case BoundFault::FAIL_CALLBACK:
+        fake.failOrdinal = ordinal;
+        break;
+      case BoundFault::IGNORE_WRITE:
+        fake.ignoreWriteOrdinal = ordinal;
+        break;
+      case BoundFault::STUCK_BUSY_THEN_FAIL:
+        fake.failOrdinal = ordinal + 1U;
+        // fall through
+      case BoundFault::STUCK_BUSY:
+        fake.forceBusyAfterCallbackOrdinal = ordinal;
+        fake.forcedBusyDurationMs = 5000;
+        break;
+      case BoundFault::NONE:
+        break;
+    }
+    RV3032::PrimaryCellConfigurationReport report{};
+    const RV3032::Status st = driver.ensurePrimaryCellConfiguration(report);
+    callbacks = fake.callbackCount;
+    nowCalls = fake.nowCallCount;
+    return st;
+  };
+  uint32_t successCallbacks = 0;
+  uint32_t nowCalls = 0;
+  TEST_ASSERT_TRUE(
+      runEnsure(BoundFault::NONE, 0, successCallbacks, nowCalls).ok());
+  TEST_ASSERT_EQUAL_UINT32(ensure.successCallbacks, successCallbacks);
+  TEST_ASSERT_LESS_OR_EQUAL_UINT32(ensure.worstCaseNowMsCalls, nowCalls);
+  const BoundFault faults[] = {
+      BoundFault::FAIL_CALLBACK, BoundFault::IGNORE_WRITE,
+      BoundFault::STUCK_BUSY, BoundFault::STUCK_BUSY_THEN_FAIL};
+  for (BoundFault fault : faults) {
+    for (uint32_t ordinal = 1; ordinal <= successCallbacks + 1U; ++ordinal) {
+      uint32_t callbacks = 0;
+      (void)runEnsure(fault, ordinal, callbacks, nowCalls);
+      TEST_ASSERT_LESS_OR_EQUAL_UINT32(ensure.worstCaseCallbacks, callbacks);
+      TEST_ASSERT_LESS_OR_EQUAL_UINT32(ensure.worstCaseNowMsCalls, nowCalls);
+    }
+  }
+  TEST_ASSERT_EQUAL_UINT32(34U + 256U + 64U + 101U + 256U,
+                           ensure.worstCaseCallbacks);
+
+  // One generic queue item, queued by a setter or released from write-behind,
+  // drained one callback per pollEeprom() call.
+  const RV3032::CallBound& item = RV3032::EEPROM_QUEUE_ITEM_CALL_BOUND;
+  auto runQueueItem = [](bool writeBehind, BoundFault fault, uint32_t ordinal,
+                         uint32_t& callbacks, uint32_t& nowCalls) {
+    FakeRv3032 fake;
+    RV3032::Config config = fake.config(true);
+    if (writeBehind) config.persistenceDebounceMs = 100;
+    RV3032::RV3032 driver;
+    TEST_ASSERT_TRUE(driver.begin(config).ok());
+    TEST_ASSERT_TRUE(driver.setOffsetPpb(1000).inProgress());
+    TEST_ASSERT_TRUE(pollJobToCompletion(driver, fake).ok());
+    TEST_ASSERT_EQUAL_UINT8(writeBehind ? 1 : 0,
+                            driver.persistenceStagedCount());
+    if (writeBehind) fake.nowMs += 100;
+    const uint32_t base = fake.callbackCount;
+    const uint32_t baseNow = fake.nowCallCount;
+    switch (fault) {
+      case BoundFault::FAIL_CALLBACK:
+        fake.failOrdinal = base + ordinal;
+        break;
+      case BoundFault::IGNORE_WRITE:
+        fake.ignoreWriteOrdinal = base + ordinal;
+        break;
+      case BoundFault::STUCK_BUSY_THEN_FAIL:
+        fake.failOrdinal = base + ordinal + 1U;
+        // fall through
+      case BoundFault::STUCK_BUSY:
+        fake.forceBusyAfterCallbackOrdinal = base + ordinal;
+        fake.forcedBusyDurationMs = 5000;
+        break;
+      case BoundFault::NONE:
+        break;
+    }
+    const RV3032::Status st = pollEepromToCompletion(driver, fake, 1);
+    TEST_ASSERT_FALSE(st.inProgress());
+    callbacks = fake.callbackCount - base;
+    nowCalls = fake.nowCallCount - baseNow;
+    return st;
+  };
+  for (uint8_t writeBehind = 0; writeBehind <= 1; ++writeBehind) {
+    uint32_t itemCallbacks = 0;
+    TEST_ASSERT_TRUE(runQueueItem(writeBehind != 0, BoundFault::NONE, 0,
+                                  itemCallbacks, nowCalls).ok());
+    TEST_ASSERT_EQUAL_UINT32(item.successCallbacks, itemCallbacks);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(item.worstCaseNowMsCalls, nowCalls);
+    for (BoundFault fault : faults) {
+      for (uint32_t ordinal = 1; ordinal <= itemCallbacks + 1U; ++ordinal) {
+        uint32_t callbacks = 0;
+        (void)runQueueItem(writeBehind != 0, fault, ordinal, callbacks,
+                           nowCalls);
+        TEST_ASSERT_LESS_OR_EQUAL_UINT32(item.worstCaseCallbacks, callbacks);
+        TEST_ASSERT_LESS_OR_EQUAL_UINT32(item.worstCaseNowMsCalls, nowCalls);
+      }
+    }
+  }
+  TEST_ASSERT_EQUAL_UINT32(RV3032::persistentWorstCaseCallbacks(1, 1) + 2U,
+                           item.worstCaseCallbacks);
+}
+
+void test_cancel_job_skips_forward_steps_with_bounded_cleanup() {
+  const auto pollUntilCallbacks = [](RV3032::RV3032& rtc, FakeRv3032& fake,
+                                     uint32_t callbacks) {
+    while (fake.callbackCount < callbacks) {
+      uint8_t used = 0;
+      TEST_ASSERT_TRUE(rtc.pollJob(fake.nowMs, 1, used).inProgress());
+      ++fake.nowMs;
+    }
+  };
+
+  {
+    FakeRv3032 fake;
+    RV3032::RV3032 rtc;
+    TEST_ASSERT_TRUE(rtc.begin(fake.config(false)).ok());
+    TEST_ASSERT_TRUE(rtc.startSetTimerJob(
+        10, RV3032::TimerFrequency::Hz64, true).inProgress());
+    const RV3032::Status cancelled = rtc.cancelJob();
+    TEST_ASSERT_EQUAL_UINT8(static_cast<uint8_t>(RV3032::Err::JOB_CANCELLED),
+                            static_cast<uint8_t>(cancelled.code));
+    TEST_ASSERT_EQUAL_UINT32(0, fake.callbackCount);
+    RV3032::ConfigurationJobReport report{};
+    TEST_ASSERT_EQUAL_UINT8(
+        static_cast<uint8_t>(RV3032::Err::JOB_CANCELLED),
+        static_cast<uint8_t>(rtc.getSetTimerJobResult(report).code));
+    TEST_ASSERT_EQUAL_UINT8(
+        static_cast<uint8_t>(RV3032::ConfigurationFinalState::UNCHANGED),
+        static_cast<uint8_t>(report.finalState));
+    TEST_ASSERT_EQUAL_UINT8(
+        static_cast<uint8_t>(RV3032::Err::JOB_CANCELLED),
+        static_cast<uint8_t>(rtc.cancelJob().code));
+  }
+
+  {
+    FakeRv3032 fake;
+    RV3032::RV3032 rtc;
+    TEST_ASSERT_TRUE(rtc.begin(fake.config(false)).ok());
+    RV3032::ClkoutConfig config{};
+    config.enabled = true;
+    config.highFrequencyMode = true;
+    config.xtalFrequency = RV3032::ClkoutFrequency::Hz32768;
+    config.highFrequencyDivider = 1;
+    TEST_ASSERT_TRUE(rtc.setClkoutConfig(config).inProgress());
+    // Both reads and the safe-gate write, then stop before the payload.
+    pollUntilCallbacks(rtc, fake, 3);
+    TEST_ASSERT_TRUE(rtc.cancelJob().inProgress());
+    TEST_ASSERT_EQUAL_UINT32(3, fake.callbackCount);
+    const RV3032::Status terminal = pollJobToCompletion(rtc, fake, 1);
+    TEST_ASSERT_EQUAL_UINT8(static_cast<uint8_t>(RV3032::Err::JOB_CANCELLED),
+                            static_cast<uint8_t>(terminal.code));
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(
+        3U + RV3032::CONFIGURATION_CLEANUP_CALLBACKS, fake.callbackCount);
+    RV3032::ConfigurationJobReport report{};
+    TEST_ASSERT_EQUAL_UINT8(
+        static_cast<uint8_t>(RV3032::Err::JOB_CANCELLED),
+        static_cast<uint8_t>(rtc.getSetClkoutConfigJobResult(report).code));
+    TEST_ASSERT_EQUAL_UINT8(
+        static_cast<uint8_t>(
+            RV3032::ConfigurationFinalState::SAFE_DISABLED_VERIFIED),
+        static_cast<uint8_t>(report.finalState));
+    TEST_ASSERT_TRUE(report.cleanupStatus.ok());
+    TEST_ASSERT_NOT_EQUAL(0, fake.activeConfig[0] &
+                                 RV3032::cmd::PMU_NCLKE_MASK);
+  }
+
+  // Cancel a user EEPROM write after every callback of its success path.
+  const uint8_t values[2] = {0x11, 0x22};
+  const uint32_t successCallbacks = RV3032::persistentSuccessCallbacks(2, 2);
+  for (uint32_t cancelAt = 0; cancelAt < successCallbacks; ++cancelAt) {
+    FakeRv3032 fake;
+    RV3032::RV3032 rtc;
+    TEST_ASSERT_TRUE(rtc.begin(fake.config(true)).ok());
+    const uint8_t control1 = fake.direct[RV3032::cmd::REG_CONTROL1];
+    const uint8_t activePmu = fake.activeConfig[0];
+    TEST_ASSERT_TRUE(rtc.startWriteUserEepromJob(0, values, sizeof(values),
+                                                 fake.nowMs, 1000).inProgress());
+    pollUntilCallbacks(rtc, fake, cancelAt);
+    const RV3032::Status cancel = rtc.cancelJob();
+    TEST_ASSERT_TRUE(cancel.inProgress() ||
+                     cancel.is(RV3032::Err::JOB_CANCELLED));
+    TEST_ASSERT_EQUAL_UINT32(cancelAt, fake.callbackCount);
+    const RV3032::Status terminal = pollJobToCompletion(rtc, fake, 1);
+    TEST_ASSERT_EQUAL_UINT8(static_cast<uint8_t>(RV3032::Err::JOB_CANCELLED),
+                            static_cast<uint8_t>(terminal.code));
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(
+        cancelAt + RV3032::PERSISTENT_CANCEL_CALLBACKS, fake.callbackCount);
+    RV3032::UserEepromWriteReport report{};
+    TEST_ASSERT_EQUAL_UINT8(
+        static_cast<uint8_t>(RV3032::Err::JOB_CANCELLED),
+        static_cast<uint8_t>(rtc.getUserEepromWriteJobResult(report).code));
+    // An immediate cancel changed no access state, so no restore was owed.
+    TEST_ASSERT_EQUAL(cancel.inProgress(), report.cleanupVerified);
+    TEST_ASSERT_TRUE(report.cleanupStatus.ok());
+    TEST_ASSERT_EQUAL_HEX8(control1, fake.direct[RV3032::cmd::REG_CONTROL1]);
+    TEST_ASSERT_EQUAL_HEX8(activePmu, fake.activeConfig[0]);
+  }
+
+  // Cancel a primary-cell ensure after every callback of its write path.
+  const uint32_t primaryCallbacks = RV3032::persistentSuccessCallbacks(1, 1);
+  for (uint32_t cancelAt = 0; cancelAt < primaryCallbacks; ++cancelAt) {
+    FakeRv3032 fake;
+    fake.persistent[0] = 0x5F;
+    fake.resetFromPersistent();
+    fake.direct[RV3032::cmd::REG_CONTROL1] = 0x3B;
+    RV3032::RV3032 rtc;
+    TEST_ASSERT_TRUE(rtc.begin(fake.config(true)).ok());
+    TEST_ASSERT_TRUE(
+        rtc.startEnsurePrimaryCellConfigurationJob(fake.nowMs).inProgress());
+    pollUntilCallbacks(rtc, fake, cancelAt);
+    const RV3032::Status cancel = rtc.cancelJob();
+    const RV3032::Status terminal = cancel.inProgress()
+        ? pollJobToCompletion(rtc, fake, 1)
+        : cancel;
+    TEST_ASSERT_EQUAL_UINT8(static_cast<uint8_t>(RV3032::Err::JOB_CANCELLED),
+                            static_cast<uint8_t>(terminal.code));
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(
+        cancelAt + RV3032::PERSISTENT_CANCEL_CALLBACKS, fake.callbackCount);
+    RV3032::PrimaryCellConfigurationReport report{};
+    (void)rtc.getEnsurePrimaryCellConfigurationJobResult(report);
+    TEST_ASSERT_TRUE(report.cleanupVerified);
+    TEST_ASSERT_FALSE(fake.protocolViolation);
+    const uint8_t control1 = fake.direct[RV3032::cmd::REG_CONTROL1];
+    if (!cancel.inProgress()) {
+      // Nothing was written, so the original state is untouched.
+      TEST_ASSERT_EQUAL_HEX8(0x3B, control1);
+      TEST_ASSERT_EQUAL_HEX8(0x5F, fake.activeConfig[0]);
+      continue;
+    }
+    TEST_ASSERT_EQUAL_HEX8(0, fake.activeConfig[0] & RV3032::cmd::PMU_TCM_MASK);
+    if (report.activeTargetVerified) {
+      TEST_ASSERT_EQUAL_HEX8(report.persistentTarget, fake.activeConfig[0]);
+      TEST_ASSERT_EQUAL_HEX8(0x3B, control1);
+    } else {
+      TEST_ASSERT_EQUAL_HEX8(0x5F & RV3032::cmd::PMU_PRIMARY_PRESERVE_MASK,
+                             fake.activeConfig[0]);
+      TEST_ASSERT_EQUAL_HEX8(0x3B | RV3032::cmd::CONTROL1_EERD_MASK, control1);
+      TEST_ASSERT_TRUE(report.autoRefreshHeldDisabledForSafety);
+    }
+  }
+
+  {
+    FakeRv3032 fake;
+    RV3032::RV3032 rtc;
+    TEST_ASSERT_TRUE(rtc.begin(fake.config(false)).ok());
+    TEST_ASSERT_TRUE(rtc.startReadTimeSnapshotJob(fake.nowMs).inProgress());
+    TEST_ASSERT_EQUAL_UINT8(static_cast<uint8_t>(RV3032::Err::JOB_CANCELLED),
+                            static_cast<uint8_t>(rtc.cancelJob().code));
+    TEST_ASSERT_FALSE(rtc.isJobBusy());
+    RV3032::TimeSnapshot snapshot{};
+    TEST_ASSERT_EQUAL_UINT8(
+        static_cast<uint8_t>(RV3032::Err::JOB_CANCELLED),
+        static_cast<uint8_t>(rtc.getReadTimeSnapshotJobResult(snapshot).code));
+    TEST_ASSERT_EQUAL_UINT32(0, fake.callbackCount);
+  }
+}
+
 void test_status_first_snapshot_rejects_every_invalid_calendar_encoding() {
   struct InvalidEncoding {
     uint8_t reg;
@@ -893,6 +1619,77 @@ void test_status_first_snapshot_rejects_every_invalid_calendar_encoding() {
   }
 }
 
+void test_validity_cached_snapshot_reads_one_fused_burst() {
+  FakeRv3032 fake;
+  fake.setCalendar(2026, 7, 13, 1, 2, 3, 6);
+  fake.direct[RV3032::cmd::REG_STATUS] = 0x00;
+  RV3032::RV3032 rtc;
+  RV3032::Config config = fake.config();
+  config.snapshotValidityMaxAgeMs = 1000;
+  TEST_ASSERT_TRUE(rtc.begin(config).ok());
+
+  const auto snapshot = [&](RV3032::TimeSnapshot& out) -> uint32_t {
+    const uint32_t before = fake.callbackCount;
+    TEST_ASSERT_TRUE(rtc.startReadTimeSnapshotJob(fake.nowMs).inProgress());
+    TEST_ASSERT_TRUE(pollJobToCompletion(rtc, fake).ok());
+    out = RV3032::TimeSnapshot{};
+    TEST_ASSERT_TRUE(rtc.getReadTimeSnapshotJobResult(out).ok());
+    return fake.callbackCount - before;
+  };
+
+  RV3032::TimeSnapshot result{};
+  const uint32_t provenMs = fake.nowMs;
+  TEST_ASSERT_EQUAL_UINT32(2, snapshot(result));
+  TEST_ASSERT_FALSE(result.cachedValidity);
+  TEST_ASSERT_TRUE(result.timeValid);
+
+  fake.nowMs = provenMs + 999U;
+  TEST_ASSERT_EQUAL_UINT32(1, snapshot(result));
+  TEST_ASSERT_TRUE(result.cachedValidity);
+  TEST_ASSERT_TRUE(result.timeValid);
+  TEST_ASSERT_TRUE(result.statusValid);
+  TEST_ASSERT_EQUAL_UINT8(3, result.time.second);
+  TEST_ASSERT_EQUAL_HEX8(RV3032::cmd::REG_SECONDS,
+                         fake.log[fake.logCount - 1U].reg);
+  TEST_ASSERT_EQUAL_UINT8(13, fake.log[fake.logCount - 1U].length);
+
+  // Fused reads do not renew the proof; the age limit forces status-first.
+  fake.nowMs = provenMs + 1000U;
+  TEST_ASSERT_EQUAL_UINT32(2, snapshot(result));
+  TEST_ASSERT_FALSE(result.cachedValidity);
+
+  rtc.invalidateValidityCache();
+  TEST_ASSERT_EQUAL_UINT32(2, snapshot(result));
+  TEST_ASSERT_EQUAL_UINT32(1, snapshot(result));
+
+  // VLF seen in the fused burst voids the calendar and the cached proof.
+  fake.direct[RV3032::cmd::REG_STATUS] = 0x01;
+  TEST_ASSERT_EQUAL_UINT32(1, snapshot(result));
+  TEST_ASSERT_TRUE(result.cachedValidity);
+  TEST_ASSERT_TRUE(result.statusFlags.voltageLow);
+  TEST_ASSERT_FALSE(result.timeValid);
+  fake.direct[RV3032::cmd::REG_STATUS] = 0x00;
+  TEST_ASSERT_EQUAL_UINT32(2, snapshot(result));
+
+  // A transport failure also drops the proof.
+  fake.failOrdinal = fake.callbackCount + 1U;
+  TEST_ASSERT_TRUE(rtc.startReadTimeSnapshotJob(fake.nowMs).inProgress());
+  TEST_ASSERT_FALSE(pollJobToCompletion(rtc, fake).ok());
+  TEST_ASSERT_EQUAL_UINT32(2, snapshot(result));
+
+  // The default configuration stays status-first.
+  FakeRv3032 plainFake;
+  plainFake.setCalendar(2026, 7, 13, 1, 2, 3, 6);
+  plainFake.direct[RV3032::cmd::REG_STATUS] = 0x00;
+  RV3032::RV3032 plain;
+  TEST_ASSERT_TRUE(plain.begin(plainFake.config()).ok());
+  for (int i = 0; i < 2; ++i) {
+    TEST_ASSERT_TRUE(plain.startReadTimeSnapshotJob(plainFake.nowMs).inProgress());
+    TEST_ASSERT_TRUE(pollJobToCompletion(plain, plainFake).ok());
+  }
+  TEST_ASSERT_EQUAL_UINT32(4, plainFake.callbackCount);
+}
+
 void test_status_first_snapshot_exposes_typed_invalid_flags() {
   for (uint8_t raw = 0; raw <= 3; ++raw) {
     FakeRv3032 fake;
@@ -983,11 +1780,11 @@ void test_verified_calendar_status_payload_is_fixed_for_every_status() {
         requested, fake.nowMs, 250).inProgress());
     TEST_ASSERT_TRUE(pollJobToCompletion(rtc, fake).ok());
 
-    TEST_ASSERT_EQUAL_UINT32(7, fake.logCount);
-    TEST_ASSERT_TRUE(fake.log[4].write);
-    TEST_ASSERT_EQUAL_HEX8(RV3032::cmd::REG_STATUS, fake.log[4].reg);
+    TEST_ASSERT_EQUAL_UINT32(5, fake.logCount);
+    TEST_ASSERT_TRUE(fake.log[3].write);
+    TEST_ASSERT_EQUAL_HEX8(RV3032::cmd::REG_STATUS, fake.log[3].reg);
     TEST_ASSERT_EQUAL_HEX8(RV3032::cmd::STATUS_CLEAR_INVALID_TIME_VALUE,
-                           fake.log[4].data[0]);
+                           fake.log[3].data[0]);
     TEST_ASSERT_EQUAL_HEX8(static_cast<uint8_t>(raw) & 0x3Cu,
                            fake.direct[RV3032::cmd::REG_STATUS]);
     TEST_ASSERT_EQUAL_UINT32(1,
@@ -1015,7 +1812,7 @@ void test_verified_calendar_preserves_flags_set_between_read_and_write() {
         requested, fake.nowMs, 250).inProgress());
 
     uint8_t used = 0;
-    for (uint8_t callback = 0; callback < 4; ++callback) {
+    for (uint8_t callback = 0; callback < 3; ++callback) {
       TEST_ASSERT_TRUE(rtc.pollJob(fake.nowMs, 1, used).inProgress());
       TEST_ASSERT_EQUAL_UINT8(1, used);
     }
@@ -1029,7 +1826,7 @@ void test_verified_calendar_preserves_flags_set_between_read_and_write() {
                           fake.direct[RV3032::cmd::REG_STATUS]);
     TEST_ASSERT_BITS_LOW(0x03, fake.direct[RV3032::cmd::REG_STATUS]);
     TEST_ASSERT_EQUAL_HEX8(RV3032::cmd::STATUS_CLEAR_INVALID_TIME_VALUE,
-                           fake.log[4].data[0]);
+                           fake.log[3].data[0]);
     TEST_ASSERT_EQUAL_UINT32(1,
         countWritesTo(fake, RV3032::cmd::REG_SECONDS));
     TEST_ASSERT_EQUAL_UINT32(1,
@@ -1037,6 +1834,152 @@ void test_verified_calendar_preserves_flags_set_between_read_and_write() {
   }
 }
 
+void test_verified_calendar_aligned_mode_lands_write_on_second_boundary() {
+  FakeRv3032 fake;
+  fake.direct[RV3032::cmd::REG_STATUS] = 0;
+  fake.nowMs = 10000;
+  fake.callbackDurationMs = 3;
+  RV3032::RV3032 rtc;
+  TEST_ASSERT_TRUE(rtc.begin(fake.config()).ok());
+
+  RV3032::SetTimeAlignment alignment{};
+  alignment.reference = RV3032::DateTime{2026, 7, 13, 23, 59, 59, 1};
+  alignment.referenceMillis = 400;
+  alignment.referenceAtMs = 9900;
+  TEST_ASSERT_TRUE(rtc.startSetTimeAndClearInvalidFlagsVerifiedJob(
+      alignment, fake.nowMs, 250).inProgress());
+
+  uint8_t used = 0;
+  TEST_ASSERT_TRUE(rtc.pollJob(fake.nowMs, 1, used).inProgress());
+  TEST_ASSERT_EQUAL_UINT8(1, used);
+  fake.nowMs = 10496;
+  TEST_ASSERT_TRUE(rtc.pollJob(fake.nowMs, 1, used).inProgress());
+  TEST_ASSERT_EQUAL_UINT8(0, used);
+  TEST_ASSERT_EQUAL_UINT32(1, fake.logCount);
+  fake.nowMs = 10497;
+  TEST_ASSERT_TRUE(rtc.pollJob(fake.nowMs, 1, used).inProgress());
+  TEST_ASSERT_EQUAL_UINT8(1, used);
+  TEST_ASSERT_EQUAL_UINT32(10500, fake.nowMs);
+  TEST_ASSERT_TRUE(pollJobToCompletion(rtc, fake).ok());
+
+  RV3032::VerifiedTimeSetReport report{};
+  TEST_ASSERT_TRUE(
+      rtc.getSetTimeAndClearInvalidFlagsVerifiedJobResult(report).ok());
+  TEST_ASSERT_TRUE(report.aligned);
+  TEST_ASSERT_TRUE(report.alignmentErrorValid);
+  TEST_ASSERT_EQUAL_INT(0, report.alignmentErrorMs);
+  TEST_ASSERT_EQUAL_UINT32(3, report.alignmentLatencyMs);
+  TEST_ASSERT_EQUAL_UINT32(10500, report.alignmentTargetMs);
+  TEST_ASSERT_EQUAL_UINT16(2026, report.requested.year);
+  TEST_ASSERT_EQUAL_UINT8(14, report.requested.day);
+  TEST_ASSERT_EQUAL_UINT8(0, report.requested.hour);
+  TEST_ASSERT_EQUAL_UINT8(0, report.requested.second);
+  TEST_ASSERT_EQUAL_UINT8(2, report.requested.weekday);
+  TEST_ASSERT_TRUE(fake.log[1].write);
+  TEST_ASSERT_EQUAL_HEX8(RV3032::cmd::REG_SECONDS, fake.log[1].reg);
+  TEST_ASSERT_EQUAL_HEX8(0x00, fake.log[1].data[0]);
+  TEST_ASSERT_EQUAL_HEX8(0x14, fake.log[1].data[4]);
+
+  // A poll that slips past the tolerance retargets the following second.
+  FakeRv3032 late;
+  late.direct[RV3032::cmd::REG_STATUS] = 0;
+  late.nowMs = 10000;
+  late.callbackDurationMs = 3;
+  RV3032::RV3032 lateRtc;
+  TEST_ASSERT_TRUE(lateRtc.begin(late.config()).ok());
+  TEST_ASSERT_TRUE(lateRtc.startSetTimeAndClearInvalidFlagsVerifiedJob(
+      alignment, late.nowMs, 1000).inProgress());
+  TEST_ASSERT_TRUE(lateRtc.pollJob(late.nowMs, 1, used).inProgress());
+  late.nowMs = 10510;
+  TEST_ASSERT_TRUE(lateRtc.pollJob(late.nowMs, 1, used).inProgress());
+  TEST_ASSERT_EQUAL_UINT8(0, used);
+  late.nowMs = 11497;
+  TEST_ASSERT_TRUE(pollJobToCompletion(lateRtc, late).ok());
+  TEST_ASSERT_TRUE(
+      lateRtc.getSetTimeAndClearInvalidFlagsVerifiedJobResult(report).ok());
+  TEST_ASSERT_EQUAL_UINT32(11500, report.alignmentTargetMs);
+  TEST_ASSERT_EQUAL_INT(0, report.alignmentErrorMs);
+  TEST_ASSERT_EQUAL_HEX8(0x01, late.log[1].data[0]);
+
+  // Without room for another second the slipped write goes out and is reported.
+  FakeRv3032 tight;
+  tight.direct[RV3032::cmd::REG_STATUS] = 0;
+  tight.nowMs = 10000;
+  tight.callbackDurationMs = 3;
+  RV3032::RV3032 tightRtc;
+  TEST_ASSERT_TRUE(tightRtc.begin(tight.config()).ok());
+  TEST_ASSERT_TRUE(tightRtc.startSetTimeAndClearInvalidFlagsVerifiedJob(
+      alignment, tight.nowMs, 250).inProgress());
+  TEST_ASSERT_TRUE(tightRtc.pollJob(tight.nowMs, 1, used).inProgress());
+  tight.nowMs = 10510;
+  TEST_ASSERT_TRUE(pollJobToCompletion(tightRtc, tight).ok());
+  TEST_ASSERT_TRUE(
+      tightRtc.getSetTimeAndClearInvalidFlagsVerifiedJobResult(report).ok());
+  TEST_ASSERT_EQUAL_UINT32(10500, report.alignmentTargetMs);
+  TEST_ASSERT_EQUAL_INT(13, report.alignmentErrorMs);
+
+  RV3032::Config noClock = fake.config();
+  noClock.nowMs = nullptr;
+  RV3032::RV3032 noClockRtc;
+  TEST_ASSERT_TRUE(noClockRtc.begin(noClock).ok());
+  const uint32_t callbacks = fake.callbackCount;
+  TEST_ASSERT_EQUAL_UINT8(
+      static_cast<uint8_t>(RV3032::Err::INVALID_CONFIG),
+      static_cast<uint8_t>(noClockRtc.startSetTimeAndClearInvalidFlagsVerifiedJob(
+          alignment, fake.nowMs, 250).code));
+  alignment.referenceMillis = 1000;
+  TEST_ASSERT_EQUAL_UINT8(
+      static_cast<uint8_t>(RV3032::Err::INVALID_PARAM),
+      static_cast<uint8_t>(rtc.startSetTimeAndClearInvalidFlagsVerifiedJob(
+          alignment, fake.nowMs, 250).code));
+  alignment.referenceMillis = 0;
+  alignment.referenceAtMs = fake.nowMs + 1;
+  TEST_ASSERT_EQUAL_UINT8(
+      static_cast<uint8_t>(RV3032::Err::INVALID_PARAM),
+      static_cast<uint8_t>(rtc.startSetTimeAndClearInvalidFlagsVerifiedJob(
+          alignment, fake.nowMs, 250).code));
+  TEST_ASSERT_EQUAL_UINT32(callbacks, fake.callbackCount);
+}
+
+void test_reuse_transfer_timestamps_reads_clock_once_per_instruction() {
+  uint32_t clockCalls[2] = {0, 0};
+  RV3032::VerifiedTimeSetReport reports[2]{};
+  for (uint8_t mode = 0; mode < 2; ++mode) {
+    FakeRv3032 fake;
+    fake.setCalendar(2020, 1, 1, 0, 0, 0, 3);
+    fake.callbackDurationMs = 1;
+    RV3032::Config cfg = fake.config();
+    cfg.reuseTransferTimestamps = (mode == 1);
+    RV3032::RV3032 rtc;
+    TEST_ASSERT_TRUE(rtc.begin(cfg).ok());
+    const RV3032::DateTime requested{2026, 7, 13, 12, 0, 0, 1};
+    TEST_ASSERT_TRUE(rtc.startSetTimeAndClearInvalidFlagsVerifiedJob(
+        requested, fake.nowMs, 250).inProgress());
+
+    const uint32_t before = fake.nowCallCount;
+    uint8_t used = 0;
+    TEST_ASSERT_TRUE(rtc.pollJob(fake.nowMs, 8, used).ok());
+    TEST_ASSERT_EQUAL_UINT8(5, used);
+    clockCalls[mode] = fake.nowCallCount - before;
+    TEST_ASSERT_TRUE(
+        rtc.getSetTimeAndClearInvalidFlagsVerifiedJobResult(reports[mode]).ok());
+    TEST_ASSERT_EQUAL_UINT32(fake.nowMs, rtc.lastOkMs());
+  }
+  TEST_ASSERT_TRUE(clockCalls[1] <= 6U);
+  TEST_ASSERT_TRUE(clockCalls[1] < clockCalls[0]);
+  TEST_ASSERT_EQUAL_UINT16(reports[0].verified.year,
+                          reports[1].verified.year);
+  TEST_ASSERT_EQUAL_UINT8(reports[0].verified.second,
+                          reports[1].verified.second);
+
+  FakeRv3032 fake;
+  RV3032::Config noClock = fake.config();
+  noClock.nowMs = nullptr;
+  noClock.reuseTransferTimestamps = true;
+  RV3032::RV3032 rtc;
+  TEST_ASSERT_EQUAL(RV3032::Err::INVALID_CONFIG, rtc.begin(noClock).code);
+}
+
 void test_verified_calendar_set_reports_status_side_effects() {
   FakeRv3032 fake;
   fake.setCalendar(2020, 1, 1, 0, 0, 0, 3);
@@ -1071,17 +2014,17 @@ void test_verified_calendar_set_reports_status_side_effects() {
 
   RV3032::Status st = RV3032::Status::Error(
       RV3032::Err::IN_PROGRESS, "not polled");
-  for (uint8_t phase = 0; phase < 7; ++phase) {
+  for (uint8_t phase = 0; phase < 5; ++phase) {
     st = rtc.pollJob(fake.nowMs, 1, used);
     TEST_ASSERT_EQUAL_UINT8(1, used);
     TEST_ASSERT_EQUAL_UINT32(static_cast<uint32_t>(phase + 1U),
                              fake.callbackCount);
-    if (phase < 6) {
+    if (phase < 4) {
       TEST_ASSERT_TRUE(st.inProgress());
     }
   }
   TEST_ASSERT_TRUE(st.ok());
-  TEST_ASSERT_EQUAL_UINT32(7, fake.logCount);
+  TEST_ASSERT_EQUAL_UINT32(5, fake.logCount);
   TEST_ASSERT_FALSE(fake.log[0].write);
   TEST_ASSERT_EQUAL_HEX8(RV3032::cmd::REG_STATUS, fake.log[0].reg);
   TEST_ASSERT_TRUE(fake.log[1].write);
@@ -1089,16 +2032,14 @@ void test_verified_calendar_set_reports_status_side_effects() {
   TEST_ASSERT_EQUAL_UINT8(7, fake.log[1].length);
   TEST_ASSERT_FALSE(fake.log[2].write);
   TEST_ASSERT_EQUAL_HEX8(RV3032::cmd::REG_SECONDS, fake.log[2].reg);
-  TEST_ASSERT_FALSE(fake.log[3].write);
+  TEST_ASSERT_EQUAL_UINT8(13, fake.log[2].length);
+  TEST_ASSERT_TRUE(fake.log[3].write);
   TEST_ASSERT_EQUAL_HEX8(RV3032::cmd::REG_STATUS, fake.log[3].reg);
-  TEST_ASSERT_TRUE(fake.log[4].write);
-  TEST_ASSERT_EQUAL_HEX8(RV3032::cmd::REG_STATUS, fake.log[4].reg);
   TEST_ASSERT_EQUAL_HEX8(RV3032::cmd::STATUS_CLEAR_INVALID_TIME_VALUE,
-                         fake.log[4].data[0]);
-  TEST_ASSERT_FALSE(fake.log[5].write);
-  TEST_ASSERT_EQUAL_HEX8(RV3032::cmd::REG_STATUS, fake.log[5].reg);
-  TEST_ASSERT_FALSE(fake.log[6].write);
-  TEST_ASSERT_EQUAL_HEX8(RV3032::cmd::REG_SECONDS, fake.log[6].reg);
+                         fake.log[3].data[0]);
+  TEST_ASSERT_FALSE(fake.log[4].write);
+  TEST_ASSERT_EQUAL_HEX8(RV3032::cmd::REG_SECONDS, fake.log[4].reg);
+  TEST_ASSERT_EQUAL_UINT8(13, fake.log[4].length);
   TEST_ASSERT_EQUAL_UINT32(1, countWritesTo(fake, RV3032::cmd::REG_SECONDS));
   TEST_ASSERT_EQUAL_UINT32(1, countWritesTo(fake, RV3032::cmd::REG_STATUS));
 
@@ -1213,9 +2154,9 @@ void test_calendar_multi_instruction_budget_refreshes_deadlines_and_cutoffs() {
     TEST_ASSERT_TRUE(rtc.startSetTimeAndClearInvalidFlagsVerifiedJob(
         requested, fake.nowMs, 250).inProgress());
     uint8_t used = 0;
-    TEST_ASSERT_TRUE(rtc.pollJob(fake.nowMs, 7, used).ok());
-    TEST_ASSERT_EQUAL_UINT8(7, used);
-    TEST_ASSERT_EQUAL_UINT32(7, fake.callbackCount);
+    TEST_ASSERT_TRUE(rtc.pollJob(fake.nowMs, 5, used).ok());
+    TEST_ASSERT_EQUAL_UINT8(5, used);
+    TEST_ASSERT_EQUAL_UINT32(5, fake.callbackCount);
     TEST_ASSERT_EQUAL_UINT32(1, countWritesTo(fake, RV3032::cmd::REG_SECONDS));
     TEST_ASSERT_EQUAL_UINT32(1, countWritesTo(fake, RV3032::cmd::REG_STATUS));
   }
@@ -1274,18 +2215,18 @@ void test_calendar_multi_instruction_budget_refreshes_deadlines_and_cutoffs() {
     RV3032::RV3032 rtc;
     TEST_ASSERT_TRUE(rtc.begin(config).ok());
     const RV3032::DateTime requested{2026, 7, 13, 12, 0, 0, 0};
-    // i2cTimeoutMs=5: max(7*5, 125 + 4*5 + 2) = 147 ms.
+    // i2cTimeoutMs=5: max(5*5, 125 + 3*5 + 2) = 142 ms.
     TEST_ASSERT_EQUAL_UINT8(
         static_cast<uint8_t>(RV3032::Err::INVALID_PARAM),
         static_cast<uint8_t>(rtc.startSetTimeAndClearInvalidFlagsVerifiedJob(
-            requested, 0, 146).code));
+            requested, 0, 141).code));
     TEST_ASSERT_EQUAL_UINT32(0, fake.callbackCount);
     TEST_ASSERT_TRUE(rtc.startSetTimeAndClearInvalidFlagsVerifiedJob(
-        requested, 0, 147).inProgress());
+        requested, 0, 142).inProgress());
     uint8_t used = 0;
-    TEST_ASSERT_TRUE(rtc.pollJob(0, 7, used).ok());
-    TEST_ASSERT_EQUAL_UINT8(7, used);
-    TEST_ASSERT_EQUAL_UINT32(7, fake.callbackCount);
+    TEST_ASSERT_TRUE(rtc.pollJob(0, 5, used).ok());
+    TEST_ASSERT_EQUAL_UINT8(5, used);
+    TEST_ASSERT_EQUAL_UINT32(5, fake.callbackCount);
   }
 }
 
@@ -1340,16 +2281,16 @@ void test_verified_calendar_retains_callback_status_on_timed_reconciliation() {
     TEST_ASSERT_TRUE(rtc.startSetTimeAndClearInvalidFlagsVerifiedJob(
         requested, 0, 250).inProgress());
     uint8_t used = 0;
-    for (uint8_t callback = 0; callback < 4; ++callback) {
+    for (uint8_t callback = 0; callback < 3; ++callback) {
       TEST_ASSERT_TRUE(rtc.pollJob(0, 1, used).inProgress());
       TEST_ASSERT_EQUAL_UINT8(1, used);
     }
 
     // The Status callback has the same OK-after-timeout outcome. The later
-    // Status and calendar readbacks reconcile it without replay.
+    // Status and calendar readback reconciles it without replay.
     fake.nowMs = 119;
     fake.callbackDurationMs = 5;
-    fake.lateCallbackOrdinal = 5;
+    fake.lateCallbackOrdinal = 4;
     fake.lateCallbackExtraMs = 1;
     TEST_ASSERT_TRUE(rtc.pollJob(fake.nowMs, 1, used).inProgress());
     TEST_ASSERT_EQUAL_UINT8(1, used);
@@ -1392,12 +2333,12 @@ void test_verified_calendar_accepts_one_second_rollover() {
                    rolled.minute, rolled.second, rolled.weekday);
   RV3032::Status st = RV3032::Status::Error(
       RV3032::Err::IN_PROGRESS, "not polled");
-  for (uint8_t phase = 2; phase < 7; ++phase) {
+  for (uint8_t phase = 2; phase < 5; ++phase) {
     st = rtc.pollJob(fake.nowMs, 1, used);
     TEST_ASSERT_EQUAL_UINT8(1, used);
   }
   TEST_ASSERT_TRUE(st.ok());
-  TEST_ASSERT_EQUAL_UINT32(7, fake.callbackCount);
+  TEST_ASSERT_EQUAL_UINT32(5, fake.callbackCount);
   RV3032::VerifiedTimeSetReport report{};
   TEST_ASSERT_TRUE(
       rtc.getSetTimeAndClearInvalidFlagsVerifiedJobResult(report).ok());
@@ -1425,9 +2366,7 @@ void test_verified_calendar_rejects_backward_final_read() {
   fake.setCalendar(first.year, first.month, first.day, first.hour, first.minute,
                    first.second, first.weekday);
   TEST_ASSERT_TRUE(rtc.pollJob(fake.nowMs, 1, used).inProgress());
-  for (uint8_t phase = 3; phase < 6; ++phase) {
-    TEST_ASSERT_TRUE(rtc.pollJob(fake.nowMs, 1, used).inProgress());
-  }
+  TEST_ASSERT_TRUE(rtc.pollJob(fake.nowMs, 1, used).inProgress());
   fake.setCalendar(requested.year, requested.month, requested.day,
                    requested.hour, requested.minute, requested.second,
                    requested.weekday);
@@ -1436,7 +2375,7 @@ void test_verified_calendar_rejects_backward_final_read() {
       static_cast<uint8_t>(RV3032::Err::EEPROM_VERIFY_FAILED),
       static_cast<uint8_t>(st.code));
   TEST_ASSERT_EQUAL_UINT8(1, used);
-  TEST_ASSERT_EQUAL_UINT32(7, fake.callbackCount);
+  TEST_ASSERT_EQUAL_UINT32(5, fake.callbackCount);
   TEST_ASSERT_EQUAL_UINT32(1, countWritesTo(fake, RV3032::cmd::REG_SECONDS));
   TEST_ASSERT_EQUAL_UINT32(1, countWritesTo(fake, RV3032::cmd::REG_STATUS));
 
@@ -1459,7 +2398,7 @@ void test_verified_calendar_rejects_two_second_final_read() {
   TEST_ASSERT_TRUE(rtc.startSetTimeAndClearInvalidFlagsVerifiedJob(
       requested, fake.nowMs, 250).inProgress());
   uint8_t used = 0;
-  for (uint8_t phase = 0; phase < 6; ++phase) {
+  for (uint8_t phase = 0; phase < 4; ++phase) {
     TEST_ASSERT_TRUE(rtc.pollJob(fake.nowMs, 1, used).inProgress());
     TEST_ASSERT_EQUAL_UINT8(1, used);
   }
@@ -1469,7 +2408,7 @@ void test_verified_calendar_rejects_two_second_final_read() {
       static_cast<uint8_t>(RV3032::Err::EEPROM_VERIFY_FAILED),
       static_cast<uint8_t>(st.code));
   TEST_ASSERT_EQUAL_UINT8(1, used);
-  TEST_ASSERT_EQUAL_UINT32(7, fake.callbackCount);
+  TEST_ASSERT_EQUAL_UINT32(5, fake.callbackCount);
   TEST_ASSERT_EQUAL_UINT32(1, countWritesTo(fake, RV3032::cmd::REG_SECONDS));
   TEST_ASSERT_EQUAL_UINT32(1, countWritesTo(fake, RV3032::cmd::REG_STATUS));
 }
@@ -1579,7 +2518,7 @@ void test_verified_calendar_reconciles_ambiguous_write_errors() {
     {
       FakeRv3032 fake;
       fake.direct[RV3032::cmd::REG_STATUS] = 0xFF;
-      fake.failOrdinal = 5;
+      fake.failOrdinal = 4;
       fake.failError = error;
       fake.failWriteAfterCommit = true;
       RV3032::RV3032 rtc;
@@ -1606,7 +2545,7 @@ void test_verified_calendar_reconciles_ambiguous_write_errors() {
     {
       FakeRv3032 fake;
       fake.direct[RV3032::cmd::REG_STATUS] = 0xFF;
-      fake.failOrdinal = 5;
+      fake.failOrdinal = 4;
       fake.failError = error;
       RV3032::RV3032 rtc;
       TEST_ASSERT_TRUE(rtc.begin(fake.config()).ok());
@@ -1641,7 +2580,7 @@ void test_verified_calendar_retains_proven_status_write_on_later_failure() {
   FakeRv3032 fake;
   fake.setCalendar(2020, 1, 1, 0, 0, 0, 3);
   fake.direct[RV3032::cmd::REG_STATUS] = 0xFF;
-  fake.failOrdinal = 5;
+  fake.failOrdinal = 4;
   fake.failError = RV3032::Err::I2C_TIMEOUT;
   fake.failWriteAfterCommit = true;
   RV3032::RV3032 rtc;
@@ -1651,18 +2590,20 @@ void test_verified_calendar_retains_proven_status_write_on_later_failure() {
       requested, fake.nowMs, 250).inProgress());
 
   uint8_t used = 0;
-  TEST_ASSERT_TRUE(rtc.pollJob(fake.nowMs, 6, used).inProgress());
-  TEST_ASSERT_EQUAL_UINT8(6, used);
-  fake.failOrdinal = 7;
-  fake.failError = RV3032::Err::I2C_BUS;
+  TEST_ASSERT_TRUE(rtc.pollJob(fake.nowMs, 4, used).inProgress());
+  TEST_ASSERT_EQUAL_UINT8(4, used);
+  // The post-clear Status proves the write; the same burst's calendar then
+  // fails the monotonic window.
+  fake.setCalendar(2026, 7, 13, 12, 0, 2, 0);
   const RV3032::Status terminal = rtc.pollJob(fake.nowMs, 1, used);
-  TEST_ASSERT_EQUAL_UINT8(static_cast<uint8_t>(RV3032::Err::I2C_BUS),
-                          static_cast<uint8_t>(terminal.code));
+  TEST_ASSERT_EQUAL_UINT8(
+      static_cast<uint8_t>(RV3032::Err::EEPROM_VERIFY_FAILED),
+      static_cast<uint8_t>(terminal.code));
   TEST_ASSERT_EQUAL_UINT8(1, used);
 
   RV3032::VerifiedTimeSetReport report{};
   TEST_ASSERT_EQUAL_UINT8(
-      static_cast<uint8_t>(RV3032::Err::I2C_BUS),
+      static_cast<uint8_t>(RV3032::Err::EEPROM_VERIFY_FAILED),
       static_cast<uint8_t>(
           rtc.getSetTimeAndClearInvalidFlagsVerifiedJobResult(report).code));
   TEST_ASSERT_TRUE(report.statusWriteAttempted);
@@ -1821,6 +2762,38 @@ void test_raw_access_allowlists_block_side_effect_routes() {
       fake.direct[RV3032::cmd::REG_USER_RAM_START]);
 }
 
+void test_generated_register_map_matches_raw_access_contract() {
+  FakeRv3032 fake;
+  RV3032::RV3032 rtc;
+  TEST_ASSERT_TRUE(rtc.begin(fake.config()).ok());
+  for (uint16_t address = 0; address <= 0xFF; ++address) {
+    const uint8_t reg = static_cast<uint8_t>(address);
+    const uint32_t callbacks = fake.callbackCount;
+    uint8_t value = 0;
+    const bool readable =
+        RV3032::regmap::contains(RV3032::regmap::PUBLIC_READABLE_BITMAP, reg);
+    TEST_ASSERT_EQUAL(readable, rtc.readRegister(reg, value).ok());
+    TEST_ASSERT_EQUAL_UINT32(callbacks + (readable ? 1U : 0U),
+                             fake.callbackCount);
+    if (!RV3032::regmap::contains(RV3032::regmap::RAW_WRITABLE_BITMAP, reg)) {
+      TEST_ASSERT_EQUAL_UINT8(
+          static_cast<uint8_t>(RV3032::Err::INVALID_PARAM),
+          static_cast<uint8_t>(rtc.writeRegister(reg, 0).code));
+      TEST_ASSERT_EQUAL_UINT32(callbacks + (readable ? 1U : 0U),
+                               fake.callbackCount);
+    }
+  }
+
+  using RV3032::regmap::ActiveOffset;
+  using RV3032::regmap::ActiveClkout2;
+  TEST_ASSERT_EQUAL_INT(-1, ActiveOffset::OFFSET.getSigned(0x3F));
+  TEST_ASSERT_EQUAL_INT(-32, ActiveOffset::OFFSET.getSigned(0xE0));
+  TEST_ASSERT_EQUAL_INT(31, ActiveOffset::OFFSET.getSigned(0x1F));
+  TEST_ASSERT_TRUE(ActiveOffset::PORIE.test(0x80));
+  TEST_ASSERT_EQUAL_HEX8(0xA0, ActiveClkout2::FD.with(0xE0, 1));
+  TEST_ASSERT_EQUAL_UINT8(3, ActiveClkout2::FD.get(0x60));
+}
+
 void test_persistent_inspection_uses_direct_two_read_proof() {
   FakeRv3032 fake;
   fake.persistent[1] = 0x5A;
@@ -2083,6 +3056,83 @@ void test_user_eeprom_read_boundaries_and_maximum_chunk() {
   TEST_ASSERT_FALSE(rtc.isJobBusy());
 }
 
+void test_persistent_read_cache_serves_proven_bytes_with_zero_io() {
+  FakeRv3032 fake;
+  const uint8_t persistentBase = static_cast<uint8_t>(
+      RV3032::cmd::USER_EEPROM_START - RV3032::cmd::CONFIG_EEPROM_START);
+  for (uint8_t i = 0; i < 4; ++i) {
+    fake.persistent[persistentBase + i] = static_cast<uint8_t>(0x60u + i);
+  }
+  RV3032::Config config = fake.config(true);
+  config.cachePersistentReads = true;
+  RV3032::RV3032 rtc;
+  TEST_ASSERT_TRUE(rtc.begin(config).ok());
+
+  auto readUser = [&](uint8_t offset, uint8_t length,
+                      RV3032::PersistentReadResult& result) {
+    const RV3032::Status admitted =
+        rtc.startReadUserEepromJob(offset, length, fake.nowMs, 1000);
+    if (admitted.inProgress()) {
+      TEST_ASSERT_TRUE(pollJobToCompletion(rtc, fake).ok());
+    } else {
+      TEST_ASSERT_TRUE(admitted.ok());
+    }
+    TEST_ASSERT_TRUE(rtc.getPersistentReadJobResult(result).ok());
+  };
+
+  RV3032::PersistentReadResult result{};
+  readUser(0, 4, result);
+  TEST_ASSERT_FALSE(result.fromCache);
+  TEST_ASSERT_EQUAL_UINT32(0, rtc.persistentCacheHits());
+  TEST_ASSERT_EQUAL_UINT32(1, rtc.persistentCacheMisses());
+
+  // A proven subrange completes at admission without touching the bus.
+  const uint32_t callbacks = fake.callbackCount;
+  readUser(1, 2, result);
+  TEST_ASSERT_EQUAL_UINT32(callbacks, fake.callbackCount);
+  TEST_ASSERT_TRUE(result.fromCache);
+  TEST_ASSERT_TRUE(result.persistentVerified);
+  TEST_ASSERT_TRUE(result.cleanupVerified);
+  TEST_ASSERT_EQUAL_UINT8(2, result.length);
+  TEST_ASSERT_EQUAL_HEX8(0x61, result.data[0]);
+  TEST_ASSERT_EQUAL_HEX8(0x62, result.data[1]);
+  TEST_ASSERT_EQUAL_UINT32(1, rtc.persistentCacheHits());
+  TEST_ASSERT_FALSE(rtc.isJobBusy());
+
+  // The driver's own WRITE_ONE drops the byte; its proof reads re-cache it.
+  const uint8_t value = 0xA5;
+  TEST_ASSERT_TRUE(rtc.startWriteUserEepromJob(1, &value, 1, fake.nowMs,
+                                               1000).inProgress());
+  TEST_ASSERT_TRUE(pollJobToCompletion(rtc, fake).ok());
+  readUser(0, 4, result);
+  TEST_ASSERT_TRUE(result.fromCache);
+  TEST_ASSERT_EQUAL_HEX8(0xA5, result.data[1]);
+
+  // Bytes outside the proven range still miss.
+  readUser(0, 5, result);
+  TEST_ASSERT_FALSE(result.fromCache);
+
+  // Observed PORF means the device restarted; nothing cached survives.
+  fake.direct[RV3032::cmd::REG_STATUS] = 1u << RV3032::cmd::STATUS_PORF_BIT;
+  RV3032::StatusFlags flags{};
+  TEST_ASSERT_TRUE(rtc.readStatusFlags(flags).ok());
+  TEST_ASSERT_TRUE(flags.powerOnReset);
+  fake.persistent[persistentBase] = 0x11;
+  readUser(0, 1, result);
+  TEST_ASSERT_FALSE(result.fromCache);
+  TEST_ASSERT_EQUAL_HEX8(0x11, result.data[0]);
+
+  rtc.invalidatePersistentCache();
+  const uint32_t misses = rtc.persistentCacheMisses();
+  readUser(0, 1, result);
+  TEST_ASSERT_FALSE(result.fromCache);
+  TEST_ASSERT_EQUAL_UINT32(misses + 1U, rtc.persistentCacheMisses());
+
+  rtc.end();
+  TEST_ASSERT_EQUAL_UINT32(0, rtc.persistentCacheHits());
+  TEST_ASSERT_EQUAL_UINT32(0, rtc.persistentCacheMisses());
+}
+
 void test_user_eeprom_write_admission_copy_and_partial_failure_report() {
   const uint8_t persistentBase = static_cast<uint8_t>(
       RV3032::cmd::USER_EEPROM_START - RV3032::cmd::CONFIG_EEPROM_START);
@@ -2475,6 +3525,75 @@ void test_generic_persistence_uses_full_budget_and_durable_protocol() {
   TEST_ASSERT_TRUE(sawConfigurationAddress);
 }
 
+void test_write_behind_persistence_writes_only_the_settled_value() {
+  FakeRv3032 fake;
+  RV3032::Config config = fake.config(true);
+  config.persistenceDebounceMs = RV3032::PERSISTENCE_DEBOUNCE_MAX_MS + 1U;
+  RV3032::RV3032 rtc;
+  TEST_ASSERT_EQUAL_UINT8(static_cast<uint8_t>(RV3032::Err::INVALID_CONFIG),
+                          static_cast<uint8_t>(rtc.begin(config).code));
+  config.persistenceDebounceMs = 100;
+  TEST_ASSERT_TRUE(rtc.begin(config).ok());
+
+  const uint8_t offsetIndex = static_cast<uint8_t>(
+      RV3032::cmd::REG_ACTIVE_OFFSET - RV3032::cmd::CONFIG_EEPROM_START);
+  const uint8_t before = fake.persistent[offsetIndex];
+  for (int32_t ppb = 100; ppb <= 1000; ppb += 100) {
+    TEST_ASSERT_TRUE(rtc.setOffsetPpb(ppb).inProgress());
+    TEST_ASSERT_TRUE(pollJobToCompletion(rtc, fake).ok());
+    TEST_ASSERT_EQUAL_UINT8(1, rtc.persistenceStagedCount());
+    TEST_ASSERT_EQUAL_UINT8(0, rtc.eepromQueueDepth());
+    TEST_ASSERT_FALSE(rtc.isEepromBusy());
+    const uint32_t callbacks = fake.callbackCount;
+    TEST_ASSERT_TRUE(rtc.tick(fake.nowMs).inProgress());
+    TEST_ASSERT_EQUAL_UINT32(callbacks, fake.callbackCount);
+    fake.nowMs += 10;
+  }
+  const uint8_t settled = fake.activeConfig[1];
+  TEST_ASSERT_EQUAL_HEX8(before, fake.persistent[offsetIndex]);
+
+  RV3032::SettingsSnapshot settings{};
+  TEST_ASSERT_TRUE(rtc.getSettings(settings).ok());
+  TEST_ASSERT_EQUAL_UINT32(100, settings.persistenceDebounceMs);
+  TEST_ASSERT_EQUAL_UINT8(1, settings.persistenceStaged);
+
+  TEST_ASSERT_TRUE(pollEepromToCompletion(rtc, fake, 4).ok());
+  TEST_ASSERT_EQUAL_UINT16(1, fake.writeOneAttempts);
+  TEST_ASSERT_EQUAL_UINT32(1, rtc.eepromWriteCount());
+  TEST_ASSERT_EQUAL_HEX8(settled, fake.persistent[offsetIndex]);
+  TEST_ASSERT_EQUAL_UINT8(0, rtc.persistenceStagedCount());
+
+  // flushPersistence() releases at once without waiting for the window.
+  TEST_ASSERT_TRUE(rtc.setOffsetPpb(-500).inProgress());
+  TEST_ASSERT_TRUE(pollJobToCompletion(rtc, fake).ok());
+  const uint32_t callbacks = fake.callbackCount;
+  TEST_ASSERT_TRUE(rtc.flushPersistence().inProgress());
+  TEST_ASSERT_EQUAL_UINT32(callbacks, fake.callbackCount);
+  TEST_ASSERT_EQUAL_UINT8(0, rtc.persistenceStagedCount());
+  TEST_ASSERT_EQUAL_UINT8(1, rtc.eepromQueueDepth());
+  uint8_t used = 0;
+  TEST_ASSERT_TRUE(rtc.pollEeprom(fake.nowMs, 1, used).inProgress());
+  TEST_ASSERT_EQUAL_UINT8(1, used);
+  TEST_ASSERT_TRUE(pollEepromToCompletion(rtc, fake, 4).ok());
+  TEST_ASSERT_EQUAL_UINT16(2, fake.writeOneAttempts);
+  TEST_ASSERT_EQUAL_HEX8(fake.activeConfig[1], fake.persistent[offsetIndex]);
+  TEST_ASSERT_TRUE(rtc.flushPersistence().ok());
+
+  // Staged values never block unrelated work, but do block primary-cell
+  // provisioning, which would be overwritten by a later release.
+  TEST_ASSERT_TRUE(rtc.setOffsetPpb(200).inProgress());
+  TEST_ASSERT_TRUE(pollJobToCompletion(rtc, fake).ok());
+  const uint8_t ram[2] = {1, 2};
+  TEST_ASSERT_TRUE(rtc.startWriteUserRamJob(0, ram, sizeof(ram)).inProgress());
+  TEST_ASSERT_TRUE(pollJobToCompletion(rtc, fake).ok());
+  TEST_ASSERT_EQUAL_UINT8(
+      static_cast<uint8_t>(RV3032::Err::BUSY),
+      static_cast<uint8_t>(rtc.startEnsurePrimaryCellConfigurationJob(
+          fake.nowMs).code));
+  rtc.end();
+  TEST_ASSERT_EQUAL_UINT8(0, rtc.persistenceStagedCount());
+}
+
 void test_generic_persistence_clears_stale_eef_and_restores_access_state() {
   FakeRv3032 fake;
   fake.direct[RV3032::cmd::REG_CONTROL1] = 0x3B;
@@ -2862,32 +3981,496 @@ void test_generic_persistence_staging_and_ambiguous_write_one_paths() {
     TEST_ASSERT_FALSE(fake.unsafeAccessStateAtCommand);
   }
 
-  {
-    FakeRv3032 fake;
-    const uint8_t persistentBefore = fake.persistent[0];
-    RV3032::RV3032 rtc;
-    TEST_ASSERT_TRUE(rtc.begin(fake.config(true)).ok());
-    TEST_ASSERT_TRUE(rtc.setTrickleChargeMode(
-        RV3032::TrickleChargeMode::V3_0).inProgress());
-    TEST_ASSERT_TRUE(pollJobToCompletion(rtc, fake).ok());
-    const uint8_t expectedActive = fake.activeConfig[0];
-    fake.failOrdinal = commandOrdinal;
-    const RV3032::Status status = pollEepromToCompletion(rtc, fake, 1);
-    TEST_ASSERT_EQUAL_UINT8(
-        static_cast<uint8_t>(RV3032::Err::I2C_BUS),
-        static_cast<uint8_t>(status.code));
-    TEST_ASSERT_EQUAL_UINT8(static_cast<uint8_t>(status.code),
-                            static_cast<uint8_t>(rtc.getEepromStatus().code));
-    TEST_ASSERT_EQUAL_UINT32(0, rtc.eepromWriteCount());
-    TEST_ASSERT_EQUAL_UINT32(1, rtc.eepromWriteFailures());
-    TEST_ASSERT_EQUAL_UINT16(0, fake.writeOneAttempts);
-    TEST_ASSERT_EQUAL_UINT32(1, countEepromCommands(
-        fake, RV3032::cmd::EEPROM_CMD_WRITE_ONE));
-    TEST_ASSERT_EQUAL_HEX8(persistentBefore, fake.persistent[0]);
-    TEST_ASSERT_EQUAL_HEX8(expectedActive, fake.activeConfig[0]);
-    TEST_ASSERT_FALSE(fake.protocolViolation);
-    TEST_ASSERT_FALSE(fake.unsafeAccessStateAtCommand);
+  {
+    FakeRv3032 fake;
+    const uint8_t persistentBefore = fake.persistent[0];
+    RV3032::RV3032 rtc;
+    TEST_ASSERT_TRUE(rtc.begin(fake.config(true)).ok());
+    TEST_ASSERT_TRUE(rtc.setTrickleChargeMode(
+        RV3032::TrickleChargeMode::V3_0).inProgress());
+    TEST_ASSERT_TRUE(pollJobToCompletion(rtc, fake).ok());
+    const uint8_t expectedActive = fake.activeConfig[0];
+    fake.failOrdinal = commandOrdinal;
+    const RV3032::Status status = pollEepromToCompletion(rtc, fake, 1);
+    TEST_ASSERT_EQUAL_UINT8(
+        static_cast<uint8_t>(RV3032::Err::I2C_BUS),
+        static_cast<uint8_t>(status.code));
+    TEST_ASSERT_EQUAL_UINT8(static_cast<uint8_t>(status.code),
+                            static_cast<uint8_t>(rtc.getEepromStatus().code));
+    TEST_ASSERT_EQUAL_UINT32(0, rtc.eepromWriteCount());
+    TEST_ASSERT_EQUAL_UINT32(1, rtc.eepromWriteFailures());
+    TEST_ASSERT_EQUAL_UINT16(0, fake.writeOneAttempts);
+    TEST_ASSERT_EQUAL_UINT32(1, countEepromCommands(
+        fake, RV3032::cmd::EEPROM_CMD_WRITE_ONE));
+    TEST_ASSERT_EQUAL_HEX8(persistentBefore, fake.persistent[0]);
+    TEST_ASSERT_EQUAL_HEX8(expectedActive, fake.activeConfig[0]);
+    TEST_ASSERT_FALSE(fake.protocolViolation);
+    TEST_ASSERT_FALSE(fake.unsafeAccessStateAtCommand);
+  }
+}
+
+RV3032::DateTime utcDate(uint16_t year, uint8_t month, uint8_t day,
+                         uint8_t hour, uint8_t minute, uint8_t second) {
+  RV3032::DateTime value{};
+  value.year = year;
+  value.month = month;
+  value.day = day;
+  value.hour = hour;
+  value.minute = minute;
+  value.second = second;
+  return value;
+}
+
+void assertDateTime(const RV3032::DateTime& expected,
+                    const RV3032::DateTime& actual) {
+  TEST_ASSERT_EQUAL_UINT16(expected.year, actual.year);
+  TEST_ASSERT_EQUAL_UINT8(expected.month, actual.month);
+  TEST_ASSERT_EQUAL_UINT8(expected.day, actual.day);
+  TEST_ASSERT_EQUAL_UINT8(expected.hour, actual.hour);
+  TEST_ASSERT_EQUAL_UINT8(expected.minute, actual.minute);
+  TEST_ASSERT_EQUAL_UINT8(expected.second, actual.second);
+}
+
+void test_iso8601_format_and_parse_follow_datetime_validation() {
+  char text[RV3032::RV3032::ISO8601_BUFFER_SIZE] = {};
+  RV3032::DateTime parsed{};
+  uint8_t hundredths = 0;
+
+  RV3032::DateTime value = utcDate(2026, 7, 13, 4, 5, 6);
+  TEST_ASSERT_TRUE(RV3032::RV3032::formatIso8601(value, 7, text).ok());
+  TEST_ASSERT_EQUAL_STRING("2026-07-13T04:05:06.07Z", text);
+  TEST_ASSERT_TRUE(RV3032::RV3032::formatIso8601(
+      value, RV3032::RV3032::ISO8601_NO_HUNDREDTHS, text).ok());
+  TEST_ASSERT_EQUAL_STRING("2026-07-13T04:05:06Z", text);
+  TEST_ASSERT_TRUE(RV3032::RV3032::parseIso8601(text, parsed, &hundredths).ok());
+  TEST_ASSERT_EQUAL_UINT8(RV3032::RV3032::ISO8601_NO_HUNDREDTHS, hundredths);
+  TEST_ASSERT_EQUAL_UINT8(1, parsed.weekday);
+
+  // Every calendar field combination agrees with isValidDateTime().
+  for (uint16_t year = 1999; year <= 2100; ++year) {
+    for (uint8_t month = 0; month <= 13; ++month) {
+      for (uint8_t day = 0; day <= 32; ++day) {
+        value = utcDate(year, month, day, 23, 59, 58);
+        const bool valid = RV3032::RV3032::isValidDateTime(value);
+        memset(text, 'x', sizeof(text));
+        const RV3032::Status st = RV3032::RV3032::formatIso8601(
+            value, static_cast<uint8_t>(day * 3U), text);
+        TEST_ASSERT_EQUAL(valid, st.ok());
+        if (!valid) {
+          TEST_ASSERT_EQUAL_HEX8('x', text[0]);
+          continue;
+        }
+        TEST_ASSERT_EQUAL_UINT32(23, strlen(text));
+        TEST_ASSERT_TRUE(
+            RV3032::RV3032::parseIso8601(text, parsed, &hundredths).ok());
+        assertDateTime(value, parsed);
+        TEST_ASSERT_EQUAL_UINT8(day * 3U, hundredths);
+      }
+    }
+  }
+  for (uint8_t hour = 0; hour <= 24; ++hour) {
+    for (uint8_t minute = 0; minute <= 60; ++minute) {
+      for (uint8_t second = 0; second <= 60; ++second) {
+        value = utcDate(2024, 2, 29, hour, minute, second);
+        const bool valid = RV3032::RV3032::isValidDateTime(value);
+        TEST_ASSERT_EQUAL(valid, RV3032::RV3032::formatIso8601(
+            value, RV3032::RV3032::ISO8601_NO_HUNDREDTHS, text).ok());
+        if (valid) {
+          TEST_ASSERT_TRUE(RV3032::RV3032::parseIso8601(text, parsed).ok());
+          assertDateTime(value, parsed);
+        }
+      }
+    }
+  }
+
+  // Text that names an invalid calendar value parses as INVALID_DATETIME.
+  const char* const rejected[] = {
+      "2023-02-29T00:00:00Z", "1999-12-31T23:59:59Z", "2100-01-01T00:00:00Z",
+      "2026-13-01T00:00:00Z", "2026-04-31T00:00:00Z", "2026-01-01T24:00:00Z",
+      "2026-01-01T00:60:00Z", "2026-01-01T00:00:60Z", "2026-01-01t00:00:00Z",
+      "2026-01-01T00:00:00z", "2026-01-01T00:00:00", "2026-01-01T00:00:00+00:00",
+      "2026-01-01T00:00:00.1Z", "2026-01-01T00:00:00.123Z",
+      "2026-01-01T00:00:00Z ", " 2026-01-01T00:00:00Z", "2026-01-01 00:00:00Z",
+      "2026-1-01T00:00:00Z", "+026-01-01T00:00:00Z", "2026-01-01T00:00:0aZ",
+      "2026-01-01T00:00:00.-1Z", "2026-01-01T00:00:00.",
+      "2026-01-01T00:00:00.1", "2026", ""};
+  for (const char* bad : rejected) {
+    parsed = utcDate(2001, 1, 1, 0, 0, 0);
+    hundredths = 42;
+    TEST_ASSERT_EQUAL_UINT8(
+        static_cast<uint8_t>(RV3032::Err::INVALID_DATETIME),
+        static_cast<uint8_t>(
+            RV3032::RV3032::parseIso8601(bad, parsed, &hundredths).code));
+    TEST_ASSERT_EQUAL_UINT16(2001, parsed.year);
+    TEST_ASSERT_EQUAL_UINT8(42, hundredths);
+  }
+  TEST_ASSERT_EQUAL_UINT8(
+      static_cast<uint8_t>(RV3032::Err::INVALID_PARAM),
+      static_cast<uint8_t>(
+          RV3032::RV3032::parseIso8601(nullptr, parsed).code));
+
+  value = utcDate(2026, 7, 13, 4, 5, 6);
+  TEST_ASSERT_EQUAL_UINT8(
+      static_cast<uint8_t>(RV3032::Err::INVALID_PARAM),
+      static_cast<uint8_t>(
+          RV3032::RV3032::formatIso8601(value, 100, text).code));
+  char shortBuffer[21] = {};
+  TEST_ASSERT_EQUAL_UINT8(
+      static_cast<uint8_t>(RV3032::Err::INVALID_PARAM),
+      static_cast<uint8_t>(RV3032::RV3032::formatIso8601(
+          value, 5, shortBuffer, sizeof(shortBuffer)).code));
+  TEST_ASSERT_TRUE(RV3032::RV3032::formatIso8601(
+      value, RV3032::RV3032::ISO8601_NO_HUNDREDTHS, shortBuffer,
+      sizeof(shortBuffer)).ok());
+  TEST_ASSERT_EQUAL_STRING("2026-07-13T04:05:06Z", shortBuffer);
+}
+
+void test_packed_datetime_orders_and_round_trips_every_day() {
+  RV3032::PackedDateTime previous{};
+  bool first = true;
+  static constexpr uint32_t kSecondsOfDay[] = {0, 1, 3599, 43200, 86399};
+  for (uint32_t day = 0; day < 36525UL; ++day) {
+    for (uint32_t secondOfDay : kSecondsOfDay) {
+      const uint32_t unix = 946684800UL + day * 86400UL + secondOfDay;
+      RV3032::DateTime time{};
+      TEST_ASSERT_TRUE(RV3032::RV3032::unixToDateTime(unix, time).ok());
+      RV3032::PackedDateTime packed{};
+      TEST_ASSERT_TRUE(RV3032::RV3032::packDateTime(time, packed).ok());
+      TEST_ASSERT_TRUE(first || previous < packed);
+      first = false;
+      previous = packed;
+
+      const uint8_t bcd[7] = {
+          FakeRv3032::bcd(time.second), FakeRv3032::bcd(time.minute),
+          FakeRv3032::bcd(time.hour), time.weekday, FakeRv3032::bcd(time.day),
+          FakeRv3032::bcd(time.month),
+          FakeRv3032::bcd(static_cast<uint8_t>(time.year - 2000U))};
+      RV3032::PackedDateTime fromBurst{};
+      TEST_ASSERT_TRUE(RV3032::RV3032::packCalendarBcd(bcd, fromBurst).ok());
+      TEST_ASSERT_TRUE(packed == fromBurst);
+
+      RV3032::DateTime unpacked{};
+      TEST_ASSERT_TRUE(RV3032::RV3032::unpackDateTime(packed, unpacked).ok());
+      assertDateTime(time, unpacked);
+      TEST_ASSERT_EQUAL_UINT8(time.weekday, unpacked.weekday);
+      uint32_t roundTrip = 0;
+      TEST_ASSERT_TRUE(RV3032::RV3032::packedToUnix(packed, roundTrip).ok());
+      TEST_ASSERT_EQUAL_UINT32(unix, roundTrip);
+    }
+  }
+  TEST_ASSERT_EQUAL_UINT32(3214079999UL, previous.value);
+
+  // Unused day slots and values past 2099 never unpack.
+  RV3032::DateTime untouched = utcDate(2001, 1, 1, 0, 0, 0);
+  RV3032::PackedDateTime feb31{((26U * 12U + 1U) * 31U + 30U) * 86400UL};
+  TEST_ASSERT_EQUAL_UINT8(
+      static_cast<uint8_t>(RV3032::Err::INVALID_DATETIME),
+      static_cast<uint8_t>(
+          RV3032::RV3032::unpackDateTime(feb31, untouched).code));
+  TEST_ASSERT_EQUAL_UINT16(2001, untouched.year);
+  TEST_ASSERT_FALSE(RV3032::RV3032::unpackDateTime(
+      RV3032::PackedDateTime{3214080000UL}, untouched).ok());
+  uint32_t unix = 7;
+  TEST_ASSERT_FALSE(RV3032::RV3032::packedToUnix(
+      RV3032::PackedDateTime{0xFFFFFFFFUL}, unix).ok());
+  TEST_ASSERT_EQUAL_UINT32(7, unix);
+
+  RV3032::PackedDateTime packed{123};
+  TEST_ASSERT_FALSE(RV3032::RV3032::packDateTime(
+      utcDate(2023, 2, 29, 0, 0, 0), packed).ok());
+  const uint8_t badBcd[7] = {0x5A, 0, 0, 0, 0x01, 0x01, 0x26};
+  TEST_ASSERT_FALSE(RV3032::RV3032::packCalendarBcd(badBcd, packed).ok());
+  TEST_ASSERT_EQUAL_UINT32(123, packed.value);
+}
+
+void test_telemetry_codec_round_trips_and_indexes_blocks() {
+  // Shared with tools/decode_telemetry.py --self-test.
+  static constexpr uint8_t kVector[] = {
+      'R', 'T', 1, 0, 4, 0, 23, 0, 0x00, 0xB9, 0x55, 0x69, 0, 0, 0x90, 0x01,
+      0xA0, 0x06, 0x00, 0x93, 0x03, 0x04, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0xFF, 0xFF, 0xFF, 0xFF};
+  RV3032::TelemetryRecord records[4]{};
+  for (uint8_t i = 0; i < 4; ++i) {
+    records[i].timestamp = 1767225600UL + i;
+    records[i].temperatureRaw = 400;
+  }
+  records[3].hundredths = 50;
+  records[3].statusRaw = 0x04;
+  records[3].temperatureRaw = 401;
+
+  uint8_t block[32];
+  RV3032::TelemetryBlockEncoder encoder;
+  TEST_ASSERT_TRUE(encoder.begin(block, sizeof(block)).ok());
+  for (const RV3032::TelemetryRecord& record : records) {
+    TEST_ASSERT_TRUE(encoder.append(record).ok());
+  }
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(kVector, block, sizeof(kVector));
+  TEST_ASSERT_EQUAL_UINT16(4, encoder.recordCount());
+
+  RV3032::TelemetryRecord decoded[4]{};
+  size_t count = 0;
+  TEST_ASSERT_TRUE(RV3032::decodeTelemetryBlock(block, sizeof(block), decoded,
+                                                4, count).ok());
+  TEST_ASSERT_EQUAL_UINT32(4, count);
+  for (uint8_t i = 0; i < 4; ++i) {
+    TEST_ASSERT_EQUAL_UINT32(records[i].timestamp, decoded[i].timestamp);
+    TEST_ASSERT_EQUAL_UINT8(records[i].hundredths, decoded[i].hundredths);
+    TEST_ASSERT_EQUAL_UINT8(records[i].statusRaw, decoded[i].statusRaw);
+    TEST_ASSERT_EQUAL_INT16(records[i].temperatureRaw, decoded[i].temperatureRaw);
+  }
+  TEST_ASSERT_FALSE(RV3032::decodeTelemetryBlock(block, sizeof(block), decoded,
+                                                 3, count).ok());
+
+  // Once the first delta is known, a steady 1 Hz stream costs one byte per
+  // record; the record that no longer fits leaves the block untouched.
+  RV3032::TelemetryRecord steady = records[0];
+  TEST_ASSERT_TRUE(encoder.begin(block, sizeof(block)).ok());
+  TEST_ASSERT_TRUE(encoder.append(steady).ok());
+  for (size_t i = RV3032::TELEMETRY_BLOCK_HEADER_SIZE + 1U; i < sizeof(block);
+       ++i) {
+    ++steady.timestamp;
+    TEST_ASSERT_TRUE(encoder.append(steady).ok());
+  }
+  uint8_t full[sizeof(block)];
+  memcpy(full, block, sizeof(block));
+  ++steady.timestamp;
+  TEST_ASSERT_EQUAL_UINT8(
+      static_cast<uint8_t>(RV3032::Err::QUEUE_FULL),
+      static_cast<uint8_t>(encoder.append(steady).code));
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(full, block, sizeof(block));
+  RV3032::TelemetryBlockInfo info{};
+  TEST_ASSERT_TRUE(RV3032::readTelemetryBlockInfo(block, sizeof(block), info).ok());
+  TEST_ASSERT_EQUAL_UINT16(16, info.recordCount);
+  TEST_ASSERT_EQUAL_UINT16(32, info.usedBytes);
+
+  RV3032::TelemetryBlockDecoder decoder;
+  TEST_ASSERT_TRUE(decoder.begin(block, sizeof(block)).ok());
+  RV3032::TelemetryRecord last{};
+  while (decoder.remaining() > 0) {
+    TEST_ASSERT_TRUE(decoder.next(last).ok());
+  }
+  TEST_ASSERT_EQUAL_UINT32(steady.timestamp - 1U, last.timestamp);
+  TEST_ASSERT_FALSE(decoder.next(last).ok());
+
+  // Out-of-range records and malformed blocks are rejected.
+  RV3032::TelemetryRecord bad = records[0];
+  bad.hundredths = 100;
+  TEST_ASSERT_EQUAL_UINT8(
+      static_cast<uint8_t>(RV3032::Err::INVALID_PARAM),
+      static_cast<uint8_t>(encoder.append(bad).code));
+  uint8_t corrupt[sizeof(kVector)];
+  memcpy(corrupt, kVector, sizeof(kVector));
+  corrupt[6] = 22;  // used length cuts the last entry short
+  TEST_ASSERT_FALSE(RV3032::decodeTelemetryBlock(corrupt, sizeof(corrupt),
+                                                 decoded, 4, count).ok());
+  corrupt[6] = 23;
+  corrupt[2] = 2;
+  TEST_ASSERT_FALSE(RV3032::readTelemetryBlockInfo(corrupt, sizeof(corrupt),
+                                                   info).ok());
+  // A temperature delta varint near 2^64 is rejected before it is summed.
+  uint8_t hugeDelta[32];
+  memcpy(hugeDelta, kVector, RV3032::TELEMETRY_BLOCK_HEADER_SIZE);
+  hugeDelta[4] = 2;
+  hugeDelta[6] = 27;
+  const uint8_t hugeEntry[] = {0x01, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF,
+                               0xFF, 0xFF, 0xFF, 0xFF, 0x01};
+  memcpy(hugeDelta + RV3032::TELEMETRY_BLOCK_HEADER_SIZE, hugeEntry,
+         sizeof(hugeEntry));
+  TEST_ASSERT_FALSE(RV3032::decodeTelemetryBlock(hugeDelta, sizeof(hugeDelta),
+                                                 decoded, 4, count).ok());
+  // 8191 is one past the largest legal delta; 2 (+1) still decodes.
+  hugeDelta[6] = 19;
+  hugeDelta[17] = 0xFF;
+  hugeDelta[18] = 0x3F;
+  TEST_ASSERT_FALSE(RV3032::decodeTelemetryBlock(hugeDelta, sizeof(hugeDelta),
+                                                 decoded, 4, count).ok());
+  hugeDelta[6] = 18;
+  hugeDelta[17] = 0x02;
+  TEST_ASSERT_TRUE(RV3032::decodeTelemetryBlock(hugeDelta, sizeof(hugeDelta),
+                                                decoded, 4, count).ok());
+  TEST_ASSERT_EQUAL_INT16(401, decoded[1].temperatureRaw);
+
+  // Records come straight from driver results.
+  RV3032::TelemetryFrame frame{};
+  frame.time = utcDate(2026, 1, 1, 0, 0, 3);
+  frame.hundredths = 50;
+  frame.statusRaw = 0x04;
+  frame.temperatureRaw = 401;
+  RV3032::TelemetryRecord fromFrame{};
+  TEST_ASSERT_FALSE(RV3032::makeTelemetryRecord(frame, fromFrame).ok());
+  frame.timeValid = true;
+  frame.hundredthsValid = true;
+  TEST_ASSERT_TRUE(RV3032::makeTelemetryRecord(frame, fromFrame).ok());
+  TEST_ASSERT_EQUAL_UINT32(records[3].timestamp, fromFrame.timestamp);
+  TEST_ASSERT_EQUAL_UINT8(50, fromFrame.hundredths);
+  TEST_ASSERT_EQUAL_INT16(401, fromFrame.temperatureRaw);
+
+  static constexpr uint32_t kFirst[] = {1000, 2000, 3000};
+  TEST_ASSERT_EQUAL_UINT32(0, RV3032::findTelemetryBlock(kFirst, 3, 999));
+  TEST_ASSERT_EQUAL_UINT32(0, RV3032::findTelemetryBlock(kFirst, 3, 1999));
+  TEST_ASSERT_EQUAL_UINT32(1, RV3032::findTelemetryBlock(kFirst, 3, 2000));
+  TEST_ASSERT_EQUAL_UINT32(2, RV3032::findTelemetryBlock(kFirst, 3, 99999));
+}
+
+void test_valid_date_time_overloads_match_checked_apis() {
+  const RV3032::ValidDateTime fallback;
+  assertDateTime(utcDate(2000, 1, 1, 0, 0, 0), fallback.value());
+
+  RV3032::ValidDateTime valid;
+  TEST_ASSERT_EQUAL_UINT8(
+      static_cast<uint8_t>(RV3032::Err::INVALID_DATETIME),
+      static_cast<uint8_t>(RV3032::RV3032::makeValidDateTime(
+          utcDate(2026, 2, 29, 0, 0, 0), valid).code));
+  assertDateTime(fallback.value(), valid.value());
+  RV3032::DateTime requested = utcDate(2026, 7, 13, 12, 34, 56);
+  requested.weekday = 1;
+  TEST_ASSERT_TRUE(RV3032::RV3032::makeValidDateTime(requested, valid).ok());
+
+  uint32_t checkedUnix = 0;
+  TEST_ASSERT_TRUE(RV3032::RV3032::dateTimeToUnix(requested, checkedUnix).ok());
+  TEST_ASSERT_EQUAL_UINT32(checkedUnix, RV3032::RV3032::dateTimeToUnix(valid));
+  RV3032::PackedDateTime checkedPacked{};
+  TEST_ASSERT_TRUE(RV3032::RV3032::packDateTime(requested, checkedPacked).ok());
+  TEST_ASSERT_TRUE(checkedPacked == RV3032::RV3032::packDateTime(valid));
+  RV3032::ValidDateTime converted;
+  TEST_ASSERT_TRUE(RV3032::RV3032::unixToDateTime(checkedUnix, converted).ok());
+  assertDateTime(requested, converted.value());
+  TEST_ASSERT_FALSE(
+      RV3032::RV3032::unixToDateTime(4102444800UL, converted).ok());
+  assertDateTime(requested, converted.value());
+
+  FakeRv3032 fake;
+  fake.direct[RV3032::cmd::REG_STATUS] = 0;
+  RV3032::RV3032 rtc;
+  TEST_ASSERT_TRUE(rtc.begin(fake.config()).ok());
+  TEST_ASSERT_TRUE(rtc.setTime(valid).ok());
+  TEST_ASSERT_EQUAL_HEX8(RV3032::cmd::REG_SECONDS,
+                         fake.log[fake.logCount - 1U].reg);
+  TEST_ASSERT_EQUAL_HEX8(0x56, fake.log[fake.logCount - 1U].data[0]);
+  TEST_ASSERT_EQUAL_HEX8(1, fake.log[fake.logCount - 1U].data[3]);
+  RV3032::ValidDateTime readBack;
+  TEST_ASSERT_TRUE(rtc.readTime(readBack).ok());
+  assertDateTime(requested, readBack.value());
+  TEST_ASSERT_EQUAL_UINT8(1, readBack.value().weekday);
+
+  TEST_ASSERT_TRUE(rtc.setAlarmTime(valid).inProgress());
+  TEST_ASSERT_TRUE(pollJobToCompletion(rtc, fake).ok());
+  RV3032::AlarmConfig alarm{};
+  TEST_ASSERT_TRUE(rtc.getAlarmConfig(alarm).ok());
+  TEST_ASSERT_EQUAL_UINT8(34, alarm.minute);
+  TEST_ASSERT_EQUAL_UINT8(12, alarm.hour);
+  TEST_ASSERT_EQUAL_UINT8(13, alarm.date);
+
+  TEST_ASSERT_TRUE(rtc.startSetTimeAndClearInvalidFlagsVerifiedJob(
+      valid, fake.nowMs, 250).inProgress());
+  TEST_ASSERT_TRUE(pollJobToCompletion(rtc, fake).ok());
+  RV3032::VerifiedTimeSetReport report{};
+  TEST_ASSERT_TRUE(
+      rtc.getSetTimeAndClearInvalidFlagsVerifiedJobResult(report).ok());
+  assertDateTime(requested, report.requested);
+  TEST_ASSERT_TRUE(report.verifiedValid);
+
+  // The checked overload still validates before touching the bus.
+  const uint32_t beforeInvalid = fake.callbackCount;
+  TEST_ASSERT_EQUAL_UINT8(
+      static_cast<uint8_t>(RV3032::Err::INVALID_DATETIME),
+      static_cast<uint8_t>(rtc.setTime(utcDate(2026, 2, 29, 0, 0, 0)).code));
+  TEST_ASSERT_EQUAL_UINT32(beforeInvalid, fake.callbackCount);
+}
+
+void test_time_zone_tables_convert_across_transitions() {
+  namespace tz = RV3032::tz;
+  RV3032::DateTime local{};
+  RV3032::DateTime utc{};
+
+  // Prague spring-forward at 01:00 UTC on the last Sunday of March.
+  TEST_ASSERT_TRUE(RV3032::RV3032::utcToLocal(
+      tz::EuropePrague, utcDate(2026, 3, 29, 0, 59, 59), local).ok());
+  assertDateTime(utcDate(2026, 3, 29, 1, 59, 59), local);
+  TEST_ASSERT_EQUAL_UINT8(0, local.weekday);
+  TEST_ASSERT_TRUE(RV3032::RV3032::utcToLocal(
+      tz::EuropePrague, utcDate(2026, 3, 29, 1, 0, 0), local).ok());
+  assertDateTime(utcDate(2026, 3, 29, 3, 0, 0), local);
+
+  // The skipped hour is rejected without touching the output.
+  utc = utcDate(2001, 1, 1, 0, 0, 0);
+  TEST_ASSERT_EQUAL_UINT8(
+      static_cast<uint8_t>(RV3032::Err::INVALID_DATETIME),
+      static_cast<uint8_t>(RV3032::RV3032::localToUtc(
+          tz::EuropePrague, utcDate(2026, 3, 29, 2, 30, 0), utc).code));
+  assertDateTime(utcDate(2001, 1, 1, 0, 0, 0), utc);
+
+  // The repeated autumn hour resolves by fold.
+  TEST_ASSERT_TRUE(RV3032::RV3032::localToUtc(
+      tz::EuropePrague, utcDate(2026, 10, 25, 2, 30, 0), utc).ok());
+  assertDateTime(utcDate(2026, 10, 25, 0, 30, 0), utc);
+  TEST_ASSERT_TRUE(RV3032::RV3032::localToUtc(
+      tz::EuropePrague, utcDate(2026, 10, 25, 2, 30, 0), utc,
+      RV3032::LocalTimeFold::LATER).ok());
+  assertDateTime(utcDate(2026, 10, 25, 1, 30, 0), utc);
+
+  // Rule changes inside the domain: US 2007 and Sydney 2008.
+  int16_t offset = 0;
+  uint32_t ts = 0;
+  TEST_ASSERT_TRUE(RV3032::RV3032::dateTimeToUnix(
+      utcDate(2006, 3, 20, 12, 0, 0), ts).ok());
+  TEST_ASSERT_TRUE(
+      RV3032::RV3032::utcOffsetMinutes(tz::AmericaNewYork, ts, offset).ok());
+  TEST_ASSERT_EQUAL_INT(-300, offset);
+  TEST_ASSERT_TRUE(RV3032::RV3032::dateTimeToUnix(
+      utcDate(2007, 3, 20, 12, 0, 0), ts).ok());
+  TEST_ASSERT_TRUE(
+      RV3032::RV3032::utcOffsetMinutes(tz::AmericaNewYork, ts, offset).ok());
+  TEST_ASSERT_EQUAL_INT(-240, offset);
+  TEST_ASSERT_TRUE(RV3032::RV3032::dateTimeToUnix(
+      utcDate(2008, 4, 1, 0, 0, 0), ts).ok());
+  TEST_ASSERT_TRUE(
+      RV3032::RV3032::utcOffsetMinutes(tz::AustraliaSydney, ts, offset).ok());
+  TEST_ASSERT_EQUAL_INT(660, offset);
+  TEST_ASSERT_TRUE(RV3032::RV3032::dateTimeToUnix(
+      utcDate(2008, 7, 1, 0, 0, 0), ts).ok());
+  TEST_ASSERT_TRUE(
+      RV3032::RV3032::utcOffsetMinutes(tz::AustraliaSydney, ts, offset).ok());
+  TEST_ASSERT_EQUAL_INT(600, offset);
+  TEST_ASSERT_TRUE(
+      RV3032::RV3032::utcOffsetMinutes(tz::Utc, ts, offset).ok());
+  TEST_ASSERT_EQUAL_INT(0, offset);
+
+  // Either fold round-trips every UTC instant, in both hemispheres.
+  const RV3032::TimeZone* zones[] = {&tz::EuropePrague, &tz::AustraliaSydney};
+  for (const RV3032::TimeZone* zone : zones) {
+    for (uint32_t t = 946684800UL + 86400UL; t < 4102444799UL - 86400UL;
+         t += 6UL * 3600UL + 1800UL) {
+      RV3032::DateTime source{};
+      TEST_ASSERT_TRUE(RV3032::RV3032::unixToDateTime(t, source).ok());
+      TEST_ASSERT_TRUE(RV3032::RV3032::utcToLocal(*zone, source, local).ok());
+      RV3032::DateTime early{};
+      RV3032::DateTime late{};
+      TEST_ASSERT_TRUE(RV3032::RV3032::localToUtc(*zone, local, early).ok());
+      TEST_ASSERT_TRUE(RV3032::RV3032::localToUtc(
+          *zone, local, late, RV3032::LocalTimeFold::LATER).ok());
+      uint32_t earlyTs = 0;
+      uint32_t lateTs = 0;
+      TEST_ASSERT_TRUE(RV3032::RV3032::dateTimeToUnix(early, earlyTs).ok());
+      TEST_ASSERT_TRUE(RV3032::RV3032::dateTimeToUnix(late, lateTs).ok());
+      TEST_ASSERT_TRUE(earlyTs == t || lateTs == t);
+    }
   }
+
+  // Domain edges and malformed tables.
+  TEST_ASSERT_EQUAL_UINT8(
+      static_cast<uint8_t>(RV3032::Err::INVALID_DATETIME),
+      static_cast<uint8_t>(RV3032::RV3032::utcToLocal(
+          tz::AsiaTokyo, utcDate(2099, 12, 31, 20, 0, 0), local).code));
+  TEST_ASSERT_EQUAL_UINT8(
+      static_cast<uint8_t>(RV3032::Err::INVALID_DATETIME),
+      static_cast<uint8_t>(RV3032::RV3032::localToUtc(
+          tz::AsiaTokyo, utcDate(2000, 1, 1, 8, 0, 0), utc).code));
+  const RV3032::TimeZone broken{"broken", nullptr, nullptr, 0};
+  TEST_ASSERT_EQUAL_UINT8(
+      static_cast<uint8_t>(RV3032::Err::INVALID_PARAM),
+      static_cast<uint8_t>(
+          RV3032::RV3032::utcOffsetMinutes(broken, ts, offset).code));
 }
 
 void test_public_unix_read_set_and_range_contract() {
@@ -3076,6 +4659,133 @@ void test_primary_cell_updates_exact_target_once() {
   TEST_ASSERT_FALSE(fake.unsafeAccessStateAtCommand);
 }
 
+void test_primary_cell_job_matches_synchronous_report_without_waits() {
+  const uint8_t persistentValues[] = {0x5F, 0x2C};
+  for (uint8_t persistentBefore : persistentValues) {
+    FakeRv3032 syncFake;
+    syncFake.persistent[0] = persistentBefore;
+    syncFake.resetFromPersistent();
+    syncFake.direct[RV3032::cmd::REG_CONTROL1] = 0x3B;
+    RV3032::RV3032 syncRtc;
+    TEST_ASSERT_TRUE(syncRtc.begin(syncFake.config()).ok());
+    RV3032::PrimaryCellConfigurationReport expected{};
+    TEST_ASSERT_TRUE(syncRtc.ensurePrimaryCellConfiguration(expected).ok());
+
+    FakeRv3032 fake;
+    fake.persistent[0] = persistentBefore;
+    fake.resetFromPersistent();
+    fake.direct[RV3032::cmd::REG_CONTROL1] = 0x3B;
+    RV3032::RV3032 rtc;
+    TEST_ASSERT_TRUE(rtc.begin(fake.config()).ok());
+    RV3032::PrimaryCellConfigurationReport report{};
+    TEST_ASSERT_EQUAL_UINT8(
+        static_cast<uint8_t>(RV3032::Err::JOB_RESULT_UNAVAILABLE),
+        static_cast<uint8_t>(
+            rtc.getEnsurePrimaryCellConfigurationJobResult(report).code));
+    TEST_ASSERT_TRUE(
+        rtc.startEnsurePrimaryCellConfigurationJob(fake.nowMs).inProgress());
+    TEST_ASSERT_EQUAL_UINT32(0, fake.callbackCount);
+    TEST_ASSERT_EQUAL_UINT8(
+        static_cast<uint8_t>(RV3032::Err::IN_PROGRESS),
+        static_cast<uint8_t>(
+            rtc.getEnsurePrimaryCellConfigurationJobResult(report).code));
+    TEST_ASSERT_TRUE(pollJobToCompletion(rtc, fake).ok());
+    TEST_ASSERT_TRUE(rtc.getEnsurePrimaryCellConfigurationJobResult(report).ok());
+
+    TEST_ASSERT_EQUAL_UINT32(0, fake.waitCount);
+    TEST_ASSERT_EQUAL_UINT8(static_cast<uint8_t>(expected.outcome),
+                            static_cast<uint8_t>(report.outcome));
+    TEST_ASSERT_EQUAL_UINT8(static_cast<uint8_t>(expected.failureStage),
+                            static_cast<uint8_t>(report.failureStage));
+    TEST_ASSERT_EQUAL_HEX8(expected.persistentBefore, report.persistentBefore);
+    TEST_ASSERT_EQUAL_HEX8(expected.persistentTarget, report.persistentTarget);
+    TEST_ASSERT_EQUAL_HEX8(expected.persistentAfter, report.persistentAfter);
+    TEST_ASSERT_EQUAL_HEX8(expected.activeAfter, report.activeAfter);
+    TEST_ASSERT_EQUAL_HEX8(expected.control1After, report.control1After);
+    TEST_ASSERT_EQUAL(expected.writeCommandAttempted, report.writeCommandAttempted);
+    TEST_ASSERT_EQUAL(expected.writeDurablyVerified, report.writeDurablyVerified);
+    TEST_ASSERT_EQUAL(expected.autoRefreshHeldDisabledForSafety,
+                      report.autoRefreshHeldDisabledForSafety);
+    assertPrimaryTargetEvidence(report, true, true);
+    TEST_ASSERT_TRUE(report.cleanupVerified);
+    TEST_ASSERT_EQUAL_HEX8(syncFake.persistent[0], fake.persistent[0]);
+    TEST_ASSERT_EQUAL_HEX8(syncFake.activeConfig[0], fake.activeConfig[0]);
+    TEST_ASSERT_EQUAL_HEX8(syncFake.direct[RV3032::cmd::REG_CONTROL1],
+                           fake.direct[RV3032::cmd::REG_CONTROL1]);
+    TEST_ASSERT_EQUAL_UINT16(syncFake.writeOneAttempts, fake.writeOneAttempts);
+    TEST_ASSERT_FALSE(fake.protocolViolation);
+    TEST_ASSERT_FALSE(fake.unsafeAccessStateAtCommand);
+
+    // The job and the blocking call share one lifecycle latch.
+    const uint32_t callbacks = fake.callbackCount;
+    TEST_ASSERT_EQUAL_UINT8(
+        static_cast<uint8_t>(RV3032::Err::PRIMARY_CELL_ALREADY_ATTEMPTED),
+        static_cast<uint8_t>(
+            rtc.startEnsurePrimaryCellConfigurationJob(fake.nowMs).code));
+    TEST_ASSERT_EQUAL_UINT8(
+        static_cast<uint8_t>(RV3032::Err::PRIMARY_CELL_ALREADY_ATTEMPTED),
+        static_cast<uint8_t>(rtc.ensurePrimaryCellConfiguration(report).code));
+    TEST_ASSERT_EQUAL_UINT8(
+        static_cast<uint8_t>(RV3032::Err::PRIMARY_CELL_ALREADY_ATTEMPTED),
+        static_cast<uint8_t>(
+            syncRtc.startEnsurePrimaryCellConfigurationJob(syncFake.nowMs).code));
+    TEST_ASSERT_EQUAL_UINT32(callbacks, fake.callbackCount);
+  }
+}
+
+void test_primary_cell_job_matches_synchronous_prepare_faults() {
+  // Read C1, write/verify EERD, ready check, read C0, write/verify safe C0.
+  const uint32_t prepareCallbacks = 7;
+  for (uint32_t ordinal = 1; ordinal <= prepareCallbacks; ++ordinal) {
+    FakeRv3032 syncFake;
+    syncFake.persistent[0] = 0x5F;
+    syncFake.resetFromPersistent();
+    syncFake.direct[RV3032::cmd::REG_CONTROL1] = 0x3B;
+    RV3032::RV3032 syncRtc;
+    TEST_ASSERT_TRUE(syncRtc.begin(syncFake.config()).ok());
+    syncFake.failOrdinal = ordinal;
+    RV3032::PrimaryCellConfigurationReport expected{};
+    const RV3032::Status syncStatus =
+        syncRtc.ensurePrimaryCellConfiguration(expected);
+
+    FakeRv3032 fake;
+    fake.persistent[0] = 0x5F;
+    fake.resetFromPersistent();
+    fake.direct[RV3032::cmd::REG_CONTROL1] = 0x3B;
+    RV3032::RV3032 rtc;
+    TEST_ASSERT_TRUE(rtc.begin(fake.config()).ok());
+    fake.failOrdinal = ordinal;
+    TEST_ASSERT_TRUE(
+        rtc.startEnsurePrimaryCellConfigurationJob(fake.nowMs).inProgress());
+    const RV3032::Status jobStatus = pollJobToCompletion(rtc, fake);
+    RV3032::PrimaryCellConfigurationReport report{};
+    (void)rtc.getEnsurePrimaryCellConfigurationJobResult(report);
+
+    TEST_ASSERT_FALSE(syncStatus.ok());
+    TEST_ASSERT_FALSE(jobStatus.ok());
+    TEST_ASSERT_EQUAL_UINT8(static_cast<uint8_t>(expected.outcome),
+                            static_cast<uint8_t>(report.outcome));
+    TEST_ASSERT_EQUAL_UINT8(static_cast<uint8_t>(expected.failureStage),
+                            static_cast<uint8_t>(report.failureStage));
+    TEST_ASSERT_EQUAL(expected.cleanupVerified, report.cleanupVerified);
+    TEST_ASSERT_EQUAL(expected.autoRefreshHeldDisabledForSafety,
+                      report.autoRefreshHeldDisabledForSafety);
+    TEST_ASSERT_EQUAL_HEX8(syncFake.activeConfig[0], fake.activeConfig[0]);
+    TEST_ASSERT_EQUAL_HEX8(syncFake.direct[RV3032::cmd::REG_CONTROL1],
+                           fake.direct[RV3032::cmd::REG_CONTROL1]);
+    TEST_ASSERT_EQUAL_HEX8(0x5F, fake.persistent[0]);
+    TEST_ASSERT_EQUAL_UINT16(0, fake.writeOneAttempts);
+    // Once EERD is held, only the primary-safe C0 may stay active.
+    if ((fake.direct[RV3032::cmd::REG_CONTROL1] &
+         RV3032::cmd::CONTROL1_EERD_MASK) != 0) {
+      TEST_ASSERT_EQUAL_HEX8(0x5F & RV3032::cmd::PMU_PRIMARY_PRESERVE_MASK,
+                             fake.activeConfig[0]);
+      TEST_ASSERT_TRUE(report.autoRefreshHeldDisabledForSafety);
+    }
+    TEST_ASSERT_FALSE(fake.protocolViolation);
+  }
+}
+
 void test_primary_cell_preserves_all_nclke_tcr_and_control1_bits() {
   const uint8_t control1Before = 0x3B;
   for (uint8_t nclke = 0; nclke < 2; ++nclke) {
@@ -3304,6 +5014,62 @@ void test_typed_controls_use_correct_vendor_bits() {
                         fake.direct[RV3032::cmd::REG_CONTROL2]);
 }
 
+void test_batch_read_cache_coalesces_control_reads_only() {
+  FakeRv3032 fake;
+  RV3032::RV3032 rtc;
+  TEST_ASSERT_EQUAL_UINT8(static_cast<uint8_t>(RV3032::Err::NOT_INITIALIZED),
+                          static_cast<uint8_t>(rtc.beginBatch().code));
+  TEST_ASSERT_TRUE(rtc.begin(fake.config()).ok());
+  fake.direct[RV3032::cmd::REG_CONTROL2] = 0x18;
+
+  bool alarm = false;
+  bool timer = false;
+  bool clock = true;
+  uint32_t before = fake.callbackCount;
+  TEST_ASSERT_TRUE(rtc.getAlarmInterruptEnabled(alarm).ok());
+  TEST_ASSERT_TRUE(rtc.getTimerInterruptEnabled(timer).ok());
+  TEST_ASSERT_EQUAL_UINT32(before + 2U, fake.callbackCount);
+
+  TEST_ASSERT_TRUE(rtc.beginBatch().ok());
+  before = fake.callbackCount;
+  TEST_ASSERT_TRUE(rtc.getAlarmInterruptEnabled(alarm).ok());
+  TEST_ASSERT_TRUE(rtc.getTimerInterruptEnabled(timer).ok());
+  TEST_ASSERT_TRUE(rtc.getClockInterruptEnabled(clock).ok());
+  TEST_ASSERT_EQUAL_UINT32(before + 1U, fake.callbackCount);
+  TEST_ASSERT_TRUE(alarm);
+  TEST_ASSERT_TRUE(timer);
+  TEST_ASSERT_FALSE(clock);
+
+  // Status is volatile: every read reaches the device.
+  bool flag = false;
+  fake.direct[RV3032::cmd::REG_STATUS] = 0x08;
+  TEST_ASSERT_TRUE(rtc.getAlarmFlag(flag).ok());
+  TEST_ASSERT_TRUE(rtc.getAlarmFlag(flag).ok());
+  TEST_ASSERT_EQUAL_UINT32(before + 3U, fake.callbackCount);
+  TEST_ASSERT_TRUE(flag);
+
+  // A failed read fills nothing.
+  uint8_t value = 0;
+  fake.failOrdinal = fake.callbackCount + 1U;
+  TEST_ASSERT_FALSE(rtc.readRegister(RV3032::cmd::REG_CONTROL3, value).ok());
+  TEST_ASSERT_TRUE(rtc.readRegister(RV3032::cmd::REG_CONTROL3, value).ok());
+  TEST_ASSERT_TRUE(rtc.readRegister(RV3032::cmd::REG_CONTROL3, value).ok());
+  TEST_ASSERT_EQUAL_UINT32(before + 5U, fake.callbackCount);
+
+  // Driver writes drop the cache so the next read observes the new value.
+  TEST_ASSERT_TRUE(rtc.setClockInterruptEnabled(true).inProgress());
+  TEST_ASSERT_TRUE(pollJobToCompletion(rtc, fake).ok());
+  before = fake.callbackCount;
+  TEST_ASSERT_TRUE(rtc.getClockInterruptEnabled(clock).ok());
+  TEST_ASSERT_TRUE(rtc.getAlarmInterruptEnabled(alarm).ok());
+  TEST_ASSERT_EQUAL_UINT32(before + 1U, fake.callbackCount);
+  TEST_ASSERT_TRUE(clock);
+
+  rtc.endBatch();
+  TEST_ASSERT_TRUE(rtc.getAlarmInterruptEnabled(alarm).ok());
+  TEST_ASSERT_EQUAL_UINT32(before + 2U, fake.callbackCount);
+}
+
 void test_control_setters_and_flag_clears_are_cooperative() {
   FakeRv3032 fake;
   RV3032::RV3032 rtc;
@@ -4300,6 +6066,63 @@ void test_alarm_timer_and_pmu_round_trips_are_cooperative() {
   TEST_ASSERT_EQUAL_UINT32(beforeInvalidEnums, fake.callbackCount);
 }
 
+void test_timer_remaining_is_one_burst_and_exact_per_source() {
+  FakeRv3032 fake;
+  RV3032::RV3032 rtc;
+  TEST_ASSERT_TRUE(rtc.begin(fake.config()).ok());
+  const uint8_t te = static_cast<uint8_t>(1u << RV3032::cmd::CTRL1_TE_BIT);
+  fake.direct[RV3032::cmd::REG_TIMER_LOW] = 60;
+  fake.direct[RV3032::cmd::REG_TIMER_HIGH] = 0;
+  fake.direct[RV3032::cmd::REG_CONTROL1] = static_cast<uint8_t>(te | 0x02);
+  fake.direct[RV3032::cmd::REG_STATUS] =
+      static_cast<uint8_t>(1u << RV3032::cmd::STATUS_TF_BIT);
+
+  RV3032::TimerRemaining remaining{};
+  uint32_t before = fake.callbackCount;
+  TEST_ASSERT_TRUE(rtc.readTimerRemaining(11500, 10000, remaining).ok());
+  TEST_ASSERT_EQUAL_UINT32(before + 1U, fake.callbackCount);
+  TEST_ASSERT_EQUAL_UINT16(60, remaining.ticks);
+  TEST_ASSERT_EQUAL_UINT8(static_cast<uint8_t>(RV3032::TimerFrequency::Hz1),
+                          static_cast<uint8_t>(remaining.frequency));
+  TEST_ASSERT_TRUE(remaining.enabled);
+  TEST_ASSERT_TRUE(remaining.flagSet);
+  TEST_ASSERT_EQUAL_UINT32(60000, remaining.periodMs);
+  TEST_ASSERT_EQUAL_UINT32(58500, remaining.remainingMs);
+  TEST_ASSERT_EQUAL_UINT32(1000, remaining.uncertaintyMs);
+  TEST_ASSERT_TRUE(rtc.readTimerRemaining(0x100, 0xFFFFFF00u, remaining).ok());
+  TEST_ASSERT_EQUAL_UINT32(59488, remaining.remainingMs);
+
+  // 4095 ticks at 4096 Hz is 999.76 ms; phase stays exact across periods.
+  fake.direct[RV3032::cmd::REG_TIMER_LOW] = 0xFF;
+  fake.direct[RV3032::cmd::REG_TIMER_HIGH] = 0x0F;
+  fake.direct[RV3032::cmd::REG_CONTROL1] = te;
+  fake.direct[RV3032::cmd::REG_STATUS] = 0;
+  TEST_ASSERT_TRUE(rtc.readTimerRemaining(2500, 0, remaining).ok());
+  TEST_ASSERT_FALSE(remaining.flagSet);
+  TEST_ASSERT_EQUAL_UINT32(1000, remaining.periodMs);
+  TEST_ASSERT_EQUAL_UINT32(500, remaining.remainingMs);
+  TEST_ASSERT_EQUAL_UINT32(1, remaining.uncertaintyMs);
+
+  fake.direct[RV3032::cmd::REG_CONTROL1] = static_cast<uint8_t>(te | 0x03);
+  TEST_ASSERT_TRUE(rtc.readTimerRemaining(0, 0, remaining).ok());
+  TEST_ASSERT_EQUAL_UINT32(245700000UL, remaining.periodMs);
+  TEST_ASSERT_EQUAL_UINT32(245700000UL, remaining.remainingMs);
+  TEST_ASSERT_EQUAL_UINT32(60000, remaining.uncertaintyMs);
+
+  fake.direct[RV3032::cmd::REG_CONTROL1] = 0x01;
+  TEST_ASSERT_TRUE(rtc.readTimerRemaining(5, 0, remaining).ok());
+  TEST_ASSERT_FALSE(remaining.enabled);
+  TEST_ASSERT_EQUAL_UINT32(0, remaining.remainingMs);
+  TEST_ASSERT_EQUAL_UINT32(63985, remaining.periodMs);
+
+  fake.direct[RV3032::cmd::REG_TIMER_HIGH] = 0x10;
+  const RV3032::TimerRemaining untouched = remaining;
+  TEST_ASSERT_EQUAL_UINT8(
+      static_cast<uint8_t>(RV3032::Err::INVALID_PARAM),
+      static_cast<uint8_t>(rtc.readTimerRemaining(5, 0, remaining).code));
+  TEST_ASSERT_EQUAL_UINT32(untouched.periodMs, remaining.periodMs);
+}
+
 void test_clkout_factory_defaults_and_persistence_contract() {
   TEST_ASSERT_EQUAL_HEX8(0, RV3032::cmd::PMU_DEFAULT_ON_DELIVERY);
   TEST_ASSERT_EQUAL_HEX8(0, RV3032::cmd::CLKOUT1_DEFAULT_ON_DELIVERY);
@@ -4688,6 +6511,189 @@ void test_clkout_offset_temperature_and_event_round_trips() {
           static_cast<RV3032::EviDebounce>(4)).code));
 }
 
+void test_integer_offset_and_temperature_match_float_apis() {
+  FakeRv3032 fake;
+  fake.direct[RV3032::cmd::REG_STATUS] = 0x00;
+  RV3032::RV3032 rtc;
+  TEST_ASSERT_TRUE(rtc.begin(fake.config()).ok());
+
+  for (int32_t ppb = RV3032::RV3032::OFFSET_PPB_MIN;
+       ppb <= RV3032::RV3032::OFFSET_PPB_MAX; ++ppb) {
+    const long expected = lround(static_cast<double>(ppb) * 8192.0 / 1953125.0);
+    const RV3032::Status integer = rtc.setOffsetPpb(ppb);
+    if (!integer.ok()) {
+      TEST_ASSERT_TRUE(integer.inProgress());
+      TEST_ASSERT_TRUE(pollJobToCompletion(rtc, fake).ok());
+    }
+    const uint8_t fromPpb = fake.activeConfig[1] & RV3032::cmd::OFFSET_VALUE_MASK;
+    TEST_ASSERT_EQUAL_HEX8(static_cast<uint8_t>(expected) &
+                               RV3032::cmd::OFFSET_VALUE_MASK, fromPpb);
+    fake.activeConfig[1] = static_cast<uint8_t>(
+        (fake.activeConfig[1] & ~RV3032::cmd::OFFSET_VALUE_MASK) |
+        ((fromPpb + 1U) & RV3032::cmd::OFFSET_VALUE_MASK));
+  }
+  // Steps written by the pre-ppb float path, lrintf(ppm / step), including
+  // exact half steps, which round to the even step.
+  struct PpmVector {
+    float ppm;
+    int8_t steps;
+  };
+  const PpmVector ppmVectors[] = {
+      {0.0f, 0},
+      {0.11920928955078125f, 0},    // 0.5 step
+      {-0.11920928955078125f, 0},   // -0.5 step
+      {0.35762786865234375f, 2},    // 1.5 steps
+      {-0.35762786865234375f, -2},  // -1.5 steps
+      {0.59604644775390625f, 2},    // 2.5 steps
+      {0.83446502685546875f, 4},    // 3.5 steps; ppb first would give 3
+      {3.6954879760742188f, 16},    // 15.5 steps; ppb first would give 15
+      {0.1192f, 0},
+      {0.11921f, 1},
+      {0.2384f, 1},
+      {1.2f, 5},
+      {-1.2f, -5},
+      {7.3909759521484375f, 31},
+      {7.3915f, 31},
+      {-7.62939453125f, -32},
+      {-7.6295f, -32},
+  };
+  for (const PpmVector& v : ppmVectors) {
+    // Start from another step so every vector must write.
+    fake.activeConfig[1] = static_cast<uint8_t>(
+        (fake.activeConfig[1] & ~RV3032::cmd::OFFSET_VALUE_MASK) |
+        (static_cast<uint8_t>(v.steps + 1) & RV3032::cmd::OFFSET_VALUE_MASK));
+    TEST_ASSERT_TRUE(rtc.setOffsetPpm(v.ppm).inProgress());
+    TEST_ASSERT_TRUE(pollJobToCompletion(rtc, fake).ok());
+    TEST_ASSERT_EQUAL_HEX8(
+        static_cast<uint8_t>(v.steps) & RV3032::cmd::OFFSET_VALUE_MASK,
+        fake.activeConfig[1] & RV3032::cmd::OFFSET_VALUE_MASK);
+  }
+  TEST_ASSERT_EQUAL_UINT8(static_cast<uint8_t>(RV3032::Err::INVALID_PARAM),
+      static_cast<uint8_t>(
+          rtc.setOffsetPpb(RV3032::RV3032::OFFSET_PPB_MIN - 1).code));
+  TEST_ASSERT_EQUAL_UINT8(static_cast<uint8_t>(RV3032::Err::INVALID_PARAM),
+      static_cast<uint8_t>(
+          rtc.setOffsetPpb(RV3032::RV3032::OFFSET_PPB_MAX + 1).code));
+
+  for (int steps = -32; steps <= 31; ++steps) {
+    fake.activeConfig[1] = static_cast<uint8_t>(
+        (fake.activeConfig[1] & ~RV3032::cmd::OFFSET_VALUE_MASK) |
+        (static_cast<uint8_t>(steps) & RV3032::cmd::OFFSET_VALUE_MASK));
+    int32_t ppb = 0;
+    float ppm = 0.0f;
+    TEST_ASSERT_TRUE(rtc.getOffsetPpb(ppb).ok());
+    TEST_ASSERT_TRUE(rtc.getOffsetPpm(ppm).ok());
+    TEST_ASSERT_EQUAL_INT32(lround(steps * 1953125.0 / 8192.0), ppb);
+    TEST_ASSERT_EQUAL_INT32(lrintf(ppm * 1000.0f), ppb);
+  }
+
+  for (int raw = -2048; raw <= 2047; raw += 7) {
+    const uint16_t bits = static_cast<uint16_t>(raw) & 0x0FFFu;
+    fake.direct[RV3032::cmd::REG_TEMP_MSB] = static_cast<uint8_t>(bits >> 4);
+    fake.direct[RV3032::cmd::REG_TEMP_LSB] =
+        static_cast<uint8_t>((bits & 0x0Fu) << 4);
+    int16_t sixteenths = 0;
+    float celsius = 0.0f;
+    TEST_ASSERT_TRUE(rtc.readTemperatureSixteenths(sixteenths).ok());
+    TEST_ASSERT_TRUE(rtc.readTemperatureC(celsius).ok());
+    TEST_ASSERT_EQUAL_INT(raw, sixteenths);
+    TEST_ASSERT_TRUE(static_cast<float>(raw) / 16.0f == celsius);
+  }
+}
+
+void test_fake_device_model_advances_virtual_time() {
+  FakeRv3032 fake;
+  RV3032::RV3032 rtc;
+  TEST_ASSERT_TRUE(rtc.begin(fake.config()).ok());
+  fake.setCalendar(2024, 2, 28, 23, 59, 58, 2);
+
+  fake.advanceDeviceTime(2500);
+  RV3032::DateTime now{};
+  uint8_t hundredths = 0;
+  TEST_ASSERT_TRUE(rtc.readTime(now).ok());
+  TEST_ASSERT_TRUE(rtc.readHundredths(hundredths).ok());
+  TEST_ASSERT_EQUAL_UINT8(29, now.day);
+  TEST_ASSERT_EQUAL_UINT8(0, now.hour);
+  TEST_ASSERT_EQUAL_UINT8(3, now.weekday);
+  TEST_ASSERT_EQUAL_UINT8(50, hundredths);
+  TEST_ASSERT_EQUAL_UINT32(2, fake.updateEvents);
+  TEST_ASSERT_BITS_HIGH(1u << RV3032::cmd::STATUS_UF_BIT,
+                        fake.direct[RV3032::cmd::REG_STATUS]);
+  TEST_ASSERT_FALSE(fake.intAsserted);
+
+  // Driver-configured timer and daily 07:30 alarm; device time is frozen
+  // while the jobs run.
+  TEST_ASSERT_TRUE(rtc.setTimer(10, RV3032::TimerFrequency::Hz1,
+                                true).inProgress());
+  TEST_ASSERT_TRUE(pollJobToCompletion(rtc, fake).ok());
+  TEST_ASSERT_TRUE(rtc.setAlarmTime(30, 7, 0).inProgress());
+  TEST_ASSERT_TRUE(pollJobToCompletion(rtc, fake).ok());
+  TEST_ASSERT_TRUE(rtc.setAlarmMatch(true, true, false).inProgress());
+  TEST_ASSERT_TRUE(pollJobToCompletion(rtc, fake).ok());
+  fake.eviPeriodMs = 3600000;
+  fake.direct[RV3032::cmd::REG_THIGH_THRESHOLD] = 40;
+  fake.direct[RV3032::cmd::REG_CONTROL3] =
+      1u << RV3032::cmd::CTRL3_THE_BIT;
+  fake.addTemperaturePoint(fake.deviceElapsedMs, 25 * 16);
+  fake.addTemperaturePoint(fake.deviceElapsedMs + 86400000ULL, 45 * 16);
+
+  const uint32_t hostBefore = fake.nowMs;
+  fake.advanceDeviceTime(3U * 86400000U);
+  TEST_ASSERT_EQUAL_UINT32(hostBefore + 3U * 86400000U, fake.nowMs);
+  TEST_ASSERT_TRUE(rtc.readTime(now).ok());
+  TEST_ASSERT_EQUAL_UINT8(3, now.month);
+  TEST_ASSERT_EQUAL_UINT8(3, now.day);
+  TEST_ASSERT_EQUAL_UINT8(6, now.weekday);
+  TEST_ASSERT_EQUAL_UINT32(25920, fake.timerEvents);
+  TEST_ASSERT_EQUAL_UINT32(3, fake.alarmEvents);
+  bool flag = false;
+  TEST_ASSERT_TRUE(rtc.getTimerFlag(flag).ok());
+  TEST_ASSERT_TRUE(flag);
+  TEST_ASSERT_TRUE(rtc.getAlarmFlag(flag).ok());
+  TEST_ASSERT_TRUE(flag);
+
+  RV3032::Timestamp evi{};
+  TEST_ASSERT_TRUE(rtc.readTimestamp(RV3032::TimestampSource::Evi, evi).ok());
+  TEST_ASSERT_EQUAL_UINT8(72, evi.count);
+  TEST_ASSERT_EQUAL_UINT8(29, evi.time.day);
+  TEST_ASSERT_EQUAL_UINT8(59, evi.time.minute);
+  TEST_ASSERT_EQUAL_UINT8(58, evi.time.second);
+  TEST_ASSERT_EQUAL_UINT8(0, evi.hundredths);
+
+  int16_t sixteenths = 0;
+  TEST_ASSERT_TRUE(rtc.readTemperatureSixteenths(sixteenths).ok());
+  TEST_ASSERT_EQUAL_INT16(45 * 16, sixteenths);
+  RV3032::Timestamp high{};
+  TEST_ASSERT_TRUE(rtc.readTimestamp(RV3032::TimestampSource::THigh,
+                                     high).ok());
+  TEST_ASSERT_EQUAL_UINT8(1, high.count);
+  TEST_ASSERT_EQUAL_UINT8(29, high.time.day);
+  TEST_ASSERT_BITS_HIGH(1u << RV3032::cmd::STATUS_THF_BIT,
+                        fake.direct[RV3032::cmd::REG_STATUS]);
+
+  // 4096 Hz ticks are batched, not stepped.
+  TEST_ASSERT_TRUE(rtc.setTimer(4095, RV3032::TimerFrequency::Hz4096,
+                                true).inProgress());
+  TEST_ASSERT_TRUE(pollJobToCompletion(rtc, fake).ok());
+  fake.timerEvents = 0;
+  fake.advanceDeviceTime(60000);
+  TEST_ASSERT_TRUE(fake.timerEvents >= 59 && fake.timerEvents <= 60);
+
+  // Century and leap-year rollover.
+  fake.setCalendar(2099, 12, 31, 23, 59, 59, 0);
+  fake.advanceDeviceTime(1000);
+  for (int day = 0; day < 59; ++day) fake.advanceDeviceTime(86400000);
+  TEST_ASSERT_TRUE(rtc.readTime(now).ok());
+  TEST_ASSERT_EQUAL_UINT16(2000, now.year);
+  TEST_ASSERT_EQUAL_UINT8(2, now.month);
+  TEST_ASSERT_EQUAL_UINT8(29, now.day);
+  fake.setCalendar(2023, 2, 28, 23, 59, 59, 0);
+  fake.advanceDeviceTime(1000);
+  TEST_ASSERT_TRUE(rtc.readTime(now).ok());
+  TEST_ASSERT_EQUAL_UINT8(3, now.month);
+  TEST_ASSERT_EQUAL_UINT8(1, now.day);
+}
+
 void test_timestamp_stop_gp_and_ram_public_coverage() {
   FakeRv3032 fake;
   RV3032::RV3032 rtc;
@@ -4736,9 +6742,7 @@ void test_timestamp_stop_gp_and_ram_public_coverage() {
   TEST_ASSERT_TRUE(rtc.resetTimestamp(
       RV3032::TimestampSource::Evi).inProgress());
   uint8_t resetInstructions = 0;
-  TEST_ASSERT_TRUE(rtc.pollJob(fake.nowMs, 1,
-                              resetInstructions).inProgress());
-  TEST_ASSERT_EQUAL_UINT8(1, resetInstructions);
+  // The CONTROL2 EIE guard and TS_CONTROL arrive in one fused burst.
   TEST_ASSERT_TRUE(rtc.pollJob(fake.nowMs, 1,
                               resetInstructions).inProgress());
   TEST_ASSERT_EQUAL_UINT8(1, resetInstructions);
@@ -4835,6 +6839,192 @@ void test_timestamp_stop_gp_and_ram_public_coverage() {
   TEST_ASSERT_EQUAL_UINT32(beforeRange, fake.callbackCount);
 }
 
+void test_telemetry_frame_decodes_one_burst_with_independent_fields() {
+  FakeRv3032 fake;
+  fake.setCalendar(2026, 7, 13, 12, 34, 56, 1);
+  fake.direct[RV3032::cmd::REG_100TH_SECONDS] = FakeRv3032::bcd(42);
+  fake.direct[RV3032::cmd::REG_ALARM_MINUTE] = FakeRv3032::bcd(30);
+  fake.direct[RV3032::cmd::REG_ALARM_HOUR] =
+      static_cast<uint8_t>(0x80u | FakeRv3032::bcd(7));
+  fake.direct[RV3032::cmd::REG_ALARM_DATE] = 0x80;
+  fake.direct[RV3032::cmd::REG_TIMER_LOW] = 0x34;
+  fake.direct[RV3032::cmd::REG_TIMER_HIGH] = 0x02;
+  fake.direct[RV3032::cmd::REG_STATUS] = static_cast<uint8_t>(
+      (1u << RV3032::cmd::STATUS_TF_BIT) |
+      (1u << RV3032::cmd::STATUS_VLF_BIT));
+  fake.direct[RV3032::cmd::REG_TEMP_LSB] =
+      static_cast<uint8_t>(0x80u | RV3032::cmd::TEMP_BSF_MASK);
+  fake.direct[RV3032::cmd::REG_TEMP_MSB] = 0x19;
+  RV3032::RV3032 rtc;
+  TEST_ASSERT_TRUE(rtc.begin(fake.config()).ok());
+
+  RV3032::TelemetryFrame frame{};
+  TEST_ASSERT_TRUE(rtc.readTelemetryFrame(frame).ok());
+  TEST_ASSERT_EQUAL_UINT32(1, fake.callbackCount);
+  TEST_ASSERT_EQUAL_HEX8(RV3032::cmd::REG_100TH_SECONDS, fake.log[0].reg);
+  TEST_ASSERT_EQUAL_UINT8(16, fake.log[0].length);
+  TEST_ASSERT_TRUE(frame.timeValid);
+  TEST_ASSERT_EQUAL_UINT8(56, frame.time.second);
+  TEST_ASSERT_EQUAL_UINT8(34, frame.time.minute);
+  TEST_ASSERT_EQUAL_UINT16(2026, frame.time.year);
+  TEST_ASSERT_TRUE(frame.hundredthsValid);
+  TEST_ASSERT_EQUAL_UINT8(42, frame.hundredths);
+  TEST_ASSERT_TRUE(frame.alarmValid);
+  TEST_ASSERT_TRUE(frame.alarm.matchMinute);
+  TEST_ASSERT_FALSE(frame.alarm.matchHour);
+  TEST_ASSERT_EQUAL_UINT8(30, frame.alarm.minute);
+  TEST_ASSERT_TRUE(frame.timerValid);
+  TEST_ASSERT_EQUAL_UINT16(0x234, frame.timerTicks);
+  TEST_ASSERT_TRUE(frame.statusValid);
+  TEST_ASSERT_TRUE(frame.statusFlags.timer);
+  TEST_ASSERT_TRUE(frame.statusFlags.voltageLow);
+  TEST_ASSERT_FALSE(frame.statusFlags.alarm);
+  TEST_ASSERT_EQUAL_HEX8(fake.direct[RV3032::cmd::REG_TEMP_LSB],
+                         frame.tempLsbRaw);
+  TEST_ASSERT_EQUAL_INT(25 * 16 + 8, frame.temperatureRaw);
+  TEST_ASSERT_EQUAL_FLOAT(25.5f, frame.temperatureC);
+  TEST_ASSERT_EQUAL_HEX8(static_cast<uint8_t>(
+      (1u << RV3032::cmd::STATUS_TF_BIT) |
+      (1u << RV3032::cmd::STATUS_VLF_BIT)),
+      fake.direct[RV3032::cmd::REG_STATUS]);
+
+  // Malformed hundredths, calendar, and timer bytes void only themselves.
+  fake.direct[RV3032::cmd::REG_100TH_SECONDS] = 0x9A;
+  fake.direct[RV3032::cmd::REG_SECONDS] = 0x7A;
+  fake.direct[RV3032::cmd::REG_TIMER_HIGH] = 0x12;
+  uint32_t before = fake.callbackCount;
+  TEST_ASSERT_TRUE(rtc.startReadTelemetryFrameJob(fake.nowMs).inProgress());
+  TEST_ASSERT_EQUAL_UINT32(before, fake.callbackCount);
+  TEST_ASSERT_TRUE(pollJobToCompletion(rtc, fake).ok());
+  TEST_ASSERT_EQUAL_UINT32(before + 1U, fake.callbackCount);
+  frame = RV3032::TelemetryFrame{};
+  TEST_ASSERT_TRUE(rtc.getReadTelemetryFrameJobResult(frame).ok());
+  TEST_ASSERT_FALSE(frame.timeValid);
+  TEST_ASSERT_FALSE(frame.hundredthsValid);
+  TEST_ASSERT_FALSE(frame.timerValid);
+  TEST_ASSERT_TRUE(frame.alarmValid);
+  TEST_ASSERT_TRUE(frame.statusValid);
+  TEST_ASSERT_EQUAL_UINT8(30, frame.alarm.minute);
+  TEST_ASSERT_EQUAL_FLOAT(25.5f, frame.temperatureC);
+
+  // Transport failure leaves the caller's frame untouched.
+  fake.failOrdinal = fake.callbackCount + 1U;
+  frame.statusRaw = 0xA5;
+  TEST_ASSERT_FALSE(rtc.readTelemetryFrame(frame).ok());
+  TEST_ASSERT_EQUAL_HEX8(0xA5, frame.statusRaw);
+
+  RV3032::WakeReasonReport wrongKind{};
+  TEST_ASSERT_EQUAL_UINT8(
+      static_cast<uint8_t>(RV3032::Err::JOB_RESULT_UNAVAILABLE),
+      static_cast<uint8_t>(rtc.getReadWakeReasonJobResult(wrongKind).code));
+}
+
+void test_wake_reason_job_decodes_one_burst_and_acknowledges_observed_flags() {
+  FakeRv3032 fake;
+  RV3032::RV3032 rtc;
+  TEST_ASSERT_TRUE(rtc.begin(fake.config()).ok());
+  RV3032::WakeReasonReport report{};
+  TEST_ASSERT_EQUAL_UINT8(
+      static_cast<uint8_t>(RV3032::Err::JOB_RESULT_UNAVAILABLE),
+      static_cast<uint8_t>(rtc.getReadWakeReasonJobResult(report).code));
+  uint32_t before = fake.callbackCount;
+  TEST_ASSERT_EQUAL_UINT8(
+      static_cast<uint8_t>(RV3032::Err::INVALID_PARAM),
+      static_cast<uint8_t>(rtc.startReadWakeReasonJob(
+          true, fake.nowMs, 1).code));
+  TEST_ASSERT_EQUAL_UINT32(before, fake.callbackCount);
+
+  fake.direct[RV3032::cmd::REG_STATUS] = static_cast<uint8_t>(
+      (1u << RV3032::cmd::STATUS_AF_BIT) |
+      (1u << RV3032::cmd::STATUS_EVF_BIT) |
+      (1u << RV3032::cmd::STATUS_PORF_BIT));
+  fake.direct[RV3032::cmd::REG_TEMP_LSB] =
+      static_cast<uint8_t>(0x50u | RV3032::cmd::TEMP_BSF_MASK);
+  fake.direct[RV3032::cmd::REG_CONTROL2] = static_cast<uint8_t>(
+      (1u << RV3032::cmd::CTRL2_AIE_BIT) | (1u << RV3032::cmd::CTRL2_EIE_BIT));
+  fake.direct[RV3032::cmd::REG_CONTROL3] =
+      static_cast<uint8_t>(1u << RV3032::cmd::CTRL3_BSIE_BIT);
+  uint8_t* timestamp = &fake.direct[RV3032::cmd::REG_TS_EVI_COUNT];
+  timestamp[0] = 2;
+  timestamp[1] = FakeRv3032::bcd(5);
+  timestamp[2] = FakeRv3032::bcd(6);
+  timestamp[3] = FakeRv3032::bcd(7);
+  timestamp[4] = FakeRv3032::bcd(8);
+  timestamp[5] = FakeRv3032::bcd(9);
+  timestamp[6] = FakeRv3032::bcd(10);
+  timestamp[7] = FakeRv3032::bcd(26);
+  const uint16_t expected = static_cast<uint16_t>(
+      static_cast<uint16_t>(RV3032::WakeReason::ALARM) |
+      static_cast<uint16_t>(RV3032::WakeReason::EVENT) |
+      static_cast<uint16_t>(RV3032::WakeReason::BACKUP_SWITCH) |
+      static_cast<uint16_t>(RV3032::WakeReason::POWER_ON_RESET));
+
+  before = fake.callbackCount;
+  TEST_ASSERT_TRUE(rtc.startReadWakeReasonJob(false, fake.nowMs).inProgress());
+  TEST_ASSERT_EQUAL_UINT32(before, fake.callbackCount);
+  TEST_ASSERT_TRUE(pollJobToCompletion(rtc, fake).ok());
+  TEST_ASSERT_EQUAL_UINT32(before + 1U, fake.callbackCount);
+  TEST_ASSERT_TRUE(rtc.getReadWakeReasonJobResult(report).ok());
+  TEST_ASSERT_TRUE(report.flagsValid);
+  TEST_ASSERT_EQUAL_HEX16(expected, report.reasons);
+  TEST_ASSERT_EQUAL_HEX16(
+      static_cast<uint16_t>(RV3032::WakeReason::ALARM) |
+          static_cast<uint16_t>(RV3032::WakeReason::EVENT) |
+          static_cast<uint16_t>(RV3032::WakeReason::BACKUP_SWITCH),
+      report.interruptEnabled);
+  TEST_ASSERT_EQUAL_HEX16(0, report.acknowledged);
+  TEST_ASSERT_TRUE(report.statusFlags.powerOnReset);
+  TEST_ASSERT_TRUE(report.eventTimestamp.timeValid);
+  TEST_ASSERT_EQUAL_UINT8(2, report.eventTimestamp.count);
+  TEST_ASSERT_EQUAL_UINT8(5, report.eventTimestamp.hundredths);
+  TEST_ASSERT_EQUAL_UINT8(10, report.eventTimestamp.time.month);
+  TEST_ASSERT_FALSE(report.tempLowTimestamp.timeValid);
+  TEST_ASSERT_EQUAL_HEX8(0x0E, fake.direct[RV3032::cmd::REG_STATUS]);
+
+  before = fake.callbackCount;
+  TEST_ASSERT_TRUE(rtc.startReadWakeReasonJob(true, fake.nowMs).inProgress());
+  TEST_ASSERT_TRUE(pollJobToCompletion(rtc, fake).ok());
+  TEST_ASSERT_EQUAL_UINT32(before + 3U, fake.callbackCount);
+  TEST_ASSERT_TRUE(rtc.getReadWakeReasonJobResult(report).ok());
+  TEST_ASSERT_EQUAL_HEX16(expected, report.reasons);
+  TEST_ASSERT_EQUAL_HEX16(
+      static_cast<uint16_t>(RV3032::WakeReason::ALARM) |
+          static_cast<uint16_t>(RV3032::WakeReason::EVENT) |
+          static_cast<uint16_t>(RV3032::WakeReason::BACKUP_SWITCH),
+      report.acknowledged);
+  TEST_ASSERT_EQUAL_HEX8(
+      static_cast<uint8_t>(1u << RV3032::cmd::STATUS_PORF_BIT),
+      fake.direct[RV3032::cmd::REG_STATUS]);
+  TEST_ASSERT_EQUAL_HEX8(0x50, fake.direct[RV3032::cmd::REG_TEMP_LSB]);
+
+  // Nothing to acknowledge: one callback, no write.
+  before = fake.callbackCount;
+  TEST_ASSERT_TRUE(rtc.startReadWakeReasonJob(true, fake.nowMs).inProgress());
+  TEST_ASSERT_TRUE(pollJobToCompletion(rtc, fake).ok());
+  TEST_ASSERT_EQUAL_UINT32(before + 1U, fake.callbackCount);
+
+  // EEbusy blocks only the TEMP_LSB write; the Status acknowledgement stands.
+  fake.direct[RV3032::cmd::REG_STATUS] =
+      static_cast<uint8_t>(1u << RV3032::cmd::STATUS_TF_BIT);
+  fake.direct[RV3032::cmd::REG_TEMP_LSB] = static_cast<uint8_t>(
+      RV3032::cmd::EEPROM_BUSY_MASK | RV3032::cmd::TEMP_CLKF_MASK);
+  before = fake.callbackCount;
+  TEST_ASSERT_TRUE(rtc.startReadWakeReasonJob(true, fake.nowMs).inProgress());
+  TEST_ASSERT_EQUAL_UINT8(static_cast<uint8_t>(RV3032::Err::BUSY),
+                          static_cast<uint8_t>(
+                              pollJobToCompletion(rtc, fake).code));
+  TEST_ASSERT_EQUAL_UINT32(before + 2U, fake.callbackCount);
+  TEST_ASSERT_EQUAL_UINT8(static_cast<uint8_t>(RV3032::Err::BUSY),
+                          static_cast<uint8_t>(
+                              rtc.getReadWakeReasonJobResult(report).code));
+  TEST_ASSERT_EQUAL_HEX16(static_cast<uint16_t>(RV3032::WakeReason::TIMER),
+                          report.acknowledged);
+  TEST_ASSERT_TRUE(report.has(RV3032::WakeReason::CLOCK_OUTPUT));
+  TEST_ASSERT_EQUAL_HEX8(0, fake.direct[RV3032::cmd::REG_STATUS]);
+  TEST_ASSERT_BITS_HIGH(RV3032::cmd::TEMP_CLKF_MASK,
+                        fake.direct[RV3032::cmd::REG_TEMP_LSB]);
+}
+
 void test_fake_refresh_initial_busy_and_acked_ignore_faults() {
   FakeRv3032 refreshFake;
   refreshFake.activeConfig[0] = 0;
@@ -5106,7 +7296,7 @@ void test_ordinary_deadline_states_are_exclusive_at_boundary_and_late() {
   const DeadlineCase cases[] = {
       {DeadlineJob::COHERENT_TEMPERATURE, 2, 100},
       {DeadlineJob::TIME_SNAPSHOT, 2, 100},
-      {DeadlineJob::VERIFIED_SET, 7, 250},
+      {DeadlineJob::VERIFIED_SET, 5, 250},
   };
   const RV3032::DateTime requested{2026, 7, 13, 12, 0, 0, 1};
 
@@ -7019,7 +9209,7 @@ RV3032::Status getPhase2ConfigurationPathResult(
 
 uint8_t phase2ConfigurationSuccessCap(Phase2ConfigurationPath path) {
   switch (path) {
-    case Phase2ConfigurationPath::TIMER: return 6;
+    case Phase2ConfigurationPath::TIMER: return 5;
     case Phase2ConfigurationPath::PERIODIC: return 5;
     case Phase2ConfigurationPath::CLKOUT: return 5;
     case Phase2ConfigurationPath::TEMPERATURE: return 7;
@@ -7029,7 +9219,7 @@ uint8_t phase2ConfigurationSuccessCap(Phase2ConfigurationPath path) {
 
 uint8_t phase2ConfigurationWorstCap(Phase2ConfigurationPath path) {
   switch (path) {
-    case Phase2ConfigurationPath::TIMER: return 9;
+    case Phase2ConfigurationPath::TIMER: return 8;
     case Phase2ConfigurationPath::PERIODIC: return 8;
     case Phase2ConfigurationPath::CLKOUT: return 8;
     case Phase2ConfigurationPath::TEMPERATURE: return 10;
@@ -7040,7 +9230,7 @@ uint8_t phase2ConfigurationWorstCap(Phase2ConfigurationPath path) {
 uint8_t phase2ConfigurationFirstWriteOrdinal(
     Phase2ConfigurationPath path) {
   switch (path) {
-    case Phase2ConfigurationPath::TIMER: return 3;
+    case Phase2ConfigurationPath::TIMER: return 2;
     case Phase2ConfigurationPath::PERIODIC: return 2;
     case Phase2ConfigurationPath::CLKOUT: return 3;
     case Phase2ConfigurationPath::TEMPERATURE: return 2;
@@ -7051,7 +9241,7 @@ uint8_t phase2ConfigurationFirstWriteOrdinal(
 uint8_t phase2ConfigurationMismatchWriteOrdinal(
     Phase2ConfigurationPath path) {
   switch (path) {
-    case Phase2ConfigurationPath::TIMER: return 4;
+    case Phase2ConfigurationPath::TIMER: return 3;
     case Phase2ConfigurationPath::PERIODIC: return 3;
     case Phase2ConfigurationPath::CLKOUT: return 3;
     case Phase2ConfigurationPath::TEMPERATURE: return 4;
@@ -7063,9 +9253,9 @@ size_t phase2ConfigurationForwardWriteOrdinals(
     Phase2ConfigurationPath path, uint8_t* ordinals) {
   switch (path) {
     case Phase2ConfigurationPath::TIMER:
-      ordinals[0] = 3;
-      ordinals[1] = 4;
-      ordinals[2] = 5;
+      ordinals[0] = 2;
+      ordinals[1] = 3;
+      ordinals[2] = 4;
       return 3;
     case Phase2ConfigurationPath::PERIODIC:
       ordinals[0] = 2;
@@ -7570,7 +9760,7 @@ void test_phase2_configuration_reports_caps_and_safe_cleanup() {
         static_cast<uint8_t>(RV3032::ConfigurationFinalState::UNKNOWN),
         static_cast<uint8_t>(sentinel.finalState));
     TEST_ASSERT_TRUE(pollJobToCompletion(rtc, fake, 1).ok());
-    TEST_ASSERT_EQUAL_UINT32(6, fake.callbackCount);
+    TEST_ASSERT_EQUAL_UINT32(5, fake.callbackCount);
     RV3032::ConfigurationJobReport report{};
     TEST_ASSERT_TRUE(rtc.getSetTimerJobResult(report).ok());
     TEST_ASSERT_EQUAL_UINT8(
@@ -7641,7 +9831,7 @@ void test_phase2_configuration_reports_caps_and_safe_cleanup() {
 
   {
     FakeRv3032 fake;
-    fake.failOrdinal = 5;
+    fake.failOrdinal = 4;
     RV3032::RV3032 rtc;
     TEST_ASSERT_TRUE(rtc.begin(fake.config(false)).ok());
     TEST_ASSERT_TRUE(rtc.setTimer(
@@ -7658,7 +9848,7 @@ void test_phase2_configuration_reports_caps_and_safe_cleanup() {
         static_cast<uint8_t>(report.finalState));
     TEST_ASSERT_TRUE(report.cleanupStatus.ok());
     TEST_ASSERT_TRUE(report.mutationAttempted);
-    TEST_ASSERT_EQUAL_UINT32(6, fake.callbackCount);
+    TEST_ASSERT_EQUAL_UINT32(5, fake.callbackCount);
     TEST_ASSERT_BITS_LOW(
         static_cast<uint8_t>(1u << RV3032::cmd::CTRL1_TE_BIT),
         fake.direct[RV3032::cmd::REG_CONTROL1]);
@@ -7666,8 +9856,8 @@ void test_phase2_configuration_reports_caps_and_safe_cleanup() {
 
   {
     FakeRv3032 fake;
-    fake.failOrdinal = 6;
-    fake.ignoreWriteOrdinal = 8;
+    fake.failOrdinal = 5;
+    fake.ignoreWriteOrdinal = 7;
     RV3032::RV3032 rtc;
     TEST_ASSERT_TRUE(rtc.begin(fake.config(false)).ok());
     TEST_ASSERT_TRUE(rtc.setTimer(
@@ -7688,7 +9878,7 @@ void test_phase2_configuration_reports_caps_and_safe_cleanup() {
     TEST_ASSERT_EQUAL_UINT8(
         static_cast<uint8_t>(RV3032::ConfigurationFinalState::UNKNOWN),
         static_cast<uint8_t>(report.finalState));
-    TEST_ASSERT_EQUAL_UINT32(9, fake.callbackCount);
+    TEST_ASSERT_EQUAL_UINT32(8, fake.callbackCount);
     TEST_ASSERT_EQUAL_UINT32(1,
         countWritesTo(fake, RV3032::cmd::REG_TIMER_LOW));
   }
@@ -7876,7 +10066,7 @@ void test_phase2_quiescence_guard_caps_and_evi_reset_no_replay() {
         countWritesTo(fake, RV3032::cmd::REG_EVI_CONTROL));
   }
 
-  for (uint32_t faultOrdinal = 0; faultOrdinal <= 4; ++faultOrdinal) {
+  for (uint32_t faultOrdinal = 0; faultOrdinal <= 3; ++faultOrdinal) {
     FakeRv3032 fake;
     fake.direct[RV3032::cmd::REG_TS_CONTROL] = static_cast<uint8_t>(
         1u << RV3032::cmd::TS_EVI_RESET_BIT);
@@ -7888,20 +10078,77 @@ void test_phase2_quiescence_guard_caps_and_evi_reset_no_replay() {
     const RV3032::Status terminal = pollJobToCompletion(rtc, fake, 1);
     if (faultOrdinal == 0) {
       TEST_ASSERT_TRUE(terminal.ok());
-      TEST_ASSERT_EQUAL_UINT32(4, fake.callbackCount);
+      TEST_ASSERT_EQUAL_UINT32(3, fake.callbackCount);
       TEST_ASSERT_EQUAL_UINT32(2,
           countWritesTo(fake, RV3032::cmd::REG_TS_CONTROL));
     } else {
       TEST_ASSERT_EQUAL_UINT8(static_cast<uint8_t>(RV3032::Err::I2C_BUS),
                               static_cast<uint8_t>(terminal.code));
-      TEST_ASSERT_LESS_OR_EQUAL_UINT32(4, fake.callbackCount);
+      TEST_ASSERT_LESS_OR_EQUAL_UINT32(3, fake.callbackCount);
       TEST_ASSERT_EQUAL_UINT32(
-          faultOrdinal < 3 ? 0 : faultOrdinal == 3 ? 1 : 2,
+          faultOrdinal < 2 ? 0 : faultOrdinal == 2 ? 1 : 2,
           countWritesTo(fake, RV3032::cmd::REG_TS_CONTROL));
     }
   }
 }
 
+void test_adjacent_guard_and_original_reads_share_one_burst() {
+  {
+    FakeRv3032 fake;
+    RV3032::RV3032 rtc;
+    TEST_ASSERT_TRUE(rtc.begin(fake.config(false)).ok());
+    TEST_ASSERT_TRUE(rtc.setTimer(
+        0x123, RV3032::TimerFrequency::Hz64, true).inProgress());
+    TEST_ASSERT_TRUE(pollJobToCompletion(rtc, fake, 1).ok());
+    TEST_ASSERT_EQUAL_UINT32(5, fake.callbackCount);
+    TEST_ASSERT_FALSE(fake.log[0].write);
+    TEST_ASSERT_EQUAL_HEX8(RV3032::cmd::REG_CONTROL1, fake.log[0].reg);
+    TEST_ASSERT_EQUAL_UINT8(2, fake.log[0].length);
+  }
+
+  {
+    FakeRv3032 fake;
+    fake.direct[RV3032::cmd::REG_TS_CONTROL] = 0xE7;
+    RV3032::RV3032 rtc;
+    TEST_ASSERT_TRUE(rtc.begin(fake.config(false)).ok());
+    TEST_ASSERT_TRUE(rtc.resetTimestamp(
+        RV3032::TimestampSource::Evi).inProgress());
+    TEST_ASSERT_TRUE(pollJobToCompletion(rtc, fake, 1).ok());
+    TEST_ASSERT_EQUAL_UINT32(3, fake.callbackCount);
+    TEST_ASSERT_FALSE(fake.log[0].write);
+    TEST_ASSERT_EQUAL_HEX8(RV3032::cmd::REG_CONTROL2, fake.log[0].reg);
+    TEST_ASSERT_EQUAL_UINT8(3, fake.log[0].length);
+    TEST_ASSERT_EQUAL_HEX8(RV3032::cmd::TS_CONTROL_OVERWRITE_MASK,
+                           fake.log[1].data[0]);
+  }
+
+  {
+    FakeRv3032 fake;
+    fake.direct[RV3032::cmd::REG_CONTROL2] = static_cast<uint8_t>(
+        1u << RV3032::cmd::CTRL2_EIE_BIT);
+    RV3032::RV3032 rtc;
+    TEST_ASSERT_TRUE(rtc.begin(fake.config(false)).ok());
+    TEST_ASSERT_TRUE(rtc.resetTimestamp(
+        RV3032::TimestampSource::Evi).inProgress());
+    TEST_ASSERT_EQUAL_UINT8(static_cast<uint8_t>(RV3032::Err::BUSY),
+        static_cast<uint8_t>(pollJobToCompletion(rtc, fake, 1).code));
+    TEST_ASSERT_EQUAL_UINT32(1, fake.callbackCount);
+    TEST_ASSERT_EQUAL_UINT32(0,
+        countWritesTo(fake, RV3032::cmd::REG_TS_CONTROL));
+  }
+
+  {
+    // EVI_CONTROL is four registers past the guard: kept as two reads.
+    FakeRv3032 fake;
+    RV3032::RV3032 rtc;
+    TEST_ASSERT_TRUE(rtc.begin(fake.config(false)).ok());
+    TEST_ASSERT_TRUE(rtc.setEviEdge(true).inProgress());
+    TEST_ASSERT_TRUE(pollJobToCompletion(rtc, fake, 1).ok());
+    TEST_ASSERT_EQUAL_UINT32(3, fake.callbackCount);
+    TEST_ASSERT_EQUAL_UINT8(1, fake.log[0].length);
+  }
+}
+
 void test_phase2_persistent_operation_and_cleanup_evidence_are_separate() {
   FakeRv3032 baseline;
   baseline.persistent[1] = 0x5A;
@@ -9101,8 +11348,17 @@ int main(int, char**) {
   RUN_TEST(test_status_first_snapshot_job_and_result_contract);
   RUN_TEST(test_status_first_snapshot_rejects_every_invalid_calendar_encoding);
   RUN_TEST(test_status_first_snapshot_exposes_typed_invalid_flags);
+  RUN_TEST(test_validity_cached_snapshot_reads_one_fused_burst);
+  RUN_TEST(test_job_result_views_borrow_results_until_next_admission);
+  RUN_TEST(test_eeprom_queue_item_bumps_job_generation);
+  RUN_TEST(test_plan_job_matches_fake_success_paths);
+  RUN_TEST(test_published_job_bounds_hold_under_fault_injection);
+  RUN_TEST(test_published_blocking_call_bounds_hold_under_fault_injection);
+  RUN_TEST(test_cancel_job_skips_forward_steps_with_bounded_cleanup);
   RUN_TEST(test_verified_calendar_accepts_user_assigned_readback_weekday);
   RUN_TEST(test_verified_calendar_set_reports_status_side_effects);
+  RUN_TEST(test_verified_calendar_aligned_mode_lands_write_on_second_boundary);
+  RUN_TEST(test_reuse_transfer_timestamps_reads_clock_once_per_instruction);
   RUN_TEST(test_verified_calendar_status_payload_is_fixed_for_every_status);
   RUN_TEST(test_verified_calendar_preserves_flags_set_between_read_and_write);
   RUN_TEST(test_verified_calendar_set_validation_and_wrapped_deadline_are_zero_io);
@@ -9116,16 +11372,19 @@ int main(int, char**) {
   RUN_TEST(test_verified_calendar_retains_proven_status_write_on_later_failure);
   RUN_TEST(test_job_budget_and_timer_reserved_bits);
   RUN_TEST(test_raw_access_allowlists_block_side_effect_routes);
+  RUN_TEST(test_generated_register_map_matches_raw_access_contract);
   RUN_TEST(test_persistent_inspection_uses_direct_two_read_proof);
   RUN_TEST(test_persistent_read_result_contract_and_partial_evidence);
   RUN_TEST(test_persistent_dynamic_cleanup_reserve_admission_is_zero_io);
   RUN_TEST(test_user_eeprom_write_is_compare_once_and_durably_verified);
   RUN_TEST(test_user_eeprom_read_boundaries_and_maximum_chunk);
+  RUN_TEST(test_persistent_read_cache_serves_proven_bytes_with_zero_io);
   RUN_TEST(test_user_eeprom_write_admission_copy_and_partial_failure_report);
   RUN_TEST(test_persistence_queue_capacity_duplicates_fifo_and_admission_guards);
   RUN_TEST(test_settings_snapshot_tracks_job_queue_health_and_deadlines);
   RUN_TEST(test_fake_wait_request_log_is_bounded_and_reports_overflow);
   RUN_TEST(test_generic_persistence_uses_full_budget_and_durable_protocol);
+  RUN_TEST(test_write_behind_persistence_writes_only_the_settled_value);
   RUN_TEST(test_generic_persistence_clears_stale_eef_and_restores_access_state);
   RUN_TEST(test_generic_persistence_minimum_write_wait_has_no_early_io);
   RUN_TEST(test_generic_persistence_reports_low_vdd_and_initial_busy_failures);
@@ -9134,15 +11393,23 @@ int main(int, char**) {
   RUN_TEST(test_generic_multi_instruction_poll_refreshes_mutation_cutoff);
   RUN_TEST(test_generic_persistence_staging_and_ambiguous_write_one_paths);
   RUN_TEST(test_public_unix_read_set_and_range_contract);
+  RUN_TEST(test_packed_datetime_orders_and_round_trips_every_day);
+  RUN_TEST(test_telemetry_codec_round_trips_and_indexes_blocks);
+  RUN_TEST(test_valid_date_time_overloads_match_checked_apis);
+  RUN_TEST(test_time_zone_tables_convert_across_transitions);
+  RUN_TEST(test_iso8601_format_and_parse_follow_datetime_validation);
   RUN_TEST(test_periodic_timer_event_flags_and_guarded_status_clear);
   RUN_TEST(test_primary_cell_already_correct_is_read_only_and_latched);
   RUN_TEST(test_primary_cell_updates_exact_target_once);
+  RUN_TEST(test_primary_cell_job_matches_synchronous_report_without_waits);
+  RUN_TEST(test_primary_cell_job_matches_synchronous_prepare_faults);
   RUN_TEST(test_primary_cell_preserves_all_nclke_tcr_and_control1_bits);
   RUN_TEST(test_primary_cell_rejects_persistent_c0_bit7_without_target_write);
   RUN_TEST(test_primary_cell_repairs_stale_active_from_correct_persistence);
   RUN_TEST(test_primary_cell_preconditions_do_not_consume_attempt);
   RUN_TEST(test_primary_cell_ambiguous_write_is_reconciled_without_retry);
   RUN_TEST(test_typed_controls_use_correct_vendor_bits);
+  RUN_TEST(test_batch_read_cache_coalesces_control_reads_only);
   RUN_TEST(test_control_setters_and_flag_clears_are_cooperative);
   RUN_TEST(test_primary_cell_wait_and_wrap_guards);
   RUN_TEST(test_primary_cell_callback_timeouts_clip_to_transfer_and_overall);
@@ -9159,9 +11426,14 @@ int main(int, char**) {
   RUN_TEST(test_static_calendar_and_status_utility_coverage);
   RUN_TEST(test_rebegin_rebinds_context_and_resets_only_lifecycle_latch);
   RUN_TEST(test_alarm_timer_and_pmu_round_trips_are_cooperative);
+  RUN_TEST(test_timer_remaining_is_one_burst_and_exact_per_source);
   RUN_TEST(test_clkout_factory_defaults_and_persistence_contract);
   RUN_TEST(test_clkout_offset_temperature_and_event_round_trips);
+  RUN_TEST(test_integer_offset_and_temperature_match_float_apis);
+  RUN_TEST(test_fake_device_model_advances_virtual_time);
   RUN_TEST(test_timestamp_stop_gp_and_ram_public_coverage);
+  RUN_TEST(test_telemetry_frame_decodes_one_burst_with_independent_fields);
+  RUN_TEST(test_wake_reason_job_decodes_one_burst_and_acknowledges_observed_flags);
   RUN_TEST(test_fake_refresh_initial_busy_and_acked_ignore_faults);
   RUN_TEST(test_shared_job_transport_failure_is_observable_without_retry);
   RUN_TEST(test_transport_status_domain_and_health_attempt_evidence);
@@ -9189,6 +11461,7 @@ int main(int, char**) {
   RUN_TEST(test_phase2_configuration_reports_caps_and_safe_cleanup);
   RUN_TEST(test_phase2_quiescence_uie_and_tick_contracts);
   RUN_TEST(test_phase2_quiescence_guard_caps_and_evi_reset_no_replay);
+  RUN_TEST(test_adjacent_guard_and_original_reads_share_one_burst);
   RUN_TEST(test_phase2_persistent_operation_and_cleanup_evidence_are_separate);
   RUN_TEST(test_phase2_typed_persistence_mixed_failure_and_getter_matrix);
   RUN_TEST(test_phase2_generic_batch_evidence_precedence_and_reset);
@@ -281,6 +281,10 @@ def main() -> int:
         "Status RV3032::startWriteUserEepromJob(",
         "Status RV3032::getPersistentReadJobResult(",
     )
+    primary_cell_start = function_body(
+        "Status RV3032::startEnsurePrimaryCellConfigurationJob(",
+        "Status RV3032::getEnsurePrimaryCellConfigurationJobResult(",
+    )
     backup_start = function_body(
         "Status RV3032::startSetBackupSwitchModeJob(",
         "Status RV3032::getBackupSwitchMode(",
@@ -314,13 +318,14 @@ def main() -> int:
     )
     if not cleanup_formula.search(source):
         errors.append("shared cleanup-reserve formula has drifted")
-    if source.count("persistentCleanupReserveMs(") != 5:
-        errors.append("all four cleanup-reserve owners must use the shared helper")
+    if source.count("persistentCleanupReserveMs(") != 6:
+        errors.append("all five cleanup-reserve owners must use the shared helper")
     if "GENERIC_EEPROM_OPERATION_TIMEOUT_MS - cleanupReserveMs" not in process_eeprom:
         errors.append("generic queue cutoff is not derived from its whole deadline")
     for name, body, timeout_name in (
         ("persistent read", persistent_read_start, "timeoutMs"),
         ("persistent write", persistent_write_start, "operationTimeoutMs"),
+        ("primary-cell ensure", primary_cell_start, "operationTimeoutMs"),
     ):
         if "cleanupReserveMs + _config.i2cTimeoutMs + 1U" not in body:
             errors.append(f"{name} admission omits forward-callback cleanup margin")
@@ -351,14 +356,14 @@ def main() -> int:
     phase2_graphs = {
         "timer": (
             [
-                "TIMER_READ_CONTROL2_GUARD", "TIMER_READ_CONTROL1",
+                "TIMER_READ_CONTROLS",
                 "TIMER_WRITE_SAFE_CONTROL1", "TIMER_WRITE_PRESET",
                 "TIMER_WRITE_FINAL_CONTROL1", "TIMER_VERIFY",
                 "TIMER_CLEANUP_READ", "TIMER_CLEANUP_WRITE",
                 "TIMER_CLEANUP_VERIFY",
             ],
-            6,
-            9,
+            5,
+            8,
         ),
         "periodic": (
             [
@@ -448,15 +453,15 @@ def main() -> int:
     finish_backup_end = poll_job.find("Status st = Status::Ok();", finish_backup_start)
     finish_backup = poll_job[finish_backup_start:finish_backup_end]
     if finish_backup.find("ConfigurationFinalState::REQUESTED_VERIFIED") < 0 or \
-       finish_backup.find("eepromQueuePush(") < 0 or \
+       finish_backup.find("queuePersistence(") < 0 or \
        finish_backup.find("ConfigurationFinalState::REQUESTED_VERIFIED") > \
-       finish_backup.find("eepromQueuePush("):
+       finish_backup.find("queuePersistence("):
         errors.append("backup persistence is not ordered after requested-state proof")
     clkout_verify = job_case_body("CLKOUT_VERIFY")
     if clkout_verify.find("markConfigurationRequested();") < 0 or \
-       clkout_verify.find("eepromQueuePush(") < 0 or \
+       clkout_verify.find("queuePersistence(") < 0 or \
        clkout_verify.find("markConfigurationRequested();") > \
-       clkout_verify.find("eepromQueuePush("):
+       clkout_verify.find("queuePersistence("):
         errors.append("CLKOUT persistence is not ordered after requested-state proof")
     for name, body, validator, wrapper in (
         (
@@ -695,10 +700,11 @@ def main() -> int:
                 "SET_TEMPERATURE_EVENT_CONFIG", "REGISTER_UPDATE",
                 "TEMP_LSB_FLAG_CLEAR", "WRITE_USER_RAM",
                 "READ_COHERENT_TEMPERATURE", "READ_TIME_SNAPSHOT",
-                "SET_TIME_VERIFIED", "PERSISTENT_READ", "USER_EEPROM_WRITE",
+                "READ_WAKE_REASON", "SET_TIME_VERIFIED", "PERSISTENT_READ", "USER_EEPROM_WRITE",
+                "ENSURE_PRIMARY_CELL", "READ_TELEMETRY_FRAME",
             ],
             "JobState": [
-                "IDLE", "TIMER_READ_CONTROL2_GUARD", "TIMER_READ_CONTROL1",
+                "IDLE", "TIMER_READ_CONTROLS",
                 "TIMER_WRITE_SAFE_CONTROL1", "TIMER_WRITE_PRESET",
                 "TIMER_WRITE_FINAL_CONTROL1", "TIMER_VERIFY",
                 "TIMER_CLEANUP_READ", "TIMER_CLEANUP_WRITE",
@@ -726,10 +732,11 @@ def main() -> int:
                 "TEMPERATURE_CLEANUP_READ", "TEMPERATURE_CLEANUP_WRITE",
                 "TEMPERATURE_CLEANUP_VERIFY", "WRITE_USER_RAM_CHUNK",
                 "READ_TEMPERATURE_FIRST", "READ_TEMPERATURE_SECOND",
-                "READ_TIME_STATUS", "READ_TIME_CALENDAR",
+                "READ_TIME_STATUS", "READ_TIME_CALENDAR", "READ_TIME_FUSED",
+                "WAKE_READ_FLAGS", "WAKE_ACK_STATUS", "WAKE_ACK_TEMP_LSB",
+                "TELEMETRY_READ_FRAME",
                 "SET_TIME_READ_STATUS_BEFORE", "SET_TIME_WRITE_CALENDAR",
-                "SET_TIME_VERIFY_CALENDAR", "SET_TIME_READ_STATUS_BEFORE_CLEAR",
-                "SET_TIME_WRITE_STATUS", "SET_TIME_READ_STATUS_AFTER",
+                "SET_TIME_VERIFY_CALENDAR", "SET_TIME_WRITE_STATUS",
                 "SET_TIME_READ_FINAL_CALENDAR", "PERSISTENT",
             ],
         }
@@ -0,0 +1,149 @@
+#!/usr/bin/env python3
+"""Decode RV3032 telemetry blocks (include/RV3032/TelemetryCodec.h) to CSV.
+
+Usage:
+  tools/decode_telemetry.py BLOCK_SIZE FILE [FILE...]
+      Decode files holding consecutive fixed-size blocks. Erased blocks
+      (all 0xFF) are skipped; malformed blocks stop with exit code 1.
+  tools/decode_telemetry.py --self-test
+      Decode the vector shared with the native test suite.
+"""
+
+from __future__ import annotations
+
+import csv
+import struct
+import sys
+from datetime import datetime, timezone
+from typing import Iterator, List, Tuple
+
+EPOCH_2000 = 946684800
+END_OF_2099 = 4102444799
+HEADER_SIZE = 16
+VERSION = 1
+
+# Same bytes as kVector in test/test_native/test_datetime.cpp.
+SELF_TEST_VECTOR = bytes.fromhex(
+    "52 54 01 00 04 00 17 00 00 b9 55 69 00 00 90 01"
+    "a0 06 00 93 03 04 02 ff ff ff ff ff ff ff ff ff"
+)
+SELF_TEST_RECORDS = [
+    (1767225600, 0, 0x00, 400),
+    (1767225601, 0, 0x00, 400),
+    (1767225602, 0, 0x00, 400),
+    (1767225603, 50, 0x04, 401),
+]
+
+Record = Tuple[int, int, int, int]
+
+
+class MalformedBlock(ValueError):
+    pass
+
+
+def _unzigzag(value: int) -> int:
+    return (value >> 1) ^ -(value & 1)
+
+
+def _varint(block: bytes, offset: int, end: int) -> Tuple[int, int]:
+    value = 0
+    for index in range(10):
+        if offset >= end:
+            break
+        byte = block[offset]
+        offset += 1
+        value |= (byte & 0x7F) << (7 * index)
+        if not byte & 0x80:
+            return value, offset
+    raise MalformedBlock("truncated varint")
+
+
+def _check_record(record: Record) -> Record:
+    timestamp, hundredths, _, temperature = record
+    if not (EPOCH_2000 <= timestamp <= END_OF_2099 and hundredths <= 99
+            and -2048 <= temperature <= 2047):
+        raise MalformedBlock(f"record out of range: {record}")
+    return record
+
+
+def decode_block(block: bytes) -> List[Record]:
+    if len(block) < HEADER_SIZE or block[0:2] != b"RT" or block[2] != VERSION or block[3] != 0:
+        raise MalformedBlock("bad header")
+    count, used, timestamp, hundredths, status, temperature = struct.unpack_from(
+        "<HHIBBh", block, 4)
+    if used < HEADER_SIZE or used > len(block) or (count == 0 and used != HEADER_SIZE):
+        raise MalformedBlock("bad used length")
+    if count == 0:
+        return []
+    records = [_check_record((timestamp, hundredths, status, temperature))]
+    centis = (timestamp - EPOCH_2000) * 100 + hundredths
+    delta = 0
+    offset = HEADER_SIZE
+    for _ in range(count - 1):
+        head, offset = _varint(block, offset, used)
+        delta += _unzigzag(head >> 2)
+        centis += delta
+        if head & 0x02:
+            if offset >= used:
+                raise MalformedBlock("truncated status")
+            status = block[offset]
+            offset += 1
+        if head & 0x01:
+            encoded, offset = _varint(block, offset, used)
+            temperature += _unzigzag(encoded)
+        if centis < 0:
+            raise MalformedBlock("timestamp before 2000")
+        records.append(_check_record(
+            (EPOCH_2000 + centis // 100, centis % 100, status, temperature)))
+    if offset != used:
+        raise MalformedBlock("trailing bytes")
+    return records
+
+
+def iter_blocks(data: bytes, block_size: int) -> Iterator[Tuple[int, bytes]]:
+    for index in range(0, len(data) // block_size):
+        block = data[index * block_size:(index + 1) * block_size]
+        if block.count(0xFF) == len(block):
+            continue
+        yield index, block
+
+
+def _self_test() -> int:
+    decoded = decode_block(SELF_TEST_VECTOR)
+    if decoded != SELF_TEST_RECORDS:
+        print(f"Telemetry self-test FAILED: {decoded}")
+        return 1
+    print("Telemetry self-test PASSED")
+    return 0
+
+
+def main(args: List[str]) -> int:
+    if args == ["--self-test"]:
+        return _self_test()
+    if len(args) < 2 or not args[0].isdigit():
+        print(__doc__.strip(), file=sys.stderr)
+        return 2
+    block_size = int(args[0])
+    writer = csv.writer(sys.stdout, lineterminator="\n")
+    writer.writerow(["utc", "unix", "hundredths", "status", "temperature_c"])
+    for path in args[1:]:
+        with open(path, "rb") as handle:
+            data = handle.read()
+        for index, block in iter_blocks(data, block_size):
+            try:
+                records = decode_block(block)
+            except MalformedBlock as error:
+                print(f"{path}: block {index}: {error}", file=sys.stderr)
+                return 1
+            for timestamp, hundredths, status, temperature in records:
+                moment = datetime.fromtimestamp(timestamp, timezone.utc)
+                writer.writerow([
+                    moment.strftime("%Y-%m-%dT%H:%M:%S") + f".{hundredths:02d}Z",
+                    timestamp, hundredths, f"0x{status:02X}",
+                    f"{temperature / 16:.4f}",
+                ])
+    return 0
+
+
+if __name__ == "__main__":
+    raise SystemExit(main(sys.argv[1:]))